@@ -89,6 +89,7 @@ int main(int argc, char *argv[])
   int initial_index = 0;     // indiex of the initial condition
   double final_time = 1.0;   // final time
   std::string sol_bName("SOL_"); // base name of the solution file
+  std::string perf_trace_file(""); // per-step timing trace, disabled if empty
   int ttan_renew_freq = 1;   // frequency of tangent matrix renewal
   int sol_record_freq = 1;   // frequency of recording the solution
 
@@ -104,6 +105,10 @@ int main(int argc, char *argv[])
   // prescribed time for rotating part to reach angular velocity // 1.5 1.0
   double angular_thd_time = 1.5;
 
+  // Assemble the rotor elements with the basis built once with the
+  // reference coordinates, valid if the rotor moves rigidly
+  bool is_rigid_rotor = false;
+
   // Yaml options
   bool is_loadYaml = true;
   std::string yaml_file("./runscript.yml");
@@ -156,7 +161,9 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt("-ttan_freq", ttan_renew_freq);
   SYS_T::GetOptionInt("-sol_rec_freq", sol_record_freq);
   SYS_T::GetOptionString("-sol_name", sol_bName);
+  SYS_T::GetOptionString("-perf_trace_file", perf_trace_file);
   SYS_T::GetOptionBool("-is_restart", is_restart);
+  SYS_T::GetOptionBool("-is_rigid_rotor", is_rigid_rotor);
   SYS_T::GetOptionInt("-restart_index", restart_index);
   SYS_T::GetOptionReal("-restart_time", restart_time);
   SYS_T::GetOptionReal("-restart_step", restart_step);
@@ -194,6 +201,8 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-ttan_freq:", ttan_renew_freq);
   SYS_T::cmdPrint("-sol_rec_freq:", sol_record_freq);
   SYS_T::cmdPrint("-sol_name:", sol_bName);
+  if( !perf_trace_file.empty() )
+    SYS_T::cmdPrint("-perf_trace_file:", perf_trace_file);
   if(is_restart)
   {
     SYS_T::commPrint("-is_restart: true \n");
@@ -204,6 +213,9 @@ int main(int argc, char *argv[])
   }
   else SYS_T::commPrint("-is_restart: false \n");
 
+  if( is_rigid_rotor ) SYS_T::commPrint("-is_rigid_rotor: true \n");
+  else SYS_T::commPrint("-is_rigid_rotor: false \n");
+
   // ===== Record important solver options =====
   if(rank == 0)
   {
@@ -389,7 +401,8 @@ int main(int argc, char *argv[])
     std::move(locIEN), std::move(locElem),
     std::move(fNode), std::move(pNode), 
     std::move(locnbc), std::move(locebc), std::move(locwbc), std::move(locitf),
-    std::move(locAssem_ptr), std::move(SI_sol), std::move(SI_qp), gbc.get(), nz_estimate );
+    std::move(locAssem_ptr), std::move(SI_sol), std::move(SI_qp), gbc.get(), nz_estimate,
+    is_rigid_rotor );
 
   gloAssem_ptr->Update_SI_state(sol.get(), velo_mesh.get(), disp_mesh.get());
 
@@ -534,6 +547,8 @@ int main(int argc, char *argv[])
 
   MPI_Barrier(PETSC_COMM_WORLD);
 
+  SYS_T::Perf_Registry::instance().set_trace_file( perf_trace_file );
+
   // ===== FEM analysis =====
   SYS_T::commPrint("===> Start Finite Element Analysis:\n");
 
@@ -545,6 +560,8 @@ int main(int argc, char *argv[])
   // ===== Print complete solver info =====
   tsolver -> print_lsolver_info();
 
+  SYS_T::Perf_Registry::instance().print_summary();
+
   MatDestroy(&shell_mat);
 
   // ===== Clean Memory =====
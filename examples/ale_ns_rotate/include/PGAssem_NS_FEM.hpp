@@ -49,7 +49,8 @@ class PGAssem_NS_FEM : public IPGAssem
         std::unique_ptr<SI_T::SI_solution> in_SI_sol,
         std::unique_ptr<SI_T::SI_quad_point> in_SI_qp,
         const IGenBC * const &gbc,
-        const int &in_nz_estimate=60 );
+        const int &in_nz_estimate=60,
+        const bool &in_is_rigid_rotor=false );
 
     // Destructor
     virtual ~PGAssem_NS_FEM();
@@ -108,6 +109,21 @@ class PGAssem_NS_FEM : public IPGAssem
         const ALocal_InflowBC * const &infbc_part,
         const int &nbc_id ) const;
 
+    // Batched surface integrals over all outlets / inlets, with one
+    // MPI_Allreduce for all faces
+    virtual void Assem_surface_outlet_data(
+        const PDNSolution * const &dot_sol,
+        const PDNSolution * const &sol,
+        std::vector<double> &dot_flrate,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const;
+
+    virtual void Assem_surface_inlet_data(
+        const PDNSolution * const &sol,
+        const ALocal_InflowBC * const &infbc_part,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const;
+
     virtual void Interface_K_MF(Vec &X, Vec &Y);
 
     virtual void Update_SI_state(
@@ -115,10 +131,13 @@ class PGAssem_NS_FEM : public IPGAssem
         const PDNSolution * const &mvelo,
         const PDNSolution * const &mdisp )
     {
-      SI_sol->update_node_sol(sol);
-      SI_sol->update_node_mvelo(mvelo);
+      // The search uses the mesh displacement, and the nodes exchanged for
+      // the solution and the mesh velocity depend on the search
       SI_sol->update_node_mdisp(mdisp);
       SI_qp->search_all_opposite_point(itf.get(), SI_sol.get());
+      SI_qp->set_comm_plan(itf.get(), SI_sol.get());
+      SI_sol->update_node_sol(sol);
+      SI_sol->update_node_mvelo(mvelo);
     }
 
     virtual void Update_SI_sol(
@@ -163,6 +182,20 @@ class PGAssem_NS_FEM : public IPGAssem
 
     double time_step;
 
+    // If the rotor moves rigidly, the volume elements of the rotor, i.e.,
+    // with tag 1, have their basis built once with the reference
+    // coordinates, and the volume assembly of these elements calls the
+    // *_Rigid routines of the local assembly. The local element index of
+    // the rotor elements is rotor_index[ee], or -1 for the others.
+    const bool is_rigid_rotor;
+
+    std::vector<int> rotor_index;
+
+    std::vector<std::unique_ptr<FEAElement>> rotor_elementv;
+
+    // Build the basis of the rotor elements with the reference coordinates
+    void Build_rotor_element( const FEType &in_type );
+
     // Private function
     // Essential boundary condition
     void EssBC_KG( const int &field );
@@ -177,6 +210,16 @@ class PGAssem_NS_FEM : public IPGAssem
 
     void BackFlow_KG( const double &dt, const PDNSolution * const &sol );
 
+    // Flow rates of dot_sol and sol on all outlets, and optionally the
+    // surface integrals of pressure and area, reduced over CPUs in one
+    // MPI_Allreduce. The output is ordered as num_ebc values of dot Q,
+    // num_ebc values of Q, then num_ebc pressure and area integrals.
+    void Assem_surface_outlet_integrals(
+        const PDNSolution * const &dot_sol,
+        const PDNSolution * const &sol,
+        const bool &is_pressure,
+        std::vector<double> &sum ) const;
+
     // Resistance type boundary condition on outlet surfaces
     void NatBC_Resis_G( const double &curr_time, const double &dt,
         const PDNSolution * const &dot_sol,
@@ -35,6 +35,8 @@ class PLocAssem_VMS_NS_GenAlpha : public IPLocAssem
 
     virtual int get_snLocBas() const {return snLocBas;}
 
+    virtual int get_nqpv() const {return nqpv;}
+
     virtual double get_model_para_1() const {return alpha_f;}
 
     virtual double get_model_para_2() const {return gamma;}
@@ -86,6 +88,37 @@ class PLocAssem_VMS_NS_GenAlpha : public IPLocAssem
         const double * const &eleCtrlPts_y,
         const double * const &eleCtrlPts_z );
 
+    // ------------------------------------------------------------------------
+    // ! Assembly for an element that moves rigidly. ref_elementv holds the
+    //   basis built with the reference coordinates eleCtrlPts and the volume
+    //   quadrature rule of this class. The rotation is recovered from the
+    //   displacement of the vertices, the velocities are pulled back to the
+    //   reference frame, and the outputs are rotated back, which gives the
+    //   same Tangent and Residual as the assembly with the current
+    //   coordinates without rebuilding the basis.
+    // ------------------------------------------------------------------------
+    virtual void Assem_Residual_Rigid(
+        const double &time, const double &dt,
+        const double * const &dot_sol,
+        const double * const &sol,
+        const double * const &mvelo,
+        const double * const &mdisp,
+        const FEAElement * const &ref_elementv,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z );
+
+    virtual void Assem_Tangent_Residual_Rigid(
+        const double &time, const double &dt,
+        const double * const &dot_sol,
+        const double * const &sol,
+        const double * const &mvelo,
+        const double * const &mdisp,
+        const FEAElement * const &ref_elementv,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z );
+
     virtual void Assem_Mass_Residual(
         const double * const &sol,
         const double * const &eleCtrlPts_x,
@@ -157,6 +190,40 @@ class PLocAssem_VMS_NS_GenAlpha : public IPLocAssem
     // Private functions
     virtual void print_info() const;
 
+    // Volume integrals with the basis in elem and the current coordinates
+    // curPt. The velocities and the outputs are given in the frame whose
+    // rotation from the current frame is frame^T, which is the identity
+    // unless the element moves rigidly.
+    void Residual_Integral( const FEAElement * const &elem,
+        const double &time, const double &dt,
+        const double * const &dot_sol,
+        const double * const &sol,
+        const double * const &mvelo,
+        const double * const &curPt_x,
+        const double * const &curPt_y,
+        const double * const &curPt_z,
+        const Tensor2_3D &frame );
+
+    void Tangent_Residual_Integral( const FEAElement * const &elem,
+        const double &time, const double &dt,
+        const double * const &dot_sol,
+        const double * const &sol,
+        const double * const &mvelo,
+        const double * const &curPt_x,
+        const double * const &curPt_y,
+        const double * const &curPt_z,
+        const Tensor2_3D &frame );
+
+    // Rotation of a rigidly moving element from the reference coordinates
+    // ref to the current coordinates cur, given by three edges of it
+    Tensor2_3D get_rigid_rotation( const double * const &ref_x,
+        const double * const &ref_y, const double * const &ref_z,
+        const double * const &cur_x, const double * const &cur_y,
+        const double * const &cur_z ) const;
+
+    // Rotate the momentum rows of Residual by rot
+    void Rotate_Residual( const Tensor2_3D &rot );
+
     virtual SymmTensor2_3D get_metric( const std::array<double, 9> &dxi_dx ) const;
 
     // Return tau_m and tau_c in RB-VMS
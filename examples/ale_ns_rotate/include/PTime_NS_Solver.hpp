@@ -84,68 +84,6 @@ class PTime_NS_Solver
     
     void Write_restart_file(const PDNTimeStep * const &timeinfo,
         const std::string &solname ) const;
-    
-    //This func may be written into the SI_tools?
-    Vector_3 get_radius(const Vector_3 &coor, const SI_rotation_info * const &rot_info) const 
-    { 
-      const Vector_3 direction_rotated = rot_info->get_direction_rotated();
-      
-      const Vector_3 point_rotated = rot_info->get_point_rotated();  
-
-      // The vector from the rotation point to the input point
-      const Vector_3 point_rotated_to_coor (coor.x() - point_rotated.x(), coor.y() - point_rotated.y(), coor.z() - point_rotated.z());
-
-      const double projectd_length = Vec3::dot_product(point_rotated_to_coor, direction_rotated);
-      
-      // The projection point of the input point on the rotation axis
-      const Vector_3 point_projected (point_rotated.x() +  projectd_length * direction_rotated.x(), point_rotated.y() +  projectd_length * direction_rotated.y(), point_rotated.z() +  projectd_length * direction_rotated.z());
-      
-      // The vector from the projection point to the input point
-      return Vector_3 (coor.x()- point_projected.x(), coor.y()- point_projected.y(), coor.z()- point_projected.z());
-    } 
-
-    // Get the current point coordinates for the case of rotation around any axis (i.e., unit rotation vector (a, b, c))
-    // Rodrigues's Formula, theta is the rotation angle
-    // [ cos(theta) + a*a(1-cos(theta)),    a*b(1-cos(theta)) - c*sin(theta), b*sin(theta) + a*c(1-cos(theta))  ]
-    // [ c*sin(theta) + a*b(1-cos(theta)),  cos(theta) + b*b(1-cos(theta)),   -a*sin(theta) + b*c(1-cos(theta)) ]
-    // [ -b*sin(theta) + a*c(1-cos(theta)), a*sin(theta) + b*c(1-cos(theta)), cos(theta) + c*c(1-cos(theta))    ]
-    Vector_3 get_currPts(const Vector_3 init_pt_xyz,
-        const double &tt,
-        const SI_rotation_info * const &rot_info) const
-    {      
-      const Vector_3 direction_rotated = rot_info->get_direction_rotated();
-      const Vector_3 point_rotated = rot_info->get_point_rotated(); 
-
-      const double aa = direction_rotated.x();
-      const double bb = direction_rotated.y();       
-      const double cc = direction_rotated.z();
-
-      const double theta = rot_info->get_rotated_theta(tt); 
-
-      const double m00 = std::cos(theta) + aa*aa*(1-std::cos(theta)); 
-      const double m01 = aa*bb*(1-std::cos(theta)) - cc*std::sin(theta);
-      const double m02 = bb*std::sin(theta) + aa*cc*(1-std::cos(theta));
-
-      const double m10 = cc*std::sin(theta) + aa*bb*(1-std::cos(theta));        
-      const double m11 = std::cos(theta) + bb*bb*(1-std::cos(theta)); 
-      const double m12 = -aa*std::sin(theta) + bb*cc*(1-std::cos(theta));         
-
-      const double m20 = -bb*std::sin(theta) + aa*cc*(1-std::cos(theta));
-      const double m21 = aa*std::sin(theta) + bb*cc*(1-std::cos(theta));
-      const double m22 = std::cos(theta) + cc*cc*(1-std::cos(theta));
-
-      const Tensor2_3D mat_rotation (m00, m01, m02, m10, m11, m12, m20, m21, m22);
-      
-      Vector_3 temp_pt_xyz = init_pt_xyz;    
-
-      temp_pt_xyz -= point_rotated;
-
-      Vector_3 curr_pt_xyz = mat_rotation.VecMult(temp_pt_xyz);
-
-      curr_pt_xyz += point_rotated;
-
-      return curr_pt_xyz;
-    }
 };
 
 #endif
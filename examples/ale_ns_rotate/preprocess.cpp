@@ -421,6 +421,13 @@ int main( int argc, char * argv[] )
   std::vector<std::vector<std::vector<int>>> distributed_rotated_node_loc_pos;
   distributed_rotated_node_loc_pos.resize(cpu_size);
 
+  // The interface nodes kept in each part
+  std::vector<std::vector<std::vector<int>>> distributed_fixed_itf_node;
+  distributed_fixed_itf_node.resize(cpu_size);
+
+  std::vector<std::vector<std::vector<int>>> distributed_rotated_itf_node;
+  distributed_rotated_itf_node.resize(cpu_size);
+
   std::vector<int> max_fixed_nlocalele (num_interface_pair, 0);
 
   std::vector<int> max_rotated_nlocalele(num_interface_pair, 0);
@@ -486,6 +493,9 @@ int main( int argc, char * argv[] )
     distributed_rotated_node_vol_part_tag[proc_rank] = itfpart -> get_rotated_node_vol_part_tag();
     distributed_rotated_node_loc_pos[proc_rank] = itfpart -> get_rotated_node_loc_pos();
 
+    distributed_fixed_itf_node[proc_rank] = itfpart -> get_fixed_itf_node();
+    distributed_rotated_itf_node[proc_rank] = itfpart -> get_rotated_itf_node();
+
     for(int ii = 0; ii < VEC_T::get_size(interfaces); ++ii)
     {
       if(max_fixed_nlocalele[ii] < itfpart -> get_fixed_nlocalele(ii))
@@ -576,13 +586,30 @@ int main( int argc, char * argv[] )
 
       hid_t group_id = H5Gopen(g_id, subgroup_name.c_str(), H5P_DEFAULT);
 
-      h5w -> write_intVector( group_id, "fixed_node_part_tag", fixed_node_vol_part_tag[ii] );
+      // Owners of the interface nodes kept in this part
+      const std::vector<int> &fixed_itf_node = distributed_fixed_itf_node[proc_rank][ii];
+      std::vector<int> part_fixed_tag( fixed_itf_node.size() ), part_fixed_pos( fixed_itf_node.size() );
+      for(int nn = 0; nn < VEC_T::get_size(fixed_itf_node); ++nn)
+      {
+        part_fixed_tag[nn] = fixed_node_vol_part_tag[ii][fixed_itf_node[nn]];
+        part_fixed_pos[nn] = fixed_node_loc_pos[ii][fixed_itf_node[nn]];
+      }
+
+      const std::vector<int> &rotated_itf_node = distributed_rotated_itf_node[proc_rank][ii];
+      std::vector<int> part_rotated_tag( rotated_itf_node.size() ), part_rotated_pos( rotated_itf_node.size() );
+      for(int nn = 0; nn < VEC_T::get_size(rotated_itf_node); ++nn)
+      {
+        part_rotated_tag[nn] = rotated_node_vol_part_tag[ii][rotated_itf_node[nn]];
+        part_rotated_pos[nn] = rotated_node_loc_pos[ii][rotated_itf_node[nn]];
+      }
+
+      h5w -> write_intVector( group_id, "fixed_node_part_tag", part_fixed_tag );
 
-      h5w -> write_intVector( group_id, "fixed_node_loc_pos", fixed_node_loc_pos[ii] );
+      h5w -> write_intVector( group_id, "fixed_node_loc_pos", part_fixed_pos );
 
-      h5w -> write_intVector( group_id, "rotated_node_part_tag", rotated_node_vol_part_tag[ii] );
+      h5w -> write_intVector( group_id, "rotated_node_part_tag", part_rotated_tag );
 
-      h5w -> write_intVector( group_id, "rotated_node_loc_pos", rotated_node_loc_pos[ii] );
+      h5w -> write_intVector( group_id, "rotated_node_loc_pos", part_rotated_pos );
 
       H5Gclose( group_id );
     }
@@ -15,7 +15,8 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
   std::unique_ptr<SI_T::SI_solution> in_SI_sol,
   std::unique_ptr<SI_T::SI_quad_point> in_SI_qp,
   const IGenBC * const &gbc,
-  const int &in_nz_estimate )
+  const int &in_nz_estimate,
+  const bool &in_is_rigid_rotor )
 : SI_sol( std::move(in_SI_sol) ),
   SI_qp( std::move(in_SI_qp) ),
   locien( std::move(in_locien) ),
@@ -37,7 +38,8 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
   opposite_elementv( ElementFactory::createVolElement(in_type, 1) ),
   quad_s( QuadPtsFactory::createSurQuadrature(in_type, in_nqps) ),
   free_quad( QuadPtsFactory::createFreeSurQuadrature(in_type) ),
-  time_step( 0.0 )
+  time_step( 0.0 ),
+  is_rigid_rotor( in_is_rigid_rotor )
 {
   // Make sure the data structure is compatible
   SYS_T::print_fatal_if(dof_sol != locassem->get_dof(),
@@ -65,7 +67,10 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
   VecSet(G, 0.0);
   VecSetOption(G, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
 
+  if( is_rigid_rotor ) Build_rotor_element( in_type );
+
   SI_qp->search_all_opposite_point(itf.get(), SI_sol.get());
+  SI_qp->set_comm_plan(itf.get(), SI_sol.get());
 
   SYS_T::commPrint("===> MAT_NEW_NONZERO_ALLOCATION_ERR = FALSE.\n");
   Release_nonzero_err_str();
@@ -89,6 +94,45 @@ PGAssem_NS_FEM::~PGAssem_NS_FEM()
   MatDestroy(&K);
 }
 
+void PGAssem_NS_FEM::Build_rotor_element( const FEType &in_type )
+{
+  const int nElem = locelem->get_nlocalele();
+  const int nqpv = locassem->get_nqpv();
+
+  const std::unique_ptr<const IQuadPts> quad_v = QuadPtsFactory::createVolQuadrature(in_type, nqpv);
+
+  int * IEN_e = new int [nLocBas];
+  double * ectrl_x = new double [nLocBas];
+  double * ectrl_y = new double [nLocBas];
+  double * ectrl_z = new double [nLocBas];
+
+  rotor_index.assign( nElem, -1 );
+  rotor_elementv.clear();
+
+  for(int ee=0; ee<nElem; ++ee)
+  {
+    if( locelem->get_elem_tag(ee) != 1 ) continue;
+
+    locien->get_LIEN(ee, IEN_e);
+    fnode->get_ctrlPts_xyz(nLocBas, IEN_e, ectrl_x, ectrl_y, ectrl_z);
+
+    rotor_index[ee] = static_cast<int>( rotor_elementv.size() );
+    rotor_elementv.push_back( ElementFactory::createVolElement(in_type, nqpv) );
+    rotor_elementv.back()->buildBasis( quad_v.get(), ectrl_x, ectrl_y, ectrl_z );
+  }
+
+  delete [] IEN_e; IEN_e = nullptr;
+  delete [] ectrl_x; ectrl_x = nullptr;
+  delete [] ectrl_y; ectrl_y = nullptr;
+  delete [] ectrl_z; ectrl_z = nullptr;
+
+  const int num_rotor = static_cast<int>( rotor_elementv.size() );
+  int tot_rotor = 0;
+  MPI_Allreduce(&num_rotor, &tot_rotor, 1, MPI_INT, MPI_SUM, PETSC_COMM_WORLD);
+
+  SYS_T::commPrint("===> Rigid rotor: the basis of %d rotor elements is built with the reference coordinates.\n", tot_rotor);
+}
+
 void PGAssem_NS_FEM::EssBC_KG( const int &field )
 {
   const int local_dir = nbc->get_Num_LD(field);
@@ -262,6 +306,8 @@ void PGAssem_NS_FEM::Assem_residual(
     const double &dt,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_G );
+
   const int nElem = locelem->get_nlocalele();
   const int loc_dof = dof_mat * nLocBas;
   
@@ -284,6 +330,8 @@ void PGAssem_NS_FEM::Assem_residual(
   mvelo->GetLocalArray( array_mvelo );
   mdisp->GetLocalArray( array_mdisp );
 
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
   for( int ee=0; ee<nElem; ++ee )
   {
     locien->get_LIEN(ee, IEN_e);
@@ -294,8 +342,12 @@ void PGAssem_NS_FEM::Assem_residual(
 
     fnode->get_ctrlPts_xyz(nLocBas, IEN_e, ectrl_x, ectrl_y, ectrl_z);
 
-    locassem->Assem_Residual(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
-      ectrl_x, ectrl_y, ectrl_z);
+    if( is_rigid_rotor && rotor_index[ee] >= 0 )
+      locassem->Assem_Residual_Rigid(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
+        rotor_elementv[ rotor_index[ee] ].get(), ectrl_x, ectrl_y, ectrl_z);
+    else
+      locassem->Assem_Residual(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
+        ectrl_x, ectrl_y, ectrl_z);
 
     for(int ii=0; ii<nLocBas; ++ii)
     {
@@ -306,6 +358,8 @@ void PGAssem_NS_FEM::Assem_residual(
     VecSetValues(G, loc_dof, row_index, locassem->Residual, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] array_a; array_a = nullptr;
   delete [] array_b; array_b = nullptr;
   delete [] local_a; local_a = nullptr;
@@ -356,6 +410,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
     const double &dt,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_KG );
+
   const int nElem = locelem->get_nlocalele();
   const int loc_dof = dof_mat * nLocBas;
   
@@ -378,6 +434,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
   mvelo->GetLocalArray( array_mvelo );
   mdisp->GetLocalArray( array_mdisp );
 
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
   for(int ee=0; ee<nElem; ++ee)
   {
     locien->get_LIEN(ee, IEN_e);
@@ -388,8 +446,12 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
 
     fnode->get_ctrlPts_xyz(nLocBas, IEN_e, ectrl_x, ectrl_y, ectrl_z);
 
-    locassem->Assem_Tangent_Residual(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
-      ectrl_x, ectrl_y, ectrl_z);
+    if( is_rigid_rotor && rotor_index[ee] >= 0 )
+      locassem->Assem_Tangent_Residual_Rigid(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
+        rotor_elementv[ rotor_index[ee] ].get(), ectrl_x, ectrl_y, ectrl_z);
+    else
+      locassem->Assem_Tangent_Residual(curr_time, dt, local_a, local_b, local_mvelo, local_mdisp,
+        ectrl_x, ectrl_y, ectrl_z);
 
     for(int ii=0; ii<nLocBas; ++ii)
     {
@@ -403,6 +465,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
     VecSetValues(G, loc_dof, row_index, locassem->Residual, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] array_a; array_a = nullptr;
   delete [] array_b; array_b = nullptr;
   delete [] local_a; local_a = nullptr;
@@ -446,6 +510,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
 
 void PGAssem_NS_FEM::NatBC_G( const double &curr_time, const double &dt )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_G );
+
   int * LSIEN = new int [snLocBas];
   double * sctrl_x = new double [snLocBas];
   double * sctrl_y = new double [snLocBas];
@@ -485,6 +551,8 @@ void PGAssem_NS_FEM::NatBC_G( const double &curr_time, const double &dt )
 void PGAssem_NS_FEM::BackFlow_G( 
     const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_G );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [dof_sol * snLocBas];
   int * LSIEN = new int [snLocBas];
@@ -532,6 +600,8 @@ void PGAssem_NS_FEM::BackFlow_G(
 void PGAssem_NS_FEM::BackFlow_KG( const double &dt,
     const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_KG );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [dof_sol * snLocBas];
   int * LSIEN = new int [snLocBas];
@@ -583,6 +653,8 @@ double PGAssem_NS_FEM::Assem_surface_flowrate(
     const PDNSolution * const &vec,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -629,6 +701,8 @@ double PGAssem_NS_FEM::Assem_surface_flowrate(
     const ALocal_InflowBC * const &infbc_part,
     const int &nbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -674,6 +748,8 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
     const PDNSolution * const &vec,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -728,6 +804,8 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
     const ALocal_InflowBC * const &infbc_part,
     const int &nbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -777,12 +855,173 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
   return sum_pres / sum_area;
 }
 
+void PGAssem_NS_FEM::Assem_surface_outlet_integrals(
+    const PDNSolution * const &dot_sol,
+    const PDNSolution * const &sol,
+    const bool &is_pressure,
+    std::vector<double> &sum ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
+  double * dot_array = new double [nlgn * dof_sol];
+  double * array = new double [nlgn * dof_sol];
+  double * dot_local = new double [snLocBas * dof_sol];
+  double * local = new double [snLocBas * dof_sol];
+  int * LSIEN = new int [snLocBas];
+  double * sctrl_x = new double [snLocBas];
+  double * sctrl_y = new double [snLocBas];
+  double * sctrl_z = new double [snLocBas];
+
+  dot_sol -> GetLocalArray( dot_array );
+  sol -> GetLocalArray( array );
+
+  // Layout: [dot Q | Q | int p | area], each with num_ebc slots
+  const int num_val = is_pressure ? 4 * num_ebc : 2 * num_ebc;
+
+  std::vector<double> esum( num_val, 0.0 );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    const int num_sele = ebc -> get_num_local_cell(ebc_id);
+
+    for(int ee=0; ee<num_sele; ++ee)
+    {
+      ebc -> get_SIEN( ebc_id, ee, LSIEN );
+
+      ebc -> get_ctrlPts_xyz(ebc_id, ee, sctrl_x, sctrl_y, sctrl_z);
+
+      GetLocal(dot_array, LSIEN, snLocBas, dot_local);
+      GetLocal(array, LSIEN, snLocBas, local);
+
+      esum[ebc_id]           += locassem -> get_flowrate( dot_local, sctrl_x, sctrl_y, sctrl_z );
+      esum[num_ebc + ebc_id] += locassem -> get_flowrate( local, sctrl_x, sctrl_y, sctrl_z );
+
+      if( is_pressure )
+      {
+        double ele_pres, ele_area;
+
+        locassem-> get_pressure_area( local, sctrl_x, sctrl_y,
+            sctrl_z, ele_pres, ele_area );
+
+        esum[2*num_ebc + ebc_id] += ele_pres;
+        esum[3*num_ebc + ebc_id] += ele_area;
+      }
+    }
+  }
+
+  delete [] dot_array; dot_array = nullptr;
+  delete [] array; array = nullptr;
+  delete [] dot_local; dot_local = nullptr;
+  delete [] local; local = nullptr;
+  delete [] LSIEN; LSIEN = nullptr;
+  delete [] sctrl_x; sctrl_x = nullptr;
+  delete [] sctrl_y; sctrl_y = nullptr;
+  delete [] sctrl_z; sctrl_z = nullptr;
+
+  sum.assign( num_val, 0.0 );
+
+  if( num_val > 0 )
+    MPI_Allreduce(&esum[0], &sum[0], num_val, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+}
+
+void PGAssem_NS_FEM::Assem_surface_outlet_data(
+    const PDNSolution * const &dot_sol,
+    const PDNSolution * const &sol,
+    std::vector<double> &dot_flrate,
+    std::vector<double> &flrate,
+    std::vector<double> &ave_pres ) const
+{
+  std::vector<double> sum;
+
+  Assem_surface_outlet_integrals( dot_sol, sol, true, sum );
+
+  dot_flrate.resize( num_ebc );
+  flrate.resize( num_ebc );
+  ave_pres.resize( num_ebc );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    dot_flrate[ebc_id] = sum[ebc_id];
+    flrate[ebc_id]     = sum[num_ebc + ebc_id];
+    ave_pres[ebc_id]   = sum[2*num_ebc + ebc_id] / sum[3*num_ebc + ebc_id];
+  }
+}
+
+void PGAssem_NS_FEM::Assem_surface_inlet_data(
+    const PDNSolution * const &sol,
+    const ALocal_InflowBC * const &infbc_part,
+    std::vector<double> &flrate,
+    std::vector<double> &ave_pres ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
+  const int num_nbc = infbc_part -> get_num_nbc();
+
+  double * array = new double [nlgn * dof_sol];
+  double * local = new double [snLocBas * dof_sol];
+  int * LSIEN = new int [snLocBas];
+  double * sctrl_x = new double [snLocBas];
+  double * sctrl_y = new double [snLocBas];
+  double * sctrl_z = new double [snLocBas];
+
+  sol -> GetLocalArray( array );
+
+  // Layout: [Q | int p | area], each with num_nbc slots
+  std::vector<double> esum( 3 * num_nbc, 0.0 );
+
+  for(int nbc_id = 0; nbc_id < num_nbc; ++nbc_id)
+  {
+    const int num_sele = infbc_part -> get_num_local_cell(nbc_id);
+
+    for(int ee=0; ee<num_sele; ++ee)
+    {
+      infbc_part -> get_SIEN( nbc_id, ee, LSIEN );
+
+      infbc_part -> get_ctrlPts_xyz( nbc_id, ee, sctrl_x, sctrl_y, sctrl_z);
+
+      GetLocal(array, LSIEN, snLocBas, local);
+
+      double ele_pres, ele_area;
+
+      locassem-> get_pressure_area( local, sctrl_x, sctrl_y,
+          sctrl_z, ele_pres, ele_area );
+
+      esum[nbc_id]             += locassem -> get_flowrate( local, sctrl_x, sctrl_y, sctrl_z );
+      esum[num_nbc + nbc_id]   += ele_pres;
+      esum[2*num_nbc + nbc_id] += ele_area;
+    }
+  }
+
+  delete [] array; array = nullptr;
+  delete [] local; local = nullptr;
+  delete [] LSIEN; LSIEN = nullptr;
+  delete [] sctrl_x; sctrl_x = nullptr;
+  delete [] sctrl_y; sctrl_y = nullptr;
+  delete [] sctrl_z; sctrl_z = nullptr;
+
+  std::vector<double> sum( 3 * num_nbc, 0.0 );
+
+  if( num_nbc > 0 )
+    MPI_Allreduce(&esum[0], &sum[0], 3 * num_nbc, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+
+  flrate.resize( num_nbc );
+  ave_pres.resize( num_nbc );
+
+  for(int nbc_id = 0; nbc_id < num_nbc; ++nbc_id)
+  {
+    flrate[nbc_id]   = sum[nbc_id];
+    ave_pres[nbc_id] = sum[num_nbc + nbc_id] / sum[2*num_nbc + nbc_id];
+  }
+}
+
 void PGAssem_NS_FEM::NatBC_Resis_G(
     const double &curr_time, const double &dt,
     const PDNSolution * const &dot_sol,
     const PDNSolution * const &sol,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_G );
+
   PetscScalar * Res = new PetscScalar [snLocBas * 3];
   PetscInt * srow_idx = new PetscInt [snLocBas * 3];
   int * LSIEN = new int [snLocBas];
@@ -790,17 +1029,21 @@ void PGAssem_NS_FEM::NatBC_Resis_G(
   double * sctrl_y = new double [snLocBas];
   double * sctrl_z = new double [snLocBas];
 
+  // Calculate the dot flow rate and flow rate of all faces from dot_sol
+  // and sol, which are reduced over CPUs together
+  std::vector<double> face_flrate;
+  Assem_surface_outlet_integrals( dot_sol, sol, false, face_flrate );
+
   for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
   {
-    // Calculate dot flow rate for face with ebc_id from solution vector dot_sol
-    const double dot_flrate = Assem_surface_flowrate( dot_sol, ebc_id ); 
-
-    // Calculate flow rate for face with ebc_id from solution vector sol
-    const double flrate = Assem_surface_flowrate( sol, ebc_id );
+    const double dot_flrate = face_flrate[ebc_id];
+    const double flrate     = face_flrate[num_ebc + ebc_id];
 
     // Get the (pressure) value on the outlet surface for traction evaluation    
+    SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
     const double P_n   = gbc -> get_P0( ebc_id );
     const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    SYS_T::Perf_End( SYS_T::PERF_GENBC );
 
     // P_n+alpha_f
     // locassem->get_model_para_1() gives alpha_f 
@@ -845,6 +1088,8 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
     const PDNSolution * const &sol,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_KG );
+
   const double a_f = locassem -> get_model_para_1();
 
   // dd_dv = dt x alpha_f x gamma
@@ -864,32 +1109,35 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
   double * sctrl_y = new double [snLocBas];
   double * sctrl_z = new double [snLocBas];
   
-  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
-  {
-    // Calculate dot flow rate for face with ebc_id and MPI_Allreduce them
-    // Here, dot_sol is the solution at time step n+1 (not n+alpha_f!)
-    const double dot_flrate = Assem_surface_flowrate( dot_sol, ebc_id ); 
+  // Calculate the dot flow rate and flow rate of all faces and reduce
+  // them over CPUs together. The values are shared by the evaluation of
+  // P, m, and n below.
+  // Here, dot_sol and sol are the solutions at time step n+1 (not n+alpha_f!)
+  std::vector<double> face_flrate;
+  Assem_surface_outlet_integrals( dot_sol, sol, false, face_flrate );
+
+  const std::vector<double> dot_flrate( face_flrate.begin(), face_flrate.begin() + num_ebc );
+  const std::vector<double> flrate( face_flrate.begin() + num_ebc, face_flrate.begin() + 2*num_ebc );
 
-    // Calculate flow rate for face with ebc_id and MPI_Allreduce them
-    // Here, sol is the solution at time step n+1 (not n+alpha_f!)
-    const double flrate = Assem_surface_flowrate( sol, ebc_id );
+  // Get P_n+1, m := dP/dQ, and n := dP/d(dot_Q) of all faces from the
+  // 0D model in one call
+  std::vector<double> P_np1, m_val, n_val;
 
+  SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
+  gbc -> get_P_m_n( dot_flrate, flrate, curr_time + dt, P_np1, m_val, n_val );
+  SYS_T::Perf_End( SYS_T::PERF_GENBC );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
     // Get the (pressure) value on the outlet surface for traction evaluation    
-    const double P_n   = gbc -> get_P0( ebc_id );
-    const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    const double P_n = gbc -> get_P0( ebc_id );
 
     // P_n+alpha_f 
-    const double resis_val = P_n + a_f * (P_np1 - P_n);
+    const double resis_val = P_n + a_f * (P_np1[ebc_id] - P_n);
 
-    // Get the (potentially approximated) m := dP/dQ
-    const double m_val = gbc -> get_m( ebc_id, dot_flrate, flrate );
-
-    // Get the (potentially approximated) n := dP/d(dot_Q)
-    const double n_val = gbc -> get_n( ebc_id, dot_flrate, flrate );
-    
     // Define alpha_f * n + alpha_f * gamma * dt * m
     // coef a^t a enters as the consistent tangent for the resistance-type bc
-    const double coef = a_f * n_val + dd_dv * m_val;
+    const double coef = a_f * n_val[ebc_id] + dd_dv * m_val[ebc_id];
 
     const int num_face_nodes = ebc -> get_num_face_nodes(ebc_id);
     if(num_face_nodes > 0)
@@ -977,6 +1225,8 @@ void PGAssem_NS_FEM::Weak_EssBC_KG(
     const PDNSolution * const &mvelo,
     const PDNSolution * const &mdisp)
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_WEAK_ESSBC_KG );
+
   const int loc_dof {dof_mat * nLocBas};
   double * array_b = new double [nlgn * dof_sol];
   double * array_mvelo = new double [nlgn * 3];
@@ -1043,6 +1293,8 @@ void PGAssem_NS_FEM::Weak_EssBC_G(
     const PDNSolution * const &mvelo,
     const PDNSolution * const &mdisp)
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_WEAK_ESSBC_G );
+
   const int loc_dof {dof_mat * nLocBas};
   double * array_b = new double [nlgn * dof_sol];
   double * array_mvelo = new double [nlgn * 3];
@@ -1104,6 +1356,8 @@ void PGAssem_NS_FEM::Weak_EssBC_G(
 void PGAssem_NS_FEM::Interface_KG(
   const double &dt )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_INTERFACE_KG );
+
   time_step = dt;
   const int loc_dof {dof_mat * nLocBas};
   double * ctrl_x = new double [nLocBas];
@@ -1277,6 +1531,8 @@ void PGAssem_NS_FEM::Interface_KG(
 void PGAssem_NS_FEM::Interface_G(
   const double &dt )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_INTERFACE_KG );
+
   time_step = dt;
   const int loc_dof {dof_mat * nLocBas};
   double * ctrl_x = new double [nLocBas];
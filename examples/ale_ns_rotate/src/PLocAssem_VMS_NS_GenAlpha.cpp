@@ -139,6 +139,20 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
 
   elementv->buildBasis( quadv.get(), &curPt_x[0], &curPt_y[0], &curPt_z[0] );
 
+  Residual_Integral( elementv.get(), time, dt, dot_sol, sol, mvelo, &curPt_x[0], &curPt_y[0], &curPt_z[0], Tensor2_3D() );
+}
+
+void PLocAssem_VMS_NS_GenAlpha::Residual_Integral(
+    const FEAElement * const &elem,
+    const double &time, const double &dt,
+    const double * const &dot_sol,
+    const double * const &sol,
+    const double * const &mvelo,
+    const double * const &curPt_x,
+    const double * const &curPt_y,
+    const double * const &curPt_z,
+    const Tensor2_3D &frame )
+{
   const double two_mu = 2.0 * vis_mu;
 
   const double curr = time + alpha_f * dt;
@@ -161,7 +175,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
 
     Vector_3 coor(0.0, 0.0, 0.0);
 
-    elementv->get_3D_R_gradR_LaplacianR( qua, &R[0], &dR_dx[0], 
+    elem->get_3D_R_gradR_LaplacianR( qua, &R[0], &dR_dx[0], 
         &dR_dy[0], &dR_dz[0], &d2R_dxx[0], &d2R_dyy[0], &d2R_dzz[0] );
 
     for(int ii=0; ii<nLocBas; ++ii)
@@ -220,7 +234,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
     const double cw = w - mw;
 
     // Get the tau_m and tau_c
-    const auto dxi_dx = elementv->get_invJacobian(qua);
+    const auto dxi_dx = elem->get_invJacobian(qua);
 
     const std::array<double, 2> tau = get_tau( dt, dxi_dx, cu, cv, cw );
     const double tau_m = tau[0];
@@ -228,10 +242,10 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
 
     const double tau_m_2 = tau_m * tau_m;
 
-    const double gwts = elementv->get_detJac(qua) * quadv->get_qw(qua);
+    const double gwts = elem->get_detJac(qua) * quadv->get_qw(qua);
 
     // Get the body force
-    const Vector_3 f_body = get_f( coor, curr );
+    const Vector_3 f_body = frame.VecMultT( get_f( coor, curr ) );
 
     const double u_lap = u_xx + u_yy + u_zz;
     const double v_lap = v_xx + v_yy + v_zz;
@@ -324,6 +338,20 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
   elementv->buildBasis( quadv.get(), &curPt_x[0], &curPt_y[0], &curPt_z[0] );
 
+  Tangent_Residual_Integral( elementv.get(), time, dt, dot_sol, sol, mvelo, &curPt_x[0], &curPt_y[0], &curPt_z[0], Tensor2_3D() );
+}
+
+void PLocAssem_VMS_NS_GenAlpha::Tangent_Residual_Integral(
+    const FEAElement * const &elem,
+    const double &time, const double &dt,
+    const double * const &dot_sol,
+    const double * const &sol,
+    const double * const &mvelo,
+    const double * const &curPt_x,
+    const double * const &curPt_y,
+    const double * const &curPt_z,
+    const Tensor2_3D &frame )
+{
   const double two_mu = 2.0 * vis_mu;
 
   const double rho0_2 = rho0 * rho0;
@@ -350,7 +378,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
     Vector_3 coor(0.0, 0.0, 0.0);
 
-    elementv->get_3D_R_gradR_LaplacianR( qua, &R[0], &dR_dx[0], 
+    elem->get_3D_R_gradR_LaplacianR( qua, &R[0], &dR_dx[0], 
         &dR_dy[0], &dR_dz[0], &d2R_dxx[0], &d2R_dyy[0], &d2R_dzz[0] );
 
     for(int ii=0; ii<nLocBas; ++ii)
@@ -408,7 +436,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
     const double cv = v - mv;
     const double cw = w - mw;
 
-    const auto dxi_dx = elementv->get_invJacobian(qua);
+    const auto dxi_dx = elem->get_invJacobian(qua);
 
     const std::array<double, 2> tau = get_tau( dt, dxi_dx, cu, cv, cw );
     const double tau_m = tau[0];
@@ -416,9 +444,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
     const double tau_m_2 = tau_m * tau_m;
 
-    const double gwts = elementv->get_detJac(qua) * quadv->get_qw(qua); 
+    const double gwts = elem->get_detJac(qua) * quadv->get_qw(qua); 
 
-    const Vector_3 f_body = get_f( coor, curr );
+    const Vector_3 f_body = frame.VecMultT( get_f( coor, curr ) );
 
     const double u_lap = u_xx + u_yy + u_zz;
     const double v_lap = v_xx + v_yy + v_zz;
@@ -687,6 +715,150 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
   // ----------------------------------------------------------------
 }
 
+void PLocAssem_VMS_NS_GenAlpha::Assem_Residual_Rigid(
+    const double &time, const double &dt,
+    const double * const &dot_sol,
+    const double * const &sol,
+    const double * const &mvelo,
+    const double * const &mdisp,
+    const FEAElement * const &ref_elementv,
+    const double * const &eleCtrlPts_x,
+    const double * const &eleCtrlPts_y,
+    const double * const &eleCtrlPts_z )
+{
+  std::vector<double> curPt_x(nLocBas, 0.0), curPt_y(nLocBas, 0.0), curPt_z(nLocBas, 0.0);
+
+  get_currPts(eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z, mdisp, nLocBas, &curPt_x[0], &curPt_y[0], &curPt_z[0]);
+
+  const Tensor2_3D rot = get_rigid_rotation( eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z,
+      &curPt_x[0], &curPt_y[0], &curPt_z[0] );
+
+  // The velocities in the reference frame
+  std::vector<double> ref_dot_sol( dot_sol, dot_sol + vec_size ), ref_sol( sol, sol + vec_size );
+  std::vector<double> ref_mvelo( mvelo, mvelo + 3 * nLocBas );
+
+  for(int A=0; A<nLocBas; ++A)
+  {
+    rot.VecMultT( dot_sol[4*A+1], dot_sol[4*A+2], dot_sol[4*A+3],
+        ref_dot_sol[4*A+1], ref_dot_sol[4*A+2], ref_dot_sol[4*A+3] );
+
+    rot.VecMultT( sol[4*A+1], sol[4*A+2], sol[4*A+3],
+        ref_sol[4*A+1], ref_sol[4*A+2], ref_sol[4*A+3] );
+
+    rot.VecMultT( mvelo[3*A], mvelo[3*A+1], mvelo[3*A+2],
+        ref_mvelo[3*A], ref_mvelo[3*A+1], ref_mvelo[3*A+2] );
+  }
+
+  Residual_Integral( ref_elementv, time, dt, &ref_dot_sol[0], &ref_sol[0], &ref_mvelo[0],
+      &curPt_x[0], &curPt_y[0], &curPt_z[0], rot );
+
+  Rotate_Residual( rot );
+}
+
+void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual_Rigid(
+    const double &time, const double &dt,
+    const double * const &dot_sol,
+    const double * const &sol,
+    const double * const &mvelo,
+    const double * const &mdisp,
+    const FEAElement * const &ref_elementv,
+    const double * const &eleCtrlPts_x,
+    const double * const &eleCtrlPts_y,
+    const double * const &eleCtrlPts_z )
+{
+  std::vector<double> curPt_x(nLocBas, 0.0), curPt_y(nLocBas, 0.0), curPt_z(nLocBas, 0.0);
+
+  get_currPts(eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z, mdisp, nLocBas, &curPt_x[0], &curPt_y[0], &curPt_z[0]);
+
+  const Tensor2_3D rot = get_rigid_rotation( eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z,
+      &curPt_x[0], &curPt_y[0], &curPt_z[0] );
+
+  // The velocities in the reference frame
+  std::vector<double> ref_dot_sol( dot_sol, dot_sol + vec_size ), ref_sol( sol, sol + vec_size );
+  std::vector<double> ref_mvelo( mvelo, mvelo + 3 * nLocBas );
+
+  for(int A=0; A<nLocBas; ++A)
+  {
+    rot.VecMultT( dot_sol[4*A+1], dot_sol[4*A+2], dot_sol[4*A+3],
+        ref_dot_sol[4*A+1], ref_dot_sol[4*A+2], ref_dot_sol[4*A+3] );
+
+    rot.VecMultT( sol[4*A+1], sol[4*A+2], sol[4*A+3],
+        ref_sol[4*A+1], ref_sol[4*A+2], ref_sol[4*A+3] );
+
+    rot.VecMultT( mvelo[3*A], mvelo[3*A+1], mvelo[3*A+2],
+        ref_mvelo[3*A], ref_mvelo[3*A+1], ref_mvelo[3*A+2] );
+  }
+
+  Tangent_Residual_Integral( ref_elementv, time, dt, &ref_dot_sol[0], &ref_sol[0], &ref_mvelo[0],
+      &curPt_x[0], &curPt_y[0], &curPt_z[0], rot );
+
+  Rotate_Residual( rot );
+
+  // Tangent <- T Tangent T^T for each 4 x 4 block, T = diag(1, rot)
+  for(int A=0; A<nLocBas; ++A)
+  {
+    for(int B=0; B<nLocBas; ++B)
+    {
+      double blk[16];
+      for(int ii=0; ii<4; ++ii)
+        for(int jj=0; jj<4; ++jj)
+          blk[4*ii+jj] = Tangent[4*nLocBas*(4*A+ii) + 4*B + jj];
+
+      double tmp[16];
+      for(int jj=0; jj<4; ++jj)
+      {
+        tmp[jj] = blk[jj];
+        rot.VecMult( blk[4+jj], blk[8+jj], blk[12+jj], tmp[4+jj], tmp[8+jj], tmp[12+jj] );
+      }
+
+      for(int ii=0; ii<4; ++ii)
+      {
+        Tangent[4*nLocBas*(4*A+ii) + 4*B] = tmp[4*ii];
+        rot.VecMult( tmp[4*ii+1], tmp[4*ii+2], tmp[4*ii+3],
+            Tangent[4*nLocBas*(4*A+ii) + 4*B + 1],
+            Tangent[4*nLocBas*(4*A+ii) + 4*B + 2],
+            Tangent[4*nLocBas*(4*A+ii) + 4*B + 3] );
+      }
+    }
+  }
+}
+
+Tensor2_3D PLocAssem_VMS_NS_GenAlpha::get_rigid_rotation(
+    const double * const &ref_x, const double * const &ref_y, const double * const &ref_z,
+    const double * const &cur_x, const double * const &cur_y, const double * const &cur_z ) const
+{
+  // Three edges from the first vertex that span the element: the vertices
+  // 1, 2, 3 of a tetrahedron, and 1, 3, 4 of a hexahedron
+  const int v1 = 1;
+  const int v2 = (elemType == FEType::Hex8 || elemType == FEType::Hex27) ? 3 : 2;
+  const int v3 = (elemType == FEType::Hex8 || elemType == FEType::Hex27) ? 4 : 3;
+
+  Tensor2_3D ref_edge( ref_x[v1] - ref_x[0], ref_x[v2] - ref_x[0], ref_x[v3] - ref_x[0],
+      ref_y[v1] - ref_y[0], ref_y[v2] - ref_y[0], ref_y[v3] - ref_y[0],
+      ref_z[v1] - ref_z[0], ref_z[v2] - ref_z[0], ref_z[v3] - ref_z[0] );
+
+  const Tensor2_3D cur_edge( cur_x[v1] - cur_x[0], cur_x[v2] - cur_x[0], cur_x[v3] - cur_x[0],
+      cur_y[v1] - cur_y[0], cur_y[v2] - cur_y[0], cur_y[v3] - cur_y[0],
+      cur_z[v1] - cur_z[0], cur_z[v2] - cur_z[0], cur_z[v3] - cur_z[0] );
+
+  // rot maps the reference edges to the current edges
+  ref_edge.inverse();
+
+  Tensor2_3D rot;
+  rot.MatMult( cur_edge, ref_edge );
+
+  return rot;
+}
+
+void PLocAssem_VMS_NS_GenAlpha::Rotate_Residual( const Tensor2_3D &rot )
+{
+  for(int A=0; A<nLocBas; ++A)
+  {
+    const double rx = Residual[4*A+1], ry = Residual[4*A+2], rz = Residual[4*A+3];
+    rot.VecMult( rx, ry, rz, Residual[4*A+1], Residual[4*A+2], Residual[4*A+3] );
+  }
+}
+
 void PLocAssem_VMS_NS_GenAlpha::Assem_Mass_Residual(
     const double * const &sol,
     const double * const &eleCtrlPts_x,
@@ -55,19 +55,6 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     bool &conv_flag, int &nl_counter,
     Mat &shell ) const
 {
-#ifdef PETSC_USE_LOG
-  PetscLogEvent mat_assem_0_event, mat_assem_1_event;
-  PetscLogEvent vec_assem_0_event, vec_assem_1_event;
-  PetscLogEvent lin_solve_event;
-  PetscClassId classid_assembly;
-  PetscClassIdRegister("mat_vec_assembly", &classid_assembly);
-  PetscLogEventRegister("assembly mat 0", classid_assembly, &mat_assem_0_event);
-  PetscLogEventRegister("assembly mat 1", classid_assembly, &mat_assem_1_event);
-  PetscLogEventRegister("assembly vec 0", classid_assembly, &vec_assem_0_event);
-  PetscLogEventRegister("assembly vec 1", classid_assembly, &vec_assem_1_event);
-  PetscLogEventRegister("lin_solve", classid_assembly, &lin_solve_event);
-#endif
-
   // Initialize the counter and error
   nl_counter = 0;
   double residual_norm = 0.0, initial_norm = 0.0, relative_error = 0.0;
@@ -122,16 +109,9 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   {
     gassem_ptr->Clear_KG();
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(mat_assem_0_event, 0,0,0,0);
-#endif
-
     gassem_ptr->Assem_tangent_residual( &dot_sol_alpha, &sol_alpha, mvelo_alpha, mdisp_alpha, dot_sol, sol, 
         curr_time, dt, gbc );
    
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(mat_assem_0_event,0,0,0,0);
-#endif
 
     SYS_T::commPrint("  --- M updated");
     
@@ -143,16 +123,9 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   {
     gassem_ptr->Clear_G();
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(vec_assem_0_event, 0,0,0,0);
-#endif
-
     gassem_ptr->Assem_residual( &dot_sol_alpha, &sol_alpha, mvelo_alpha, mdisp_alpha, dot_sol, sol,
         curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(vec_assem_0_event,0,0,0,0);
-#endif
   }
 
   VecNorm(gassem_ptr->G, NORM_2, &initial_norm);
@@ -163,17 +136,10 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   // Now do consistent Newton-Raphson iteration
   do
   {
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(lin_solve_event, 0,0,0,0);
-#endif
     
     // solve the equation K dot_step = G
     lsolver->Solve( gassem_ptr->G, dot_step.get() );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(lin_solve_event,0,0,0,0);
-#endif
-
     bc_mat->MatMultSol( dot_step.get() );
 
     nl_counter += 1;
@@ -191,17 +157,9 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     {
       gassem_ptr->Clear_KG();
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventBegin(mat_assem_1_event, 0,0,0,0);
-#endif
-
       gassem_ptr->Assem_tangent_residual( &dot_sol_alpha, &sol_alpha, mvelo_alpha, mdisp_alpha, dot_sol, sol,
           curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventEnd(mat_assem_1_event,0,0,0,0);
-#endif
-
       SYS_T::commPrint("  --- M updated");
       lsolver->SetOperator(shell, gassem_ptr->K);
     }
@@ -209,16 +167,9 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     {
       gassem_ptr->Clear_G();
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventBegin(vec_assem_1_event, 0,0,0,0);
-#endif
-
       gassem_ptr->Assem_residual( &dot_sol_alpha, &sol_alpha, mvelo_alpha, mdisp_alpha, dot_sol, sol,
           curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventEnd(vec_assem_1_event,0,0,0,0);
-#endif
     }
 
     VecNorm(gassem_ptr->G, NORM_2, &residual_norm);
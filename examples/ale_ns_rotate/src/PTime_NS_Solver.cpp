@@ -100,28 +100,47 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
     VecGetArray(lvelo_alp_mesh, &array_alp_velo_mesh);
     VecGetArray(ldisp_alp_mesh, &array_alp_disp_mesh);
 
+    // The rotation and the angular velocity at t_n+1 and t_n+alpha_f
+    const double curr_time  = time_info->get_time() + time_info->get_step();
+    const double alpha_time = time_info->get_time() + alpha_f * time_info->get_step();
+
+    const Tensor2_3D rot_curr  = rot_info->get_rotation_matrix( curr_time );
+    const Tensor2_3D rot_alpha = rot_info->get_rotation_matrix( alpha_time );
+
+    const Vector_3 point_rotated = rot_info->get_point_rotated();
+    const Vector_3 direction_rotated = rot_info->get_direction_rotated();
+
+    const Vector_3 omega_curr  = rot_info->get_angular_velo( curr_time ) * direction_rotated;
+    const Vector_3 omega_alpha = rot_info->get_angular_velo( alpha_time ) * direction_rotated;
+
     for( int ii=0; ii<pNode_ptr->get_nlocalnode_rotated(); ++ii )
     { 
-      // Update the coordinates of the rotated nodes
+      // The vector from the rotation axis to the initial point, which is
+      // rotated into the current radius
       const Vector_3 init_pt_xyz = feanode_ptr->get_ctrlPts_xyz(pNode_ptr->get_node_loc_rotated(ii));
-      const Vector_3 curr_pt_xyz = get_currPts(init_pt_xyz, time_info->get_time() + time_info->get_step(), rot_info.get()); //get_currPts() may be writtern into Sl_tools
-      const Vector_3 alpha_pt_xyz = get_currPts(init_pt_xyz, time_info->get_time() + alpha_f * time_info->get_step(), rot_info.get());
 
-      const Vector_3 radius_alpha = get_radius(alpha_pt_xyz, rot_info.get()); 
-      const Vector_3 velo_mesh_alpha = Vec3::cross_product(rot_info->get_angular_velo(time_info->get_time() + alpha_f * time_info->get_step())*rot_info->get_direction_rotated(), radius_alpha);
+      Vector_3 init_radius = init_pt_xyz;
+      init_radius -= point_rotated;
+
+      const Vector_3 init_axial = Vec3::dot_product(init_radius, direction_rotated) * direction_rotated;
 
-      const Vector_3 radius_curr = get_radius(curr_pt_xyz, rot_info.get()); //get_radius() may be writtern into Sl_tools  
-      const Vector_3 velo_mesh_curr = Vec3::cross_product(rot_info->get_angular_velo(time_info->get_time() + time_info->get_step())*rot_info->get_direction_rotated(), radius_curr);
+      init_radius -= init_axial;
+
+      const Vector_3 radius_curr  = rot_curr.VecMult( init_radius );
+      const Vector_3 radius_alpha = rot_alpha.VecMult( init_radius );
+
+      const Vector_3 velo_mesh_curr  = Vec3::cross_product( omega_curr, radius_curr );
+      const Vector_3 velo_mesh_alpha = Vec3::cross_product( omega_alpha, radius_alpha );
 
       const int offset = pNode_ptr->get_node_loc_rotated(ii) * 3;   
 
       for(int jj=0; jj<3; ++jj)
       {
         array_cur_velo_mesh[offset + jj] = velo_mesh_curr(jj);
-        array_cur_disp_mesh[offset + jj] = curr_pt_xyz(jj)-init_pt_xyz(jj);  
+        array_cur_disp_mesh[offset + jj] = radius_curr(jj) - init_radius(jj);
 
         array_alp_velo_mesh[offset + jj] = velo_mesh_alpha(jj);
-        array_alp_disp_mesh[offset + jj] = alpha_pt_xyz(jj)-init_pt_xyz(jj);  
+        array_alp_disp_mesh[offset + jj] = radius_alpha(jj) - init_radius(jj);
       }
     }
 
@@ -182,20 +201,19 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
       cur_velo_mesh->WriteBinary(sol_mvelo_name);
     }
 
-    // Calculate the flow rate & averaged pressure on all outlets
+    // Calculate the 3D dot flow rate, flow rate & averaged pressure on
+    // all outlets with one reduction over CPUs
+    std::vector<double> outlet_dot_flrate, outlet_flrate, outlet_avepre;
+    gassem_ptr -> Assem_surface_outlet_data( cur_dot_sol.get(), cur_sol.get(),
+        outlet_dot_flrate, outlet_flrate, outlet_avepre );
+
     for(int face=0; face<gbc -> get_num_ebc(); ++face)
     {
-      // Calculate the 3D dot flow rate on the outlet
-      const double dot_face_flrate = gassem_ptr -> Assem_surface_flowrate( 
-          cur_dot_sol.get(), face); 
+      const double dot_face_flrate = outlet_dot_flrate[face];
 
-      // Calculate the 3D flow rate on the outlet
-      const double face_flrate = gassem_ptr -> Assem_surface_flowrate( 
-          cur_sol.get(), face); 
+      const double face_flrate = outlet_flrate[face];
 
-      // Calculate the 3D averaged pressure on the outlet
-      const double face_avepre = gassem_ptr -> Assem_surface_ave_pressure( 
-          cur_sol.get(), face);
+      const double face_avepre = outlet_avepre[face];
 
       // Calculate the 0D pressure from LPN model
       const double dot_lpn_flowrate = dot_face_flrate;
@@ -216,17 +234,18 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
         ofile<<time_info->get_index()<<'\t'<<time_info->get_time()<<'\t'<<dot_face_flrate<<'\t'<<face_flrate<<'\t'<<face_avepre<<'\t'<<lpn_pressure<<'\n';
         ofile.close();
       }
-      MPI_Barrier(PETSC_COMM_WORLD);
     }
    
-    // Calcualte the inlet data
+    // Calcualte the inlet data with one reduction over CPUs
+    std::vector<double> inlet_flrate, inlet_avepre;
+    gassem_ptr -> Assem_surface_inlet_data( cur_sol.get(), infnbc_part.get(),
+        inlet_flrate, inlet_avepre );
+
     for(int face=0; face<infnbc_part -> get_num_nbc(); ++face)
     {
-      const double inlet_face_flrate = gassem_ptr -> Assem_surface_flowrate(
-          cur_sol.get(), infnbc_part.get(), face ); 
+      const double inlet_face_flrate = inlet_flrate[face];
 
-      const double inlet_face_avepre = gassem_ptr -> Assem_surface_ave_pressure(
-          cur_sol.get(), infnbc_part.get(), face );
+      const double inlet_face_avepre = inlet_avepre[face];
 
       if( SYS_T::get_MPI_rank() == 0 )
       {
@@ -235,9 +254,11 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
         ofile<<time_info->get_index()<<'\t'<<time_info->get_time()<<'\t'<<inlet_face_flrate<<'\t'<<inlet_face_avepre<<'\n';
         ofile.close();
       } 
-      MPI_Barrier(PETSC_COMM_WORLD);
     }
 
+    // Write the timing of this step into the performance trace
+    SYS_T::Perf_Registry::instance().Record_step( time_info->get_index() );
+
     // Prepare for next time step
     pre_sol->Copy(*cur_sol);
     pre_dot_sol->Copy(*cur_dot_sol);
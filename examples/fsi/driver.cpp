@@ -73,12 +73,17 @@ int main(int argc, char *argv[])
   int nl_refreq    = 4;
   int nl_threshold = 4;
 
+  // Solve the mesh motion once per time step instead of in every Newton
+  // iteration
+  bool is_mesh_per_step = false;
+
   // Time stepping parameters
   double initial_time = 0.0;
   double initial_step = 0.1;
   int initial_index = 0;
   double final_time = 1.0;
   std::string sol_bName("SOL_");
+  std::string perf_trace_file("");
   int ttan_renew_freq = 1;
   int sol_record_freq = 1;
 
@@ -142,6 +147,7 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt(   "-nl_maxits",         nl_maxits);
   SYS_T::GetOptionInt(   "-nl_refreq",         nl_refreq);
   SYS_T::GetOptionInt(   "-nl_rethred",        nl_threshold);
+  SYS_T::GetOptionBool(  "-is_mesh_per_step",  is_mesh_per_step);
   SYS_T::GetOptionReal(  "-init_time",         initial_time);
   SYS_T::GetOptionReal(  "-fina_time",         final_time);
   SYS_T::GetOptionReal(  "-init_step",         initial_step);
@@ -149,6 +155,7 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt(   "-ttan_freq",         ttan_renew_freq);
   SYS_T::GetOptionInt(   "-sol_rec_freq",      sol_record_freq);
   SYS_T::GetOptionString("-sol_name",          sol_bName);
+  SYS_T::GetOptionString("-perf_trace_file",   perf_trace_file);
   SYS_T::GetOptionBool(  "-is_restart",        is_restart);
   SYS_T::GetOptionInt(   "-restart_index",     restart_index);
   SYS_T::GetOptionReal(  "-restart_time",      restart_time);
@@ -188,6 +195,12 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-nl_maxits:", nl_maxits);
   SYS_T::cmdPrint("-nl_refreq:", nl_refreq);
   SYS_T::cmdPrint("-nl_rethred", nl_threshold);
+
+  if( is_mesh_per_step )
+    SYS_T::commPrint(     "-is_mesh_per_step: true \n");
+  else
+    SYS_T::commPrint(     "-is_mesh_per_step: false \n");
+
   SYS_T::cmdPrint("-init_time:", initial_time);
   SYS_T::cmdPrint("-init_step:", initial_step);
   SYS_T::cmdPrint("-init_index:", initial_index);
@@ -195,6 +208,8 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-ttan_freq:", ttan_renew_freq);
   SYS_T::cmdPrint("-sol_rec_freq:", sol_record_freq);
   SYS_T::cmdPrint("-sol_name:", sol_bName);
+  if( !perf_trace_file.empty() )
+    SYS_T::cmdPrint("-perf_trace_file:", perf_trace_file);
   if(is_restart)
   {
     SYS_T::commPrint("-is_restart: true \n");
@@ -375,6 +390,11 @@ int main(int argc, char *argv[])
 
   // The harmonic extension algorithm & Pseudo elastic mesh motion
   std::unique_ptr<IPLocAssem> locAssem_mesh = SYS_T::make_unique<PLocAssem_FSI_Mesh_Laplacian>( ANL_T::get_elemType(part_v_file, rank), nqp_vol, nqp_sur );
+
+  // The harmonic extension operator is independent of the mesh displacement,
+  // so it is assembled once; the pseudo elastic one is reassembled per step
+  const bool is_mesh_fixed_operator =
+    dynamic_cast<const PLocAssem_FSI_Mesh_Laplacian *>( locAssem_mesh.get() ) != nullptr;
   
   // ===== Initial condition =====
   std::unique_ptr<PDNSolution> base =
@@ -474,7 +494,7 @@ int main(int argc, char *argv[])
   std::unique_ptr<IPGAssem> gloAssem_mesh = SYS_T::make_unique<PGAssem_Mesh>(
       std::move(locIEN_mesh), std::move(locElem_mesh), std::move(fNode_mesh), 
       std::move(pNode_mesh), std::move(mesh_locnbc), std::move(mesh_locebc), 
-      std::move(locAssem_mesh), nz_estimate );
+      std::move(locAssem_mesh), nz_estimate, is_mesh_fixed_operator );
 
   SYS_T::commPrint("===> Assembly nonzero estimate for K_mesh ... \n");
   gloAssem_mesh->Assem_nonzero_estimate();
@@ -552,7 +572,7 @@ int main(int argc, char *argv[])
       std::move(gloAssem_mesh), std::move(lsolver), std::move(mesh_lsolver), 
       std::move(pmat), std::move(mmat), std::move(tm_galpha), std::move(inflow_rate), 
       std::move(base), std::move(pNode_v_nlinear), nl_rtol, nl_atol, nl_dtol, 
-      nl_maxits, nl_refreq, nl_threshold );
+      nl_maxits, nl_refreq, nl_threshold, is_mesh_per_step );
   SYS_T::commPrint("===> Nonlinear solver setted up:\n");
   nsolver->print_info();
 
@@ -574,6 +594,8 @@ int main(int argc, char *argv[])
   tsolver->record_inlet_data( disp.get(), velo.get(), pres.get(), timeinfo.get(), locinfnbc.get(), 
       gloAssem.get(), true, is_restart );
 
+  SYS_T::Perf_Registry::instance().set_trace_file( perf_trace_file );
+
   // ===== FEM analysis =====
 #ifdef PETSC_USE_LOG
   PetscLogEvent tsolver_event;
@@ -601,6 +623,8 @@ int main(int argc, char *argv[])
   tsolver -> print_lsolver_info();
   tsolver -> print_lsolver_mesh_info();
 
+  SYS_T::Perf_Registry::instance().print_summary();
+
   // ===== PETSc Finalize =====
   ISDestroy(&is_velo); ISDestroy(&is_pres);
   tsolver.reset(); locinfnbc.reset(); gbc.reset(); gloAssem.reset();
@@ -5,6 +5,10 @@
 // 
 // Parallel global assembly for FSI problems using the unified continuum
 // formulation and segregated algorithm.
+//
+// The fluid and solid elements are assembled in two separate loops over
+// the element ranges of ALocal_Elem, which are contiguous for partitions
+// sorted by tag, and timed by the events assem_fluid and assem_solid.
 // 
 // Author: Ju Liu
 // Date: Jan 2 2022
@@ -115,6 +119,16 @@ class PGAssem_FSI : public IPGAssem
 
     const int nLocBas, snLocBas, num_ebc, nlgn_v, nlgn_p;
 
+    // Number of the local fluid (tag 0) and solid (tag 1) elements. The
+    // volume assembly runs one loop over each range, so that the local
+    // assembly of one material is called for consecutive elements.
+    const int nElem_f, nElem_s;
+
+    // Equation indices of the velocity and pressure rows of an element
+    void Get_row_id( const std::vector<int> &IEN_v,
+        const std::vector<int> &IEN_p, PetscInt * const &row_id_v,
+        PetscInt * const &row_id_p ) const;
+
     void EssBC_KG();
 
     void EssBC_G();
@@ -5,6 +5,14 @@
 //
 // Parallel Global Assembly for Mesh motion equations.
 //
+// The mesh motion equations are linear in the displacement. The residual
+// can thus be evaluated by Assem_residual_linear as K_disp disp + G0, where
+// K_disp is the element stiffness assembled with the columns of all nodes,
+// including the Dirichlet ones, and G0 is the residual at zero displacement.
+// G0 is reassembled once per time step. K_disp is reassembled once per time
+// step as well, unless is_fixed_operator is true, which is the case when the
+// element stiffness does not depend on sol_a, e.g. the harmonic extension.
+//
 // Author: Ju Liu
 // Date: Dec. 30 2021
 // ============================================================================
@@ -25,7 +33,8 @@ class PGAssem_Mesh : public IPGAssem
         std::unique_ptr<ALocal_NBC> in_mesh_nbc,
         std::unique_ptr<ALocal_EBC> in_mesh_ebc,
         std::unique_ptr<IPLocAssem> in_locassem,
-        const int &in_nz_estimate );
+        const int &in_nz_estimate,
+        const bool &in_is_fixed_operator = false );
 
     virtual ~PGAssem_Mesh();
 
@@ -40,6 +49,12 @@ class PGAssem_Mesh : public IPGAssem
         const double &curr_time,
         const double &dt );
 
+    virtual void Assem_residual_linear(
+        const PDNSolution * const &sol_a,
+        const PDNSolution * const &sol_b,
+        const double &curr_time,
+        const double &dt );
+
     virtual void Assem_tangent_residual(
         const PDNSolution * const &sol_a,
         const PDNSolution * const &sol_b,
@@ -55,8 +70,20 @@ class PGAssem_Mesh : public IPGAssem
     const std::unique_ptr<const ALocal_EBC> mesh_ebc;
     const std::unique_ptr<IPLocAssem> locassem;
 
-    const int nLocBas, snLocBas, dof, num_ebc, nlgn;
-    
+    const int nLocBas, snLocBas, dof, num_ebc, nlgn, nz_estimate;
+
+    const bool is_fixed_operator;
+
+    // Cached operator and residual at zero displacement of
+    // Assem_residual_linear, with the time G0 is assembled at
+    Mat K_disp;
+    Vec G0;
+    bool is_K_disp_ready, is_G0_ready;
+    double G0_time;
+
+    void Assem_K_disp( const PDNSolution * const &sol_a,
+        const double &curr_time, const double &dt );
+
     void EssBC_KG();
 
     void EssBC_G();
@@ -56,7 +56,12 @@ class PGAssem_Wall_Prestress : public IPGAssem
         const PDNSolution * const &velo,
         const PDNSolution * const &pres );
 
-    virtual void Update_Wall_Prestress(
+    // ------------------------------------------------------------------------
+    // ! Add the wall Cauchy stress of disp and pres to the prestress, and
+    //   return the l_inf norm of this increment relative to the l_inf norm of
+    //   the accumulated prestress. Collective.
+    // ------------------------------------------------------------------------
+    virtual double Update_Wall_Prestress(
         const PDNSolution * const &disp,
         const PDNSolution * const &pres ) const;
 
@@ -128,6 +128,17 @@ class PLocAssem_2x2Block_VMS_Hyperelasticity : public IPLocAssem_2x2Block
     // useful tensors for the material model
     const std::unique_ptr<MaterialModel_Mixed_Elasticity> matmodel;
 
+    // Deformation gradients, stresses, and elasticity tensors at the volume
+    // quadrature points of an element, evaluated in one call
+    std::vector<Tensor2_3D> F_qua, P_qua;
+    std::vector<SymmTensor2_3D> S_qua;
+    std::vector<SymmTensor4_3D> CC_qua;
+
+    // BB[18*A + 6*ii + jj] is the jj-th Voigt component of the variation of
+    // the Green-Lagrange strain for the ii-th displacement of node A, and DB
+    // is its product with the elasticity tensor. Size is 18 x nLocBas
+    std::vector<double> BB, DB;
+
     void print_info() const;
 
     std::array<double, 2> get_tau( const double &dt, const double &Jin, const double &dx ) const;
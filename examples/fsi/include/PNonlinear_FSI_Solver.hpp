@@ -32,7 +32,8 @@ class PNonlinear_FSI_Solver
         const double &input_nrtol, const double &input_natol, 
         const double &input_ndtol, const int &input_max_iteration, 
         const int &input_renew_freq, 
-        const int &input_renew_threshold );
+        const int &input_renew_threshold,
+        const bool &input_mesh_per_step = false );
 
     PNonlinear_FSI_Solver(
         std::unique_ptr<IPGAssem> in_gassem_prestress,
@@ -88,6 +89,7 @@ class PNonlinear_FSI_Solver
     void GenAlpha_Seg_solve_Prestress(
         const bool &new_tangent_flag,
         const double &prestress_tol,
+        const double &prestress_incr_tol,
         const double &curr_time,
         const double &dt,
         const IS &is_v,
@@ -110,6 +112,11 @@ class PNonlinear_FSI_Solver
     const double nr_tol, na_tol, nd_tol;
     const int nmaxits, nrenew_freq, nrenew_threshold;
 
+    // If true, the mesh motion is solved in the first Newton iteration of
+    // each time step only, and the fluid mesh lags behind the solid in the
+    // later iterations.
+    const bool is_mesh_per_step;
+
     const std::unique_ptr<IPGAssem> gassem_mesh;
     const std::unique_ptr<IPGAssem> gassem_prestress;
     const std::unique_ptr<PLinear_Solver_PETSc> lsolver;
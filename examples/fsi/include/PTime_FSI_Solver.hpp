@@ -92,6 +92,7 @@ class PTime_FSI_Solver
     void TM_FSI_Prestress(
         const bool &is_record_sol_flag,
         const double &prestress_tol,
+        const double &prestress_incr_tol,
         const IS &is_v,
         const IS &is_p,
         std::unique_ptr<PDNSolution> init_dot_disp,
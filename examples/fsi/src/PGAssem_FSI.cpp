@@ -33,8 +33,13 @@ PGAssem_FSI::PGAssem_FSI(
   snLocBas( locassem_f->get_snLocBas_0() ),
   num_ebc( ebc_v->get_num_ebc() ),
   nlgn_v( pnode_v -> get_nlocghonode() ),
-  nlgn_p( pnode_p -> get_nlocghonode() )
+  nlgn_p( pnode_p -> get_nlocghonode() ),
+  nElem_f( locelem -> get_nlocalele(0) ),
+  nElem_s( locelem -> get_nlocalele(1) )
 {
+  SYS_T::print_fatal_if( nElem_f + nElem_s != locelem->get_nlocalele(),
+      "Error: PGAssem_FSI the element tag should be 0 (fluid) or 1 (solid).\n");
+
   SYS_T::print_fatal_if( nLocBas != locassem_s->get_nLocBas_0(),
       "Error: PGAssem_FSI::nLocBas does not match that in local assembly of solid.\n");
 
@@ -114,46 +119,42 @@ PGAssem_FSI::~PGAssem_FSI()
 void PGAssem_FSI::Assem_nonzero_estimate(
     const IGenBC * const &gbc )
 {
-  const int nElem = locelem->get_nlocalele();
-
   locassem_f->Assem_Estimate();
   locassem_s->Assem_Estimate();
 
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
-  
-  for(int ee=0; ee<nElem; ++ee)
+
+  // Fluid elements
+  for(int ii=0; ii<nElem_f; ++ii)
   {
-    for(int ii=0; ii<nLocBas; ++ii)
-    {  
-      row_id_v[3*ii  ] = nbc_v -> get_LID( 0, locien_v -> get_LIEN(ee, ii) );
-      row_id_v[3*ii+1] = nbc_v -> get_LID( 1, locien_v -> get_LIEN(ee, ii) );
-      row_id_v[3*ii+2] = nbc_v -> get_LID( 2, locien_v -> get_LIEN(ee, ii) );
-    }
+    const int ee = locelem->get_elem_of_tag(0, ii);
 
-    for(int ii=0; ii<nLocBas; ++ii)
-      row_id_p[ii] = nbc_p -> get_LID( locien_p -> get_LIEN(ee,ii) );
+    Get_row_id( locien_v->get_LIEN(ee), locien_p->get_LIEN(ee), row_id_v, row_id_p );
 
-    if( locelem->get_elem_tag(ee) == 0 )
-    {
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_f->Tangent01, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_f->Tangent01, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_f->Tangent10, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_f->Tangent10, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
-    }
-    else
-    {
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
+  }
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+  // Solid elements
+  for(int ii=0; ii<nElem_s; ++ii)
+  {
+    const int ee = locelem->get_elem_of_tag(1, ii);
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+    Get_row_id( locien_v->get_LIEN(ee), locien_p->get_LIEN(ee), row_id_v, row_id_p );
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
-    }
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
   }
 
   delete [] row_id_v; row_id_v = nullptr; delete [] row_id_p; row_id_p = nullptr;
@@ -178,8 +179,6 @@ void PGAssem_FSI::Assem_mass_residual(
     const PDNSolution * const &velo,
     const PDNSolution * const &pres )
 {
-  const int nElem = locelem->get_nlocalele();
-
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_v = velo -> GetLocalArray();
   const std::vector<double> array_p = pres -> GetLocalArray();
@@ -191,54 +190,60 @@ void PGAssem_FSI::Assem_mass_residual(
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  // Fluid elements
+  for(int ii=0; ii<nElem_f; ++ii)
   {
+    const int ee = locelem->get_elem_of_tag(0, ii);
+
     const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
     const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
     fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
 
-    for(int ii=0; ii<nLocBas; ++ii)
-    {  
-      row_id_v[3*ii  ] = nbc_v -> get_LID(0, IEN_v[ii]);
-      row_id_v[3*ii+1] = nbc_v -> get_LID(1, IEN_v[ii]);
-      row_id_v[3*ii+2] = nbc_v -> get_LID(2, IEN_v[ii]);
-    }
-
-    for(int ii=0; ii<nLocBas; ++ii) 
-      row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
 
     const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 ); 
     const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
     const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
 
-    if( locelem->get_elem_tag(ee) == 0 )
-    {
-      locassem_f->Assem_Mass_Residual(&local_d[0], &local_v[0], &local_p[0],
-          ectrl_x, ectrl_y, ectrl_z);
+    locassem_f->Assem_Mass_Residual(&local_d[0], &local_v[0], &local_p[0],
+        ectrl_x, ectrl_y, ectrl_z);
 
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
-    }
-    else
-    {
-      // For solid element, quaprestress will return a vector of length nqp x 6
-      // for the prestress values at the quadrature points
-      const std::vector<double> quaprestress = ps->get_prestress( ee );
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
+  }
+
+  // Solid elements
+  for(int ii=0; ii<nElem_s; ++ii)
+  {
+    const int ee = locelem->get_elem_of_tag(1, ii);
+
+    const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
+    const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
+
+    fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
+
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
+
+    const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 ); 
+    const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
 
-      locassem_s->Assem_Mass_Residual(&local_d[0], &local_v[0], &local_p[0], 
-          ectrl_x, ectrl_y, ectrl_z, &quaprestress[0]);
+    // For solid element, quaprestress points to the nqp x 6 prestress values
+    // at the quadrature points
+    const double * const quaprestress = ps->get_prestress( ee );
 
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+    locassem_s->Assem_Mass_Residual(&local_d[0], &local_v[0], &local_p[0], 
+        ectrl_x, ectrl_y, ectrl_z, quaprestress);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
-    } 
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
 
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
   }
 
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
@@ -267,7 +272,7 @@ void PGAssem_FSI::Assem_Residual(
     const PDNSolution * const &disp_np1,
     const IGenBC * const &gbc )
 {
-  const int nElem = locelem->get_nlocalele();
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_G );
 
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_dot_v = dot_velo -> GetLocalArray();
@@ -284,8 +289,15 @@ void PGAssem_FSI::Assem_Residual(
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
+  // Fluid elements
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_FLUID );
+
+  for(int ii=0; ii<nElem_f; ++ii)
   {
+    const int ee = locelem->get_elem_of_tag(0, ii);
+
     const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
     const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
@@ -299,38 +311,54 @@ void PGAssem_FSI::Assem_Residual(
     const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
     const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
 
-    for(int ii=0; ii<nLocBas; ++ii)
-    {  
-      row_id_v[3*ii  ] = nbc_v -> get_LID(0, IEN_v[ii]);
-      row_id_v[3*ii+1] = nbc_v -> get_LID(1, IEN_v[ii]);
-      row_id_v[3*ii+2] = nbc_v -> get_LID(2, IEN_v[ii]);
-    }
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
 
-    for(int ii=0; ii<nLocBas; ++ii)
-      row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
+    locassem_f -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
+        &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z );
 
-    if( locelem->get_elem_tag(ee) == 0 )
-    {
-      locassem_f -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
-          &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z );
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_f->Residual1, ADD_VALUES);
+  }
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_f->Residual1, ADD_VALUES);
-    }
-    else
-    {
-      // For solid element, quaprestress will return a vector of length nqp x 6
-      // for the prestress values at the quadrature points
-      const std::vector<double> quaprestress = ps->get_prestress( ee );
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_FLUID );
 
-      locassem_s -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
-          &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z, &quaprestress[0] );
+  // Solid elements
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_SOLID );
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
-    }
+  for(int ii=0; ii<nElem_s; ++ii)
+  {
+    const int ee = locelem->get_elem_of_tag(1, ii);
+
+    const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
+    const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
+
+    fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
+
+    const std::vector<double> local_dot_d = GetLocal( array_dot_d, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_dot_v = GetLocal( array_dot_v, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_dot_p = GetLocal( array_dot_p, IEN_p, nLocBas, 1 );
+
+    const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 ); 
+    const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
+
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
+
+    // For solid element, quaprestress points to the nqp x 6 prestress values
+    // at the quadrature points
+    const double * const quaprestress = ps->get_prestress( ee );
+
+    locassem_s -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
+        &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z, quaprestress );
+
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_SOLID );
+
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
   ectrl_x = nullptr; ectrl_y = nullptr; ectrl_z = nullptr;
   delete [] row_id_v; delete [] row_id_p;
@@ -362,7 +390,7 @@ void PGAssem_FSI::Assem_Tangent_Residual(
     const PDNSolution * const &disp_np1,
     const IGenBC * const &gbc )
 {
-  const int nElem = locelem->get_nlocalele();
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_KG );
 
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_dot_v = dot_velo -> GetLocalArray();
@@ -379,8 +407,15 @@ void PGAssem_FSI::Assem_Tangent_Residual(
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
+  // Fluid elements
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_FLUID );
+
+  for(int ii=0; ii<nElem_f; ++ii)
   {
+    const int ee = locelem->get_elem_of_tag(0, ii);
+
     const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
     const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
@@ -394,54 +429,70 @@ void PGAssem_FSI::Assem_Tangent_Residual(
     const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
     const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
 
-    for(int ii=0; ii<nLocBas; ++ii)
-    {
-      row_id_v[3*ii  ] = nbc_v -> get_LID(0, IEN_v[ii]);
-      row_id_v[3*ii+1] = nbc_v -> get_LID(1, IEN_v[ii]);
-      row_id_v[3*ii+2] = nbc_v -> get_LID(2, IEN_v[ii]);
-    }
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
 
-    for(int ii=0; ii<nLocBas; ++ii)
-      row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
+    locassem_f -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
+        &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z );
 
-    if( locelem->get_elem_tag(ee) == 0 )
-    {
-      locassem_f -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
-          &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z );
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
 
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_f->Tangent00, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_f->Tangent01, ADD_VALUES);
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_f->Tangent01, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_f->Tangent10, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_f->Tangent10, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_f->Tangent11, ADD_VALUES);
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_f->Residual1, ADD_VALUES);
+  }
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_f->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_f->Residual1, ADD_VALUES);
-    }
-    else
-    {
-      // For solid element, quaprestress will return a vector of length nqp x 6
-      // for the prestress values at the quadrature points
-      const std::vector<double> quaprestress = ps->get_prestress( ee );
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_FLUID );
 
-      locassem_s -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
-          &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z, &quaprestress[0] );
+  // Solid elements
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_SOLID );
 
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+  for(int ii=0; ii<nElem_s; ++ii)
+  {
+    const int ee = locelem->get_elem_of_tag(1, ii);
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+    const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
+    const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+    fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
+    const std::vector<double> local_dot_d = GetLocal( array_dot_d, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_dot_v = GetLocal( array_dot_v, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_dot_p = GetLocal( array_dot_p, IEN_p, nLocBas, 1 );
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
-    }
+    const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_v = GetLocal( array_v, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
+
+    Get_row_id( IEN_v, IEN_p, row_id_v, row_id_p );
+
+    // For solid element, quaprestress points to the nqp x 6 prestress values
+    // at the quadrature points
+    const double * const quaprestress = ps->get_prestress( ee );
+
+    locassem_s -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], &local_dot_p[0],
+        &local_d[0], &local_v[0], &local_p[0], ectrl_x, ectrl_y, ectrl_z, quaprestress );
+
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
+
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_SOLID );
+
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
   ectrl_x = nullptr; ectrl_y = nullptr; ectrl_z = nullptr;
   delete [] row_id_v; delete [] row_id_p;
@@ -462,6 +513,21 @@ void PGAssem_FSI::Assem_Tangent_Residual(
   VecAssemblyBegin(G); VecAssemblyEnd(G);
 }
 
+void PGAssem_FSI::Get_row_id( const std::vector<int> &IEN_v,
+    const std::vector<int> &IEN_p, PetscInt * const &row_id_v,
+    PetscInt * const &row_id_p ) const
+{
+  for(int ii=0; ii<nLocBas; ++ii)
+  {
+    row_id_v[3*ii  ] = nbc_v -> get_LID(0, IEN_v[ii]);
+    row_id_v[3*ii+1] = nbc_v -> get_LID(1, IEN_v[ii]);
+    row_id_v[3*ii+2] = nbc_v -> get_LID(2, IEN_v[ii]);
+  }
+
+  for(int ii=0; ii<nLocBas; ++ii)
+    row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
+}
+
 void PGAssem_FSI::EssBC_KG()
 {
   // For three velocity fields
@@ -572,6 +638,8 @@ double PGAssem_FSI::Assem_surface_flowrate(
     const PDNSolution * const &velo,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_v = velo -> GetLocalArray();
 
@@ -612,6 +680,8 @@ double PGAssem_FSI::Assem_surface_flowrate(
     const ALocal_InflowBC * const &infbc_part,
     const int &nbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_v = velo -> GetLocalArray();
 
@@ -651,6 +721,8 @@ double PGAssem_FSI::Assem_surface_ave_pressure(
     const PDNSolution * const &pres,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_p = pres -> GetLocalArray();
 
@@ -699,6 +771,8 @@ double PGAssem_FSI::Assem_surface_ave_pressure(
     const ALocal_InflowBC * const &infbc_part,
     const int &nbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_p = pres -> GetLocalArray();
 
@@ -742,6 +816,8 @@ double PGAssem_FSI::Assem_surface_ave_pressure(
 void PGAssem_FSI::NatBC_G( const double &curr_time, const double &dt,
     const PDNSolution * const &disp )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_G );
+
   const std::vector<double> array_d = disp -> GetLocalArray(); 
 
   double * sctrl_x = new double [snLocBas];
@@ -786,6 +862,8 @@ void PGAssem_FSI::NatBC_Resis_G( const double &curr_time, const double &dt,
     const PDNSolution * const &velo,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_G );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
 
   double * sctrl_x = new double [snLocBas];
@@ -803,8 +881,10 @@ void PGAssem_FSI::NatBC_Resis_G( const double &curr_time, const double &dt,
     const double flrate = Assem_surface_flowrate( disp, velo, ebc_id );
 
     // Get the pressure value on the outlet surfaces
+    SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
     const double P_n   = gbc -> get_P0( ebc_id );
     const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    SYS_T::Perf_End( SYS_T::PERF_GENBC );
 
     // P_n+alpha_f
     const double val = P_n + locassem_f->get_model_para_1() * (P_np1 - P_n);
@@ -843,6 +923,8 @@ void PGAssem_FSI::NatBC_Resis_KG( const double &curr_time, const double &dt,
     const PDNSolution * const &velo,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_KG );
+
   PetscScalar * Tan;
   PetscInt * scol_idx;
   Vector_3 out_n;
@@ -873,8 +955,10 @@ void PGAssem_FSI::NatBC_Resis_KG( const double &curr_time, const double &dt,
     const double flrate = Assem_surface_flowrate( disp, velo, ebc_id );
 
     // Get the pressure value on the outlet surfaces
+    SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
     const double P_n   = gbc -> get_P0( ebc_id );
     const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    SYS_T::Perf_End( SYS_T::PERF_GENBC );
 
     // P_n+alpha_f
     const double resis_val = P_n + a_f * (P_np1 - P_n);
@@ -970,6 +1054,8 @@ void PGAssem_FSI::BackFlow_G(
     const PDNSolution * const &disp,
     const PDNSolution * const &velo )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_G );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_v = velo -> GetLocalArray();
@@ -1018,6 +1104,8 @@ void PGAssem_FSI::BackFlow_KG( const double &dt,
     const PDNSolution * const &disp,
     const PDNSolution * const &velo )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_KG );
+
   const std::vector<double> array_d = disp -> GetLocalArray();
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_v = velo -> GetLocalArray();
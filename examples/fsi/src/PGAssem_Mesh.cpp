@@ -8,7 +8,8 @@ PGAssem_Mesh::PGAssem_Mesh(
     std::unique_ptr<ALocal_NBC> in_mesh_nbc,
     std::unique_ptr<ALocal_EBC> in_mesh_ebc,
     std::unique_ptr<IPLocAssem> in_locassem,
-    const int &in_nz_estimate )
+    const int &in_nz_estimate,
+    const bool &in_is_fixed_operator )
 : locien( std::move(in_locien_v) ),
   locelem( std::move(in_locelem) ),
   fnode( std::move(in_fnode) ),
@@ -20,7 +21,10 @@ PGAssem_Mesh::PGAssem_Mesh(
   snLocBas( locassem->get_snLocBas() ),
   dof(3),
   num_ebc( mesh_ebc->get_num_ebc() ),
-  nlgn( pnode -> get_nlocghonode() )
+  nlgn( pnode -> get_nlocghonode() ),
+  nz_estimate( in_nz_estimate ),
+  is_fixed_operator( in_is_fixed_operator ),
+  is_K_disp_ready( false ), is_G0_ready( false ), G0_time( 0.0 )
 {
   SYS_T::print_fatal_if(num_ebc != locassem->get_num_ebc_fun(), "Error: The number of ebc does not match with the number of functions implemented in the local assembly routine. \n");
   
@@ -60,6 +64,9 @@ PGAssem_Mesh::~PGAssem_Mesh()
 {
   VecDestroy(&G);
   MatDestroy(&K);
+
+  if( is_K_disp_ready ) MatDestroy(&K_disp);
+  if( is_G0_ready ) VecDestroy(&G0);
 }
 
 void PGAssem_Mesh::Assem_nonzero_estimate()
@@ -193,6 +200,105 @@ void PGAssem_Mesh::Assem_residual(
   VecAssemblyEnd(G);
 }
 
+void PGAssem_Mesh::Assem_residual_linear(
+    const PDNSolution * const &sol_a,
+    const PDNSolution * const &sol_b,
+    const double &curr_time,
+    const double &dt )
+{
+  // K_disp and G0 are kept within a time step, and they are reassembled
+  // in a new time step, in which sol_a and the data of the BCs change.
+  const bool is_new_step = !is_G0_ready || curr_time != G0_time;
+
+  if( !is_K_disp_ready || ( is_new_step && !is_fixed_operator ) )
+    Assem_K_disp( sol_a, curr_time, dt );
+
+  if( is_new_step )
+  {
+    PDNSolution zero( pnode.get(), dof );
+    VecSet(zero.solution, 0.0);
+    zero.GhostUpdate();
+
+    Vec G_save = G;
+    if( !is_G0_ready ) VecDuplicate(G, &G0);
+    G = G0;
+
+    Clear_G();
+    Assem_residual( sol_a, &zero, curr_time, dt );
+
+    G = G_save;
+
+    is_G0_ready = true;
+    G0_time = curr_time;
+  }
+
+  // G = K_disp sol_b + G0
+  MatMultAdd(K_disp, sol_b->solution, G0, G);
+}
+
+void PGAssem_Mesh::Assem_K_disp( const PDNSolution * const &sol_a,
+    const double &curr_time, const double &dt )
+{
+  const int nElem = locelem->get_nlocalele();
+  const int loc_dof = dof * nLocBas;
+
+  if( is_K_disp_ready ) MatZeroEntries(K_disp);
+  else
+  {
+    const int nlocrow = dof * pnode->get_nlocalnode();
+
+    // The rows are the ones of K, and the columns are the global indices of
+    // all nodes, so that the Dirichlet values enter through sol_b
+    MatCreateAIJ(PETSC_COMM_WORLD, nlocrow, nlocrow, PETSC_DETERMINE,
+        PETSC_DETERMINE, dof*nz_estimate, NULL, dof*nz_estimate, NULL, &K_disp);
+    MatSetOption(K_disp, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+
+    is_K_disp_ready = true;
+  }
+
+  double * ectrl_x = new double [nLocBas];
+  double * ectrl_y = new double [nLocBas];
+  double * ectrl_z = new double [nLocBas];
+  PetscInt * row_index = new PetscInt [nLocBas * dof];
+  PetscInt * col_index = new PetscInt [nLocBas * dof];
+
+  const std::vector<double> array_a = sol_a->GetLocalArray();
+
+  for( int ee=0; ee<nElem; ++ee )
+  {
+    const std::vector<int> IEN_e = locien -> get_LIEN(ee);
+    const std::vector<double> local_a = GetLocal(array_a, IEN_e, nLocBas);
+
+    fnode->get_ctrlPts_xyz(nLocBas, &IEN_e[0], ectrl_x, ectrl_y, ectrl_z);
+
+    // The element stiffness does not depend on the second solution
+    locassem->Assem_Tangent_Residual( curr_time, dt, &local_a[0], &local_a[0],
+        ectrl_x, ectrl_y, ectrl_z );
+
+    for(int ii=0; ii<nLocBas; ++ii)
+    {
+      const int gid = pnode -> get_local_to_global( IEN_e[ii] );
+      for(int mm=0; mm<dof; ++mm)
+      {
+        row_index[dof*ii+mm] = mesh_nbc -> get_LID(mm, IEN_e[ii]);
+        col_index[dof*ii+mm] = dof * gid + mm;
+      }
+    }
+
+    MatSetValues(K_disp, loc_dof, row_index, loc_dof, col_index,
+        locassem->Tangent, ADD_VALUES);
+  }
+
+  delete [] ectrl_x; ectrl_x = nullptr;
+  delete [] ectrl_y; ectrl_y = nullptr;
+  delete [] ectrl_z; ectrl_z = nullptr;
+  delete [] row_index; row_index = nullptr;
+  delete [] col_index; col_index = nullptr;
+
+  MatAssemblyBegin(K_disp, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(K_disp, MAT_FINAL_ASSEMBLY);
+}
+
 void PGAssem_Mesh::Assem_tangent_residual(
     const PDNSolution * const &sol_a,
     const PDNSolution * const &sol_b,
@@ -88,15 +88,17 @@ PGAssem_Wall_Prestress::~PGAssem_Wall_Prestress()
 
 void PGAssem_Wall_Prestress::Assem_nonzero_estimate()
 {
-  const int nElem = locelem->get_nlocalele();
+  const int nElem_s = locelem->get_nlocalele(1);
 
   locassem_s->Assem_Estimate();
 
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  for(int ss=0; ss<nElem_s; ++ss)
   {
+    const int ee = locelem->get_elem_of_tag(1, ss);
+
     for(int ii=0; ii<nLocBas; ++ii)
     {
       row_id_v[3*ii  ] = nbc_v -> get_LID( 0, locien_v -> get_LIEN(ee, ii) );
@@ -107,16 +109,13 @@ void PGAssem_Wall_Prestress::Assem_nonzero_estimate()
     for(int ii=0; ii<nLocBas; ++ii)
       row_id_p[ii] = nbc_p -> get_LID( locien_p -> get_LIEN(ee,ii) );
 
-    if( locelem->get_elem_tag(ee) == 1 )
-    {
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
-    }
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
   }
 
   delete [] row_id_v; row_id_v = nullptr; delete [] row_id_p; row_id_p = nullptr;
@@ -285,7 +284,7 @@ void PGAssem_Wall_Prestress::Assem_Residual(
     const PDNSolution * const &velo,
     const PDNSolution * const &pres )
 {
-  const int nElem = locelem->get_nlocalele();
+  const int nElem_s = locelem->get_nlocalele(1);
 
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_dot_v = dot_velo -> GetLocalArray();
@@ -302,8 +301,10 @@ void PGAssem_Wall_Prestress::Assem_Residual(
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  for(int ss=0; ss<nElem_s; ++ss)
   {
+    const int ee = locelem->get_elem_of_tag(1, ss);
+
     const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
     const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
@@ -327,17 +328,14 @@ void PGAssem_Wall_Prestress::Assem_Residual(
     for(int ii=0; ii<nLocBas; ++ii)
       row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
 
-    if( locelem->get_elem_tag(ee) == 1 )
-    {
-      const std::vector<double> quaprestress = ps->get_prestress( ee );
+    const double * const quaprestress = ps->get_prestress( ee );
 
-      locassem_s -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], 
-          &local_dot_p[0], &local_d[0], &local_v[0], &local_p[0], 
-          ectrl_x, ectrl_y, ectrl_z, &quaprestress[0] );
+    locassem_s -> Assem_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0], 
+        &local_dot_p[0], &local_d[0], &local_v[0], &local_p[0], 
+        ectrl_x, ectrl_y, ectrl_z, quaprestress );
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
-    }
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
   }
 
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
@@ -364,7 +362,7 @@ void PGAssem_Wall_Prestress::Assem_Tangent_Residual(
     const PDNSolution * const &velo,
     const PDNSolution * const &pres )
 {
-  const int nElem = locelem->get_nlocalele();
+  const int nElem_s = locelem->get_nlocalele(1);
 
   const std::vector<double> array_dot_d = dot_disp -> GetLocalArray();
   const std::vector<double> array_dot_v = dot_velo -> GetLocalArray();
@@ -381,8 +379,10 @@ void PGAssem_Wall_Prestress::Assem_Tangent_Residual(
   PetscInt * row_id_v = new PetscInt [3*nLocBas];
   PetscInt * row_id_p = new PetscInt [nLocBas];
 
-  for(int ee=0; ee<nElem; ++ee)
+  for(int ss=0; ss<nElem_s; ++ss)
   {
+    const int ee = locelem->get_elem_of_tag(1, ss);
+
     const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
     const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
 
@@ -407,25 +407,22 @@ void PGAssem_Wall_Prestress::Assem_Tangent_Residual(
       row_id_p[ii] = nbc_p -> get_LID( IEN_p[ii] );
 
 
-    if( locelem->get_elem_tag(ee) == 1 )
-    {
-      const std::vector<double> quaprestress = ps->get_prestress( ee );
+    const double * const quaprestress = ps->get_prestress( ee );
 
-      locassem_s -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0],
-          &local_dot_p[0], &local_d[0], &local_v[0], &local_p[0],
-          ectrl_x, ectrl_y, ectrl_z, &quaprestress[0] );
+    locassem_s -> Assem_Tangent_Residual( curr_time, dt, &local_dot_d[0], &local_dot_v[0],
+        &local_dot_p[0], &local_d[0], &local_v[0], &local_p[0],
+        ectrl_x, ectrl_y, ectrl_z, quaprestress );
 
-      MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v, 3*nLocBas, row_id_v, locassem_s->Tangent00, ADD_VALUES);
 
-      MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
+    MatSetValues(K, 3*nLocBas, row_id_v,   nLocBas, row_id_p, locassem_s->Tangent01, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p, 3*nLocBas, row_id_v, locassem_s->Tangent10, ADD_VALUES);
 
-      MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
+    MatSetValues(K,   nLocBas, row_id_p,   nLocBas, row_id_p, locassem_s->Tangent11, ADD_VALUES);
 
-      VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
-      VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
-    }
+    VecSetValues(G, 3*nLocBas, row_id_v, locassem_s->Residual0, ADD_VALUES);
+    VecSetValues(G,   nLocBas, row_id_p, locassem_s->Residual1, ADD_VALUES);
   }
 
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
@@ -444,11 +441,11 @@ void PGAssem_Wall_Prestress::Assem_Tangent_Residual(
   VecAssemblyBegin(G); VecAssemblyEnd(G);
 }
 
-void PGAssem_Wall_Prestress::Update_Wall_Prestress(
+double PGAssem_Wall_Prestress::Update_Wall_Prestress(
     const PDNSolution * const &disp,
     const PDNSolution * const &pres ) const
 {
-  const int nElem = locelem->get_nlocalele();
+  const int nElem_s = locelem->get_nlocalele(1);
   const int nqp   = locassem_s -> get_nqpv();
 
   const std::vector<double> array_d = disp -> GetLocalArray();
@@ -458,29 +455,44 @@ void PGAssem_Wall_Prestress::Update_Wall_Prestress(
   double * ectrl_y = new double [nLocBas];
   double * ectrl_z = new double [nLocBas];
 
-  for( int ee =0; ee < nElem; ++ee )
+  // The max absolute value of the prestress increment
+  double incr_norm = 0.0;
+
+  for(int ss=0; ss<nElem_s; ++ss)
   {
-    if( locelem->get_elem_tag(ee) == 1 )
-    {
-      const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
-      const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
-      fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
-      const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 );
-      const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
+    const int ee = locelem->get_elem_of_tag(1, ss);
 
-      const std::vector<SymmTensor2_3D> sigma = locassem_s -> get_Wall_CauchyStress( &local_d[0], 
-          &local_p[0], ectrl_x, ectrl_y, ectrl_z );
+    const std::vector<int> IEN_v = locien_v -> get_LIEN( ee );
+    const std::vector<int> IEN_p = locien_p -> get_LIEN( ee );
+    fnode -> get_ctrlPts_xyz(nLocBas, &IEN_v[0], ectrl_x, ectrl_y, ectrl_z);
+    const std::vector<double> local_d = GetLocal( array_d, IEN_v, nLocBas, 3 );
+    const std::vector<double> local_p = GetLocal( array_p, IEN_p, nLocBas, 1 );
 
-      for( int qua = 0; qua < nqp; ++qua )
-      {
-        const double sigma_at_qua[6] { sigma[qua].xx(), sigma[qua].yy(), sigma[qua].zz(), sigma[qua].yz(), sigma[qua].xz(), sigma[qua].xy() };
-        ps -> add_prestress( ee, qua, sigma_at_qua );
-      }
+    const std::vector<SymmTensor2_3D> sigma = locassem_s -> get_Wall_CauchyStress( &local_d[0], 
+        &local_p[0], ectrl_x, ectrl_y, ectrl_z );
+
+    for( int qua = 0; qua < nqp; ++qua )
+    {
+      const double sigma_at_qua[6] { sigma[qua].xx(), sigma[qua].yy(), sigma[qua].zz(), sigma[qua].yz(), sigma[qua].xz(), sigma[qua].xy() };
+      ps -> add_prestress( ee, qua, sigma_at_qua );
+
+      for(int ii=0; ii<6; ++ii) incr_norm = std::max( incr_norm, std::abs(sigma_at_qua[ii]) );
     }
   }
 
   delete [] ectrl_x; delete [] ectrl_y; delete [] ectrl_z;
   ectrl_x = nullptr; ectrl_y = nullptr; ectrl_z = nullptr;
+
+  // Report the increment relative to the accumulated prestress
+  double local_norm[2] { incr_norm, ps -> get_norm_inf() }, norm[2];
+  MPI_Allreduce( local_norm, norm, 2, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD );
+
+  const double rel_norm = norm[1] > 0.0 ? norm[0] / norm[1] : 0.0;
+
+  SYS_T::commPrint("  --- prestress increment l_inf norm: %e, relative: %e.\n",
+      norm[0], rel_norm );
+
+  return rel_norm;
 }
 
 // EOF
@@ -15,7 +15,9 @@ PLocAssem_2x2Block_VMS_Incompressible::PLocAssem_2x2Block_VMS_Incompressible(
   nLocBas( elementv->get_nLocBas() ), snLocBas( elements->get_nLocBas() ), 
   vec_size_0( nLocBas * 3 ), vec_size_1( nLocBas ),
   sur_size_0( snLocBas * 3 ),
-  matmodel( std::move(in_matmodel) )
+  matmodel( std::move(in_matmodel) ),
+  F_qua( nqpv ), P_qua( nqpv ), S_qua( nqpv ), CC_qua( nqpv ),
+  BB( 18 * nLocBas, 0.0 ), DB( 18 * nLocBas, 0.0 )
 {
   Tangent00 = new PetscScalar[vec_size_0 * vec_size_0];
   Tangent01 = new PetscScalar[vec_size_0 * vec_size_1];
@@ -268,23 +270,51 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
 
   Zero_Tangent_Residual();
 
+  // Deformation gradients at all quadrature points, followed by the stresses
+  // and elasticity tensors in one call to the material model
+  std::vector<double> dR_dx(nLocBas, 0.0), dR_dy(nLocBas, 0.0), dR_dz(nLocBas, 0.0);
+
   for(int qua=0; qua < nqpv; ++qua)
   {
-    double p = 0.0, p_x = 0.0, p_y = 0.0, p_z = 0.0;
-
-    double vx_t = 0.0, vy_t = 0.0, vz_t = 0.0;
+    elementv->get_gradR( qua, &dR_dx[0], &dR_dy[0], &dR_dz[0] );
 
     double ux_x = 0.0, uy_x = 0.0, uz_x = 0.0;
     double ux_y = 0.0, uy_y = 0.0, uz_y = 0.0;
     double ux_z = 0.0, uy_z = 0.0, uz_z = 0.0;
 
+    for(int ii=0; ii<nLocBas; ++ii)
+    {
+      ux_x += disp[ii*3  ] * dR_dx[ii];
+      uy_x += disp[ii*3+1] * dR_dx[ii];
+      uz_x += disp[ii*3+2] * dR_dx[ii];
+
+      ux_y += disp[ii*3  ] * dR_dy[ii];
+      uy_y += disp[ii*3+1] * dR_dy[ii];
+      uz_y += disp[ii*3+2] * dR_dy[ii];
+
+      ux_z += disp[ii*3  ] * dR_dz[ii];
+      uy_z += disp[ii*3+1] * dR_dz[ii];
+      uz_z += disp[ii*3+2] * dR_dz[ii];
+    }
+
+    F_qua[qua] = Tensor2_3D( ux_x + 1.0, ux_y, ux_z, uy_x, uy_y + 1.0, uy_z, uz_x, uz_y, uz_z + 1.0 );
+  }
+
+  matmodel->eval_PK_Stiffness_batch( nqpv, &F_qua[0], &P_qua[0], &S_qua[0], &CC_qua[0] );
+
+  for(int qua=0; qua < nqpv; ++qua)
+  {
+    double p = 0.0, p_x = 0.0, p_y = 0.0, p_z = 0.0;
+
+    double vx_t = 0.0, vy_t = 0.0, vz_t = 0.0;
+
     double vx_x = 0.0, vy_x = 0.0, vz_x = 0.0;
     double vx_y = 0.0, vy_y = 0.0, vz_y = 0.0;
     double vx_z = 0.0, vy_z = 0.0, vz_z = 0.0;
 
     Vector_3 coor(0.0, 0.0, 0.0);
 
-    std::vector<double> R(nLocBas, 0.0), dR_dx(nLocBas, 0.0), dR_dy(nLocBas, 0.0), dR_dz(nLocBas, 0.0);
+    std::vector<double> R(nLocBas, 0.0);
 
     elementv->get_R_gradR( qua, &R[0], &dR_dx[0], &dR_dy[0], &dR_dz[0] );
 
@@ -299,18 +329,6 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
       vy_t += dot_velo[ii*3+1] * R[ii];
       vz_t += dot_velo[ii*3+2] * R[ii];
 
-      ux_x += disp[ii*3  ] * dR_dx[ii];
-      uy_x += disp[ii*3+1] * dR_dx[ii];
-      uz_x += disp[ii*3+2] * dR_dx[ii];
-
-      ux_y += disp[ii*3  ] * dR_dy[ii];
-      uy_y += disp[ii*3+1] * dR_dy[ii];
-      uz_y += disp[ii*3+2] * dR_dy[ii];
-
-      ux_z += disp[ii*3  ] * dR_dz[ii];
-      uy_z += disp[ii*3+1] * dR_dz[ii];
-      uz_z += disp[ii*3+2] * dR_dz[ii];
-
       vx_x += velo[ii*3  ] * dR_dx[ii];
       vy_x += velo[ii*3+1] * dR_dx[ii];
       vz_x += velo[ii*3+2] * dR_dx[ii];
@@ -332,7 +350,7 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
 
     const Vector_3 f_body = get_f(coor, curr);
 
-    const Tensor2_3D F( ux_x + 1.0, ux_y, ux_z, uy_x, uy_y + 1.0, uy_z, uz_x, uz_y, uz_z + 1.0 );
+    const Tensor2_3D &F = F_qua[qua];
 
     const Tensor2_3D invF = Ten2::inverse(F);
 
@@ -345,9 +363,8 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
 
     const double invFDV_t = invF.MatTContraction(DVelo); // invF_Ii V_i,I
 
-    Tensor2_3D P_iso;
-    SymmTensor2_3D S_iso;
-    const Tensor4_3D AA_iso = matmodel->get_PK_FFStiffness(F, P_iso, S_iso);
+    Tensor2_3D P_iso = P_qua[qua];
+    const SymmTensor2_3D &S_iso = S_qua[qua];
 
     // ------------------------------------------------------------------------
     // 1st PK stress corrected by prestress
@@ -374,6 +391,27 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
     // Residual of mass equation
     const double Res_Mas = detF * invFDV_t;
 
+    // Material stiffness in the Voigt notation: BB holds the rows of the
+    // linearized Green-Lagrange strain, i.e., sym( F^T grad(N_A e_ii) ), with
+    // engineering shear, and DB = gwts * ddvm * BB : CC_qua
+    for(int A=0; A<nLocBas; ++A)
+    {
+      for(int ii=0; ii<3; ++ii)
+      {
+        double * const bb = &BB[18*A + 6*ii];
+        bb[0] = F(ii,0) * dR_dx[A];
+        bb[1] = F(ii,1) * dR_dy[A];
+        bb[2] = F(ii,2) * dR_dz[A];
+        bb[3] = F(ii,1) * dR_dz[A] + F(ii,2) * dR_dy[A];
+        bb[4] = F(ii,0) * dR_dz[A] + F(ii,2) * dR_dx[A];
+        bb[5] = F(ii,0) * dR_dy[A] + F(ii,1) * dR_dx[A];
+
+        double * const db = &DB[18*A + 6*ii];
+        CC_qua[qua].VoigtVecMult( bb, db );
+        for(int kk=0; kk<6; ++kk) db[kk] *= gwts * ddvm;
+      }
+    }
+
     for(int A=0; A<nLocBas; ++A)
     {
       const double NA = R[A], NA_x = dR_dx[A], NA_y = dR_dy[A], NA_z = dR_dz[A];
@@ -503,13 +541,12 @@ void PLocAssem_2x2Block_VMS_Incompressible::Assem_Tangent_Residual(
         {
           for(int jj=0; jj<3; ++jj)
           {
-            Tangent00[ 3*nLocBas*(3*A + ii) + 3*B + jj ] += gwts * ddvm * (
-                NA_x * (AA_iso(ii,0,jj,0) * NB_x + AA_iso(ii,0,jj,1) * NB_y
-                  + AA_iso(ii,0,jj,2) * NB_z)
-                + NA_y * (AA_iso(ii,1,jj,0) * NB_x + AA_iso(ii,1,jj,1) * NB_y
-                  + AA_iso(ii,1,jj,2) * NB_z)
-                + NA_z * (AA_iso(ii,2,jj,0) * NB_x + AA_iso(ii,2,jj,1) * NB_y
-                  + AA_iso(ii,2,jj,2) * NB_z)
+            const double * const db = &DB[18*A + 6*ii];
+            const double * const bb = &BB[18*B + 6*jj];
+
+            Tangent00[ 3*nLocBas*(3*A + ii) + 3*B + jj ] += db[0] * bb[0] + db[1] * bb[1]
+              + db[2] * bb[2] + db[3] * bb[3] + db[4] * bb[4] + db[5] * bb[5]
+              + gwts * ddvm * (
                 - GradNA_invF[ii] * detF * p * GradNB_invF[jj]
                 + GradNA_invF[jj] * detF * p * GradNB_invF[ii]
                 - GradNA_invF[jj] * GradNB_invF[ii] * tau_c * Res_Mas
@@ -14,10 +14,12 @@ PNonlinear_FSI_Solver::PNonlinear_FSI_Solver(
     const double &input_ndtol,
     const int &input_max_iteration, 
     const int &input_renew_freq,
-    const int &input_renew_threshold )
+    const int &input_renew_threshold,
+    const bool &input_mesh_per_step )
 : nr_tol(input_nrtol), na_tol(input_natol), nd_tol(input_ndtol),
   nmaxits(input_max_iteration), nrenew_freq(input_renew_freq),
   nrenew_threshold(input_renew_threshold),
+  is_mesh_per_step(input_mesh_per_step),
   gassem_mesh(std::move(in_gassem_mesh)),
   gassem_prestress(nullptr),
   lsolver(std::move(in_lsolver)),
@@ -44,6 +46,7 @@ PNonlinear_FSI_Solver::PNonlinear_FSI_Solver(
 : nr_tol(input_nrtol), na_tol(input_natol), nd_tol(input_ndtol),
   nmaxits(input_max_iteration), nrenew_freq(input_renew_freq),
   nrenew_threshold(input_renew_threshold),
+  is_mesh_per_step(false),
   gassem_mesh(nullptr),
   gassem_prestress(std::move(in_gassem_prestress)),
   lsolver(std::move(in_lsolver)),
@@ -65,6 +68,10 @@ void PNonlinear_FSI_Solver::print_info() const
   SYS_T::commPrint("maximum iteration: %d \n", nmaxits);
   SYS_T::commPrint("tangent matrix renew frequency: %d \n", nrenew_freq);
   SYS_T::commPrint("tangent matrix renew threshold: %d \n", nrenew_threshold);
+  if( is_mesh_per_step )
+    SYS_T::commPrint("mesh motion update: once per time step \n");
+  else
+    SYS_T::commPrint("mesh motion update: every Newton iteration \n");
   SYS_T::print_sep_line();
 }
 
@@ -153,18 +160,6 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
     PDNSolution * const &pres,
     bool &conv_flag, int &nl_counter ) const
 {
-#ifdef PETSC_USE_LOG
-  PetscLogEvent assem_event_0, assem_event_1, assem_event_2;
-  PetscLogEvent solve_mech_event, solve_mesh_event;
-  PetscClassId classid;
-  PetscClassIdRegister("user-log-info", &classid);
-  PetscLogEventRegister("assembly_0", classid, &assem_event_0);
-  PetscLogEventRegister("assembly_1", classid, &assem_event_1);
-  PetscLogEventRegister("assembly_2", classid, &assem_event_2);
-  PetscLogEventRegister("lin_solve_mech", classid, &solve_mech_event);
-  PetscLogEventRegister("lin_solve_mesh", classid, &solve_mesh_event);
-#endif
-
   // Initialization
   nl_counter = 0;
   double residual_norm = 0.0, initial_norm = 0.0, relative_error = 0.0;
@@ -225,10 +220,6 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
   rescale_inflow_value( curr_time + dt,           infnbc_part, velo );
   rescale_inflow_value( curr_time + alpha_f * dt, infnbc_part, velo_alpha.get() );
 
-#ifdef PETSC_USE_LOG
-  PetscLogEventBegin(assem_event_0, 0,0,0,0);
-#endif
-
   // If new_tangent_flag == TRUE, update the tangent matrix;
   // otherwise, use the matrix from the previous time step
   if( new_tangent_flag )
@@ -253,10 +244,6 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
         dot_velo, velo, disp, gbc );
   }
 
-#ifdef PETSC_USE_LOG
-  PetscLogEventEnd(assem_event_0, 0,0,0,0);
-#endif
-
   VecNorm(gassem_ptr->G, NORM_2, &initial_norm);
   SYS_T::commPrint("  Init res 2-norm: %e \n", initial_norm);
 
@@ -276,16 +263,8 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
     const double solid_kinematics_residual = Delta_dot_disp -> Norm_2();
     // Finish calculating dot_u_alpha - v_alpha
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(solve_mech_event, 0,0,0,0);
-#endif
-
     lsolver->Solve( gassem_ptr->G, sol_vp );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(solve_mech_event, 0,0,0,0);
-#endif
-
     bc_mat -> MatMultSol( sol_vp );
 
     nl_counter += 1;
@@ -311,34 +290,25 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
     VecRestoreSubVector(sol_vp, is_v, &sol_v);
     VecRestoreSubVector(sol_vp, is_p, &sol_p);
 
-    // Solve for mesh motion
-    gassem_mesh -> Clear_G();
-
-#ifdef PETSC_USE_LOG
-  PetscLogEventBegin(assem_event_2, 0,0,0,0);
-#endif
-
-    gassem_mesh -> Assem_residual( pre_disp, disp, curr_time, dt );
+    // Solve for mesh motion. The mesh operator is linear and unchanged, so
+    // the residual is a product with the cached operator and the solver
+    // reuses its preconditioner.
+    if( !is_mesh_per_step || nl_counter == 1 )
+    {
+      SYS_T::Perf_Begin( SYS_T::PERF_MESH_MOTION );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(assem_event_2, 0,0,0,0);
-#endif
+      gassem_mesh -> Assem_residual_linear( pre_disp, disp, curr_time, dt );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(solve_mesh_event, 0,0,0,0);
-#endif
-    
-    lsolver_mesh -> Solve( gassem_mesh -> G, sol_mesh );
+      lsolver_mesh -> Solve( gassem_mesh -> G, sol_mesh );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(solve_mesh_event,0,0,0,0);
-#endif
+      SYS_T::Perf_End( SYS_T::PERF_MESH_MOTION );
 
-    bc_mesh_mat -> MatMultSol( sol_mesh );
+      bc_mesh_mat -> MatMultSol( sol_mesh );
 
-    // update the mesh displacement
-    disp       -> PlusAX( sol_mesh, -1.0 );
-    disp_alpha -> PlusAX( sol_mesh, -1.0 * alpha_f );
+      // update the mesh displacement
+      disp       -> PlusAX( sol_mesh, -1.0 );
+      disp_alpha -> PlusAX( sol_mesh, -1.0 * alpha_f );
+    }
 
     // update the mesh velocity
     dot_disp -> Copy( pre_dot_disp );
@@ -350,10 +320,6 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
     dot_disp_alpha -> ScaleValue( 1.0 - alpha_m );
     dot_disp_alpha -> PlusAX( dot_disp, alpha_m );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(assem_event_1, 0,0,0,0);
-#endif
-
     // Assemble residual & tangent
     if( nl_counter % nrenew_freq == 0 || nl_counter >= nrenew_threshold )
     {
@@ -377,10 +343,6 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
           dot_velo, velo, disp, gbc );
     }
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(assem_event_1,0,0,0,0);
-#endif
-
     VecNorm(gassem_ptr->G, NORM_2, &residual_norm);
     SYS_T::commPrint("  --- nl_res: %e \n", residual_norm);
 
@@ -408,6 +370,7 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_FSI(
 void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_Prestress(
     const bool &new_tangent_flag,
     const double &prestress_tol,
+    const double &prestress_incr_tol,
     const double &curr_time,
     const double &dt,
     const IS &is_v,
@@ -576,13 +539,14 @@ void PNonlinear_FSI_Solver::GenAlpha_Seg_solve_Prestress(
 
   // --------------------------------------------------------------------------
   // Calculate teh Cauchy stress in solid element and update the prestress
-  gassem_prestress -> Update_Wall_Prestress( disp, pres );
+  const double prestress_incr = gassem_prestress -> Update_Wall_Prestress( disp, pres );
 
   const double solid_disp_norm = disp -> Norm_inf();
 
   SYS_T::commPrint("  --- solid disp l_inf norm: %e.\n", solid_disp_norm );
 
-  if( solid_disp_norm < prestress_tol ) prestress_conv_flag = true;
+  if( solid_disp_norm < prestress_tol || prestress_incr < prestress_incr_tol )
+    prestress_conv_flag = true;
   // --------------------------------------------------------------------------
 
   Print_convergence_info(nl_counter, relative_error, residual_norm);
@@ -184,6 +184,9 @@ void PTime_FSI_Solver::TM_FSI_GenAlpha(
     // Calculate the flow rate and averaged pressure on all inlets
     record_inlet_data( cur_disp.get(), cur_velo.get(), cur_pres.get(), time_info.get(), infnbc, gassem_ptr, false, true );
 
+    // Write the timing of this step into the performance trace
+    SYS_T::Perf_Registry::instance().Record_step( time_info->get_index() );
+
     pre_dot_disp -> Copy( cur_dot_disp.get() );
     pre_dot_velo -> Copy( cur_dot_velo.get() );
     pre_dot_pres -> Copy( cur_dot_pres.get() );
@@ -197,6 +200,7 @@ void PTime_FSI_Solver::TM_FSI_GenAlpha(
 void PTime_FSI_Solver::TM_FSI_Prestress(
     const bool &is_record_sol_flag,
     const double &prestress_tol,
+    const double &prestress_incr_tol,
     const IS &is_v,
     const IS &is_p,
     std::unique_ptr<PDNSolution> init_dot_disp,
@@ -256,7 +260,7 @@ void PTime_FSI_Solver::TM_FSI_Prestress(
     Nullify_solid_dof( pnode_v.get(), 3, cur_velo.get() );
     Nullify_solid_dof( pnode_p.get(), 1, cur_pres.get() );
 
-    nsolver -> GenAlpha_Seg_solve_Prestress( renew_flag, prestress_tol,
+    nsolver -> GenAlpha_Seg_solve_Prestress( renew_flag, prestress_tol, prestress_incr_tol,
         time_info->get_time(), time_info->get_step(), is_v, is_p, pre_dot_disp.get(), 
         pre_dot_velo.get(), pre_dot_pres.get(), pre_disp.get(), pre_velo.get(), 
         pre_pres.get(), cur_dot_disp.get(), cur_dot_velo.get(), cur_dot_pres.get(), 
@@ -32,8 +32,13 @@ int main( int argc, char *argv[] )
   // Estimate of num nonzeros per row for the sparse tangent matrix
   int nz_estimate = 300;
 
-  // Prestress tolerance
+  // Prestress tolerances: the iteration stops if the solid displacement or
+  // the relative l_inf norm of the prestress increment is below them
   double prestress_disp_tol = 1.0e-6;
+  double prestress_incr_tol = 1.0e-6;
+
+  // Write the prestress in single precision
+  bool is_ps_single = false;
 
   // Nonlinear solver parameters
   double nl_rtol    = 1.0e-3;        // convergence criterion relative tolerance
@@ -116,6 +121,8 @@ int main( int argc, char *argv[] )
   SYS_T::GetOptionBool(  "-is_backward_Euler",   is_backward_Euler);
   SYS_T::GetOptionInt(   "-nz_estimate",         nz_estimate);
   SYS_T::GetOptionReal(  "-prestress_disp_tol",  prestress_disp_tol);
+  SYS_T::GetOptionReal(  "-prestress_incr_tol",  prestress_incr_tol);
+  SYS_T::GetOptionBool(  "-is_ps_single",        is_ps_single);
   SYS_T::GetOptionReal(  "-nl_rtol",             nl_rtol);
   SYS_T::GetOptionReal(  "-nl_atol",             nl_atol);
   SYS_T::GetOptionReal(  "-nl_dtol",             nl_dtol);
@@ -138,6 +145,13 @@ int main( int argc, char *argv[] )
   SYS_T::cmdPrint(      "part_v_file:",          part_v_file);
   SYS_T::cmdPrint(      "part_p_file:",          part_p_file);
   SYS_T::cmdPrint(       "-prestress_disp_tol:", prestress_disp_tol);
+  SYS_T::cmdPrint(       "-prestress_incr_tol:", prestress_incr_tol);
+
+  if( is_ps_single )
+    SYS_T::commPrint(    "-is_ps_single: true \n");
+  else
+    SYS_T::commPrint(    "-is_ps_single: false \n");
+
   SYS_T::cmdPrint(       "-nl_rtol:",            nl_rtol);
   SYS_T::cmdPrint(       "-nl_atol:",            nl_atol);
   SYS_T::cmdPrint(       "-nl_dtol:",            nl_dtol);
@@ -173,6 +187,7 @@ int main( int argc, char *argv[] )
     
     cmdh5w -> write_string(      "ps_file_name",       ps_file_name);
     cmdh5w -> write_doubleScalar("prestress_disp_tol", prestress_disp_tol );
+    cmdh5w -> write_doubleScalar("prestress_incr_tol", prestress_incr_tol );
 
     delete cmdh5w; H5Fclose(cmd_file_id);
   }
@@ -206,7 +221,7 @@ int main( int argc, char *argv[] )
 
   auto locnbc_p = SYS_T::make_unique<ALocal_NBC>(part_p_file, rank, "/nbc/MF");
 
-  auto ps_data = SYS_T::make_unique<Tissue_prestress>(locElem.get(), nqp_vol, rank, is_load_ps, ps_file_name);
+  auto ps_data = SYS_T::make_unique<Tissue_prestress>(locElem.get(), nqp_vol, rank, is_load_ps, ps_file_name, is_ps_single);
  
   SYS_T::commPrint("===> Mesh HDF5 files are read from disk.\n");
 
@@ -364,7 +379,8 @@ int main( int argc, char *argv[] )
 
   // ===== FEM analysis =====
   SYS_T::commPrint("===> Start Finite Element Analysis:\n");
-  tsolver -> TM_FSI_Prestress( is_record_sol, prestress_disp_tol, is_velo, is_pres,
+  tsolver -> TM_FSI_Prestress( is_record_sol, prestress_disp_tol, prestress_incr_tol,
+      is_velo, is_pres,
       std::move(dot_disp), std::move(dot_velo), std::move(dot_pres), std::move(disp), 
       std::move(velo), std::move(pres), std::move(timeinfo) );
 
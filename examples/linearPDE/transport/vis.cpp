@@ -11,6 +11,7 @@
 #include "FEAElementFactory.hpp"
 #include "VisDataPrep_Transport.hpp"
 #include "VTK_Writer_Transport.hpp"
+#include "XDMF_Writer.hpp"
 
 int main( int argc, char * argv[] ) 
 { 
@@ -23,7 +24,7 @@ int main( int argc, char * argv[] )
   std::string sol_bname("SOL_temp_");
   std::string out_bname = sol_bname;
   int time_start = 0, time_step = 1, time_end = 1;
-  bool isXML = true, isRestart = false;
+  bool isXML = true, isRestart = false, isXDMF = false;
 
   // Read analysis code parameter if the solver_cmd.h5 exists
   hid_t prepcmd_file = H5Fopen("solver_cmd.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
@@ -52,6 +53,7 @@ int main( int argc, char * argv[] )
   SYS_T::GetOptionString("-out_bname", out_bname);
   SYS_T::GetOptionBool("-xml", isXML);
   SYS_T::GetOptionBool("-restart", isRestart);
+  SYS_T::GetOptionBool("-xdmf", isXDMF);
 
   SYS_T::commPrint("=== Command line arguments ===\n");
   SYS_T::cmdPrint("-sol_bname:", sol_bname);
@@ -65,6 +67,9 @@ int main( int argc, char * argv[] )
 
   if(isRestart) SYS_T::commPrint("-restart: true \n");
   else SYS_T::commPrint("-restart: false \n");
+
+  if(isXDMF) SYS_T::commPrint("-xdmf: true \n");
+  else SYS_T::commPrint("-xdmf: false \n");
   SYS_T::commPrint("==============================\n");
   
   // Clean the visualization files if not restart
@@ -104,9 +109,21 @@ int main( int argc, char * argv[] )
   for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
     solArrays[ii] = new double [pNode->get_nlocghonode() * visprep->get_ptarray_comp_length(ii)];
 
-  // VTK writer 
-  auto vtk_w = SYS_T::make_unique<VTK_Writer_Transport>( GMIptr->get_nElem(), 
-      GMIptr->get_nLocBas(), element_part_file );
+  // VTK writer, or the XDMF writer that writes the geometry only once
+  std::unique_ptr<VTK_Writer_Transport> vtk_w = nullptr;
+  std::unique_ptr<XDMF_Writer> xdmf_w = nullptr;
+
+  if( isXDMF )
+  {
+    xdmf_w = SYS_T::make_unique<XDMF_Writer>( out_bname + "xdmf", fNode.get(),
+        locIEN.get(), locElem.get(), elemType, pNode->get_nlocghonode(),
+        VIS_T::read_epart( element_part_file, GMIptr->get_nElem() ), isRestart );
+
+    xdmf_w->print_info();
+  }
+  else
+    vtk_w = SYS_T::make_unique<VTK_Writer_Transport>( GMIptr->get_nElem(),
+        GMIptr->get_nLocBas(), element_part_file );
   
   std::ostringstream time_index;
 
@@ -125,14 +142,18 @@ int main( int argc, char * argv[] )
     visprep->get_pointArray(name_to_read, anode_mapping_file, pnode_mapping_file,
         pNode.get(), GMIptr->get_nFunc(), dof, solArrays);
 
-    vtk_w->writeOutput( fNode.get(), locIEN.get(), locElem.get(),
-        visprep.get(), element.get(), quad.get(), solArrays,
-        rank, size, time * dt, sol_bname, out_bname, name_to_write, isXML );
+    if( isXDMF )
+      xdmf_w->write_step( time, time * dt, visprep.get(), solArrays );
+    else
+      vtk_w->writeOutput( fNode.get(), locIEN.get(), locElem.get(),
+          visprep.get(), element.get(), quad.get(), solArrays,
+          rank, size, time * dt, sol_bname, out_bname, name_to_write, isXML );
   }
 
   MPI_Barrier(PETSC_COMM_WORLD);
 
   // ===== Clean the memory =====
+  xdmf_w.reset();
   for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
     delete [] solArrays[ii];
   delete [] solArrays;
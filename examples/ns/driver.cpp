@@ -13,8 +13,13 @@
 #include "FlowRateFactory.hpp"
 #include "GenBCFactory.hpp"
 #include "PLocAssem_VMS_NS_GenAlpha_WeakBC.hpp"
+#include "PLocAssem_VMS_NS_GenAlpha_NonNewtonian.hpp"
+#include "ViscosityModel_Newtonian.hpp"
+#include "ViscosityModel_Carreau.hpp"
+#include "ViscosityModel_Power_Law.hpp"
 #include "PGAssem_NS_FEM.hpp"
 #include "PTime_NS_Solver.hpp"
+#include "Matrix_Free_Resis_Tools.hpp"
 
 int main(int argc, char *argv[])
 {
@@ -36,6 +41,15 @@ int main(int argc, char *argv[])
   double c_tauc = 1.0; // scaling factor for tau_c, take 0.0, 0.125, or 1.0
   double c_ct = 4.0;   // C_T parameter for defining tau_M
 
+  // viscosity model: 0 Newtonian with fl_mu, 1 Carreau, 2 power law. The
+  // default parameters are for blood in the CGS units, and the Carreau
+  // power term can be tabulated to avoid std::pow at quadrature points
+  int vis_model = 0;
+  double vis_mu_inf = 3.45e-2, vis_mu_0 = 0.56, vis_lambda = 3.313;
+  double vis_n_pli = 0.3568, vis_m_cons = 0.35;
+  double vis_mu_max = 0.56, vis_mu_min = 3.45e-2;
+  bool is_vis_table = false;
+
   // inflow file
   std::string inflow_file("inflow_fourier_series.txt");
 
@@ -45,6 +59,9 @@ int main(int argc, char *argv[])
   // back flow stabilization
   double bs_beta = 0.2;
 
+  // apply the resistance bc tangent as a low-rank update outside of K
+  bool is_resis_lowrank = false;
+
   // generalized-alpha rho_inf
   double genA_rho_inf = 0.5;
   bool is_backward_Euler = false;
@@ -66,15 +83,53 @@ int main(int argc, char *argv[])
   int initial_index = 0;     // indiex of the initial condition
   double final_time = 1.0;   // final time
   std::string sol_bName("SOL_"); // base name of the solution file
+  std::string perf_trace_file(""); // per-step timing trace, disabled if empty
   int ttan_renew_freq = 1;   // frequency of tangent matrix renewal
   int sol_record_freq = 1;   // frequency of recording the solution
 
+  // predictor: 0 same-Y, 1 polynomial extrapolation, 2 POD over the last cycle
+  int predictor_type = 0;
+  int predictor_order = 2;        // order of the polynomial extrapolation
+  double predictor_period = 0.0;  // cycle period for the POD predictor
+  int predictor_max_snap = 100;   // cap of the stored dot_sol snapshots
+
+  // number of staging buffers for writing the solutions with nonblocking MPI-IO,
+  // 0 means the solutions are written synchronously
+  int num_write_buffer = 0;
+
+  // HDF5 solution files with per-field datasets and the node mapping, and
+  // the deflate level of their datasets (0 for no compression). A filter
+  // plugin id (e.g. 32015 zstd) replaces deflate, the byte shuffle helps
+  // both, and h5_lossy_digits > 0 stores the files lossy for visualization
+  bool is_write_h5 = false;
+  int h5_deflate_level = 0;
+  bool is_h5_shuffle = false;
+  int h5_lossy_digits = 0;
+  int h5_filter_id = 0;
+
+  // In-situ XDMF/HDF5 output of pressure, velocity, and optionally the
+  // vorticity every insitu_freq steps, 0 means no in-situ output
+  int insitu_freq = 0;
+  bool is_insitu_vorticity = false;
+  std::string insitu_name("INSITU_");
+
+  // In-situ wall shear stress sampled every wss_freq steps from
+  // wss_start_time, with TAWSS and OSI written at the end, 0 means off
+  int wss_freq = 0;
+  double wss_start_time = 0.0;
+  std::string wss_name("WSS_");
+
+  // Solver state checkpoint written every chk_freq steps, 0 means off
+  int chk_freq = 0;
+  std::string chk_name("CHECKPOINT");
+
   // Restart options
   bool is_restart = false;
   int restart_index = 0;             // restart solution time index
   double restart_time = 0.0;         // restart time
   double restart_step = 1.0e-3;      // restart simulation time step size
   std::string restart_name = "SOL_"; // restart solution base name
+  std::string restart_chk_name = "";  // restart checkpoint, if not empty
 
   // Yaml options
   bool is_loadYaml = true;
@@ -104,10 +159,20 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt("-nqp_sur", nqp_sur);
   SYS_T::GetOptionInt("-nz_estimate", nz_estimate);
   SYS_T::GetOptionReal("-bs_beta", bs_beta);
+  SYS_T::GetOptionBool("-is_resis_lowrank", is_resis_lowrank);
   SYS_T::GetOptionReal("-rho_inf", genA_rho_inf);
   SYS_T::GetOptionBool("-is_backward_Euler", is_backward_Euler);
   SYS_T::GetOptionReal("-fl_density", fluid_density);
   SYS_T::GetOptionReal("-fl_mu", fluid_mu);
+  SYS_T::GetOptionInt("-vis_model", vis_model);
+  SYS_T::GetOptionReal("-vis_mu_inf", vis_mu_inf);
+  SYS_T::GetOptionReal("-vis_mu_0", vis_mu_0);
+  SYS_T::GetOptionReal("-vis_lambda", vis_lambda);
+  SYS_T::GetOptionReal("-vis_n_pli", vis_n_pli);
+  SYS_T::GetOptionReal("-vis_m_cons", vis_m_cons);
+  SYS_T::GetOptionReal("-vis_mu_max", vis_mu_max);
+  SYS_T::GetOptionReal("-vis_mu_min", vis_mu_min);
+  SYS_T::GetOptionBool("-is_vis_table", is_vis_table);
   SYS_T::GetOptionReal("-c_tauc", c_tauc);
   SYS_T::GetOptionReal("-c_ct", c_ct);
   SYS_T::GetOptionString("-inflow_file", inflow_file);
@@ -126,11 +191,36 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt("-ttan_freq", ttan_renew_freq);
   SYS_T::GetOptionInt("-sol_rec_freq", sol_record_freq);
   SYS_T::GetOptionString("-sol_name", sol_bName);
+  SYS_T::GetOptionString("-perf_trace_file", perf_trace_file);
+  SYS_T::GetOptionInt("-predictor_type", predictor_type);
+  SYS_T::GetOptionInt("-predictor_order", predictor_order);
+  SYS_T::GetOptionReal("-predictor_period", predictor_period);
+  SYS_T::GetOptionInt("-predictor_max_snap", predictor_max_snap);
+  SYS_T::GetOptionInt("-num_write_buffer", num_write_buffer);
+  SYS_T::GetOptionBool("-is_write_h5", is_write_h5);
+  SYS_T::GetOptionInt("-h5_deflate_level", h5_deflate_level);
+  SYS_T::GetOptionBool("-is_h5_shuffle", is_h5_shuffle);
+  SYS_T::GetOptionInt("-h5_lossy_digits", h5_lossy_digits);
+  SYS_T::GetOptionInt("-h5_filter_id", h5_filter_id);
+  SYS_T::GetOptionInt("-insitu_freq", insitu_freq);
+  SYS_T::GetOptionBool("-is_insitu_vorticity", is_insitu_vorticity);
+  SYS_T::GetOptionString("-insitu_name", insitu_name);
+  SYS_T::GetOptionInt("-wss_freq", wss_freq);
+  SYS_T::GetOptionReal("-wss_start_time", wss_start_time);
+  SYS_T::GetOptionString("-wss_name", wss_name);
   SYS_T::GetOptionBool("-is_restart", is_restart);
   SYS_T::GetOptionInt("-restart_index", restart_index);
   SYS_T::GetOptionReal("-restart_time", restart_time);
   SYS_T::GetOptionReal("-restart_step", restart_step);
   SYS_T::GetOptionString("-restart_name", restart_name);
+  SYS_T::GetOptionString("-restart_chk_name", restart_chk_name);
+  SYS_T::GetOptionInt("-chk_freq", chk_freq);
+  SYS_T::GetOptionString("-chk_name", chk_name);
+
+  // A checkpoint provides the restart time step data
+  if( is_restart && !restart_chk_name.empty() )
+    Checkpoint_NS::Read_time_info( restart_chk_name, restart_index,
+        restart_time, restart_step );
   SYS_T::GetOptionReal("-C_bI", C_bI);
 
   // ===== Print Command Line Arguments =====
@@ -142,9 +232,30 @@ int main(int argc, char *argv[])
     SYS_T::cmdPrint(    "-rho_inf:",         genA_rho_inf);
   SYS_T::cmdPrint("-nz_estimate:", nz_estimate);
   SYS_T::cmdPrint("-bs_beta:", bs_beta);
+  if( is_resis_lowrank )
+    SYS_T::commPrint("-is_resis_lowrank: true \n");
+  else
+    SYS_T::commPrint("-is_resis_lowrank: false \n");
   SYS_T::cmdPrint("-rho_inf:", genA_rho_inf);
   SYS_T::cmdPrint("-fl_density:", fluid_density);
   SYS_T::cmdPrint("-fl_mu:", fluid_mu);
+  SYS_T::cmdPrint("-vis_model:", vis_model);
+  if( vis_model == 1 )
+  {
+    SYS_T::cmdPrint("-vis_mu_inf:", vis_mu_inf);
+    SYS_T::cmdPrint("-vis_mu_0:", vis_mu_0);
+    SYS_T::cmdPrint("-vis_lambda:", vis_lambda);
+    SYS_T::cmdPrint("-vis_n_pli:", vis_n_pli);
+    if( is_vis_table ) SYS_T::commPrint("-is_vis_table: true \n");
+    else SYS_T::commPrint("-is_vis_table: false \n");
+  }
+  else if( vis_model == 2 )
+  {
+    SYS_T::cmdPrint("-vis_m_cons:", vis_m_cons);
+    SYS_T::cmdPrint("-vis_n_pli:", vis_n_pli);
+    SYS_T::cmdPrint("-vis_mu_max:", vis_mu_max);
+    SYS_T::cmdPrint("-vis_mu_min:", vis_mu_min);
+  }
   SYS_T::cmdPrint("-c_tauc:", c_tauc);
   SYS_T::cmdPrint("-c_ct:", c_ct);
   SYS_T::cmdPrint("-inflow_file:", inflow_file);
@@ -163,13 +274,52 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-ttan_freq:", ttan_renew_freq);
   SYS_T::cmdPrint("-sol_rec_freq:", sol_record_freq);
   SYS_T::cmdPrint("-sol_name:", sol_bName);
+  if( !perf_trace_file.empty() )
+    SYS_T::cmdPrint("-perf_trace_file:", perf_trace_file);
+  SYS_T::cmdPrint("-predictor_type:", predictor_type);
+  if( predictor_type != 0 )
+    SYS_T::cmdPrint("-predictor_order:", predictor_order);
+  if( predictor_type == 2 )
+  {
+    SYS_T::cmdPrint("-predictor_period:", predictor_period);
+    SYS_T::cmdPrint("-predictor_max_snap:", predictor_max_snap);
+  }
+  SYS_T::cmdPrint("-num_write_buffer:", num_write_buffer);
+  if( is_write_h5 )
+  {
+    SYS_T::commPrint("-is_write_h5: true \n");
+    SYS_T::cmdPrint("-h5_deflate_level:", h5_deflate_level);
+    if( is_h5_shuffle ) SYS_T::commPrint("-is_h5_shuffle: true \n");
+    else SYS_T::commPrint("-is_h5_shuffle: false \n");
+    SYS_T::cmdPrint("-h5_lossy_digits:", h5_lossy_digits);
+    SYS_T::cmdPrint("-h5_filter_id:", h5_filter_id);
+  }
+  else SYS_T::commPrint("-is_write_h5: false \n");
+  SYS_T::cmdPrint("-insitu_freq:", insitu_freq);
+  if( insitu_freq > 0 )
+  {
+    SYS_T::cmdPrint("-insitu_name:", insitu_name);
+    if( is_insitu_vorticity ) SYS_T::commPrint("-is_insitu_vorticity: true \n");
+    else SYS_T::commPrint("-is_insitu_vorticity: false \n");
+  }
+  SYS_T::cmdPrint("-wss_freq:", wss_freq);
+  if( wss_freq > 0 )
+  {
+    SYS_T::cmdPrint("-wss_start_time:", wss_start_time);
+    SYS_T::cmdPrint("-wss_name:", wss_name);
+  }
+  SYS_T::cmdPrint("-chk_freq:", chk_freq);
+  if( chk_freq > 0 ) SYS_T::cmdPrint("-chk_name:", chk_name);
   if(is_restart)
   {
     SYS_T::commPrint("-is_restart: true \n");
     SYS_T::cmdPrint("-restart_index:", restart_index);
     SYS_T::cmdPrint("-restart_time:", restart_time);
     SYS_T::cmdPrint("-restart_step:", restart_step);
-    SYS_T::cmdPrint("-restart_name:", restart_name);
+    if( restart_chk_name.empty() )
+      SYS_T::cmdPrint("-restart_name:", restart_name);
+    else
+      SYS_T::cmdPrint("-restart_chk_name:", restart_chk_name);
   }
   else SYS_T::commPrint("-is_restart: false \n");
 
@@ -182,6 +332,21 @@ int main(int argc, char *argv[])
 
     cmdh5w->write_doubleScalar("fl_density", fluid_density);
     cmdh5w->write_doubleScalar("fl_mu", fluid_mu);
+    cmdh5w->write_intScalar("vis_model", vis_model);
+    if( vis_model == 1 )
+    {
+      cmdh5w->write_doubleScalar("vis_mu_inf", vis_mu_inf);
+      cmdh5w->write_doubleScalar("vis_mu_0", vis_mu_0);
+      cmdh5w->write_doubleScalar("vis_lambda", vis_lambda);
+      cmdh5w->write_doubleScalar("vis_n_pli", vis_n_pli);
+    }
+    else if( vis_model == 2 )
+    {
+      cmdh5w->write_doubleScalar("vis_m_cons", vis_m_cons);
+      cmdh5w->write_doubleScalar("vis_n_pli", vis_n_pli);
+      cmdh5w->write_doubleScalar("vis_mu_max", vis_mu_max);
+      cmdh5w->write_doubleScalar("vis_mu_min", vis_mu_min);
+    }
     cmdh5w->write_doubleScalar("init_step", initial_step);
     cmdh5w->write_intScalar("sol_record_freq", sol_record_freq);
     cmdh5w->write_string("lpn_file", lpn_file);
@@ -258,7 +423,32 @@ int main(int argc, char *argv[])
   // ===== Local Assembly routine =====
   std::unique_ptr<IPLocAssem> locAssem_ptr = nullptr;
 
-  if( locwbc->get_wall_model_type() == 0 )
+  SYS_T::print_fatal_if( vis_model != 0 && locwbc->get_wall_model_type() != 0,
+      "Error: the non-Newtonian viscosity models do not support the weakly enforced wall BC.\n" );
+
+  SYS_T::print_fatal_if( vis_model < 0 || vis_model > 2,
+      "Error: Unknown viscosity model %d.\n", vis_model );
+
+  // A new instance of the viscosity model for each of its users
+  auto gen_vismodel = [&]() -> std::unique_ptr<IViscosityModel>
+  {
+    if( vis_model == 1 )
+      return SYS_T::make_unique<ViscosityModel_Carreau>( vis_mu_inf, vis_mu_0,
+          vis_lambda, vis_n_pli, is_vis_table );
+    else if( vis_model == 2 )
+      return SYS_T::make_unique<ViscosityModel_Power_Law>( vis_m_cons, vis_n_pli,
+          vis_mu_max, vis_mu_min );
+    else
+      return SYS_T::make_unique<ViscosityModel_Newtonian>( fluid_mu );
+  };
+
+  if( vis_model != 0 )
+  {
+    locAssem_ptr = SYS_T::make_unique<PLocAssem_VMS_NS_GenAlpha_NonNewtonian>(
+      ANL_T::get_elemType(part_file, rank), nqp_vol, nqp_sur,
+      tm_galpha.get(), fluid_density, gen_vismodel(), bs_beta, c_ct, c_tauc );
+  }
+  else if( locwbc->get_wall_model_type() == 0 )
   {
     locAssem_ptr = SYS_T::make_unique<PLocAssem_VMS_NS_GenAlpha>(
       ANL_T::get_elemType(part_file, rank), nqp_vol, nqp_sur,
@@ -288,32 +478,76 @@ int main(int argc, char *argv[])
     initial_time  = restart_time;
     initial_step  = restart_step;
 
-    // Read sol file
-    SYS_T::file_check(restart_name);
-    sol->ReadBinary(restart_name);
-
-    // generate the corresponding dot_sol file name
-    std::string restart_dot_name = "dot_";
-    restart_dot_name.append(restart_name);
-
-    // Read dot_sol file
-    SYS_T::file_check(restart_dot_name);
-    dot_sol->ReadBinary(restart_dot_name);
-
-    SYS_T::commPrint("===> Read sol from disk as a restart run... \n");
-    SYS_T::commPrint("     restart_name: %s \n", restart_name.c_str());
-    SYS_T::commPrint("     restart_dot_name: %s \n", restart_dot_name.c_str());
+    if( restart_chk_name.empty() && HDF5_T::is_field_file(restart_name) )
+    {
+      // Read sol and dot_sol from the groups of the HDF5 solution file
+      SYS_T::file_check(restart_name);
+
+      SYS_T::print_fatal_if( PDNSolution_HDF5::get_lossy_digits(restart_name) > 0,
+          "Error: %s is stored lossy and cannot be used for a restart.\n", restart_name.c_str() );
+
+      const PDNSolution_HDF5 reader( std::vector<std::string>{"pressure", "velocity"},
+          std::vector<int>{1, 3} );
+      reader.Read( restart_name, "sol", sol.get() );
+      reader.Read( restart_name, "dot_sol", dot_sol.get() );
+
+      SYS_T::commPrint("===> Read sol from disk as a restart run... \n");
+      SYS_T::commPrint("     restart_name: %s \n", restart_name.c_str());
+    }
+    else if( restart_chk_name.empty() )
+    {
+      // Read sol file
+      SYS_T::file_check(restart_name);
+      sol->ReadBinary(restart_name);
+
+      // generate the corresponding dot_sol file name
+      std::string restart_dot_name = "dot_";
+      restart_dot_name.append(restart_name);
+
+      // Read dot_sol file
+      SYS_T::file_check(restart_dot_name);
+      dot_sol->ReadBinary(restart_dot_name);
+
+      SYS_T::commPrint("===> Read sol from disk as a restart run... \n");
+      SYS_T::commPrint("     restart_name: %s \n", restart_name.c_str());
+      SYS_T::commPrint("     restart_dot_name: %s \n", restart_dot_name.c_str());
+    }
+    else
+    {
+      Checkpoint_NS::Read( restart_chk_name, sol.get(), dot_sol.get() );
+
+      SYS_T::commPrint("===> Read checkpoint from disk as a restart run... \n");
+      SYS_T::commPrint("     restart_chk_name: %s \n", restart_chk_name.c_str());
+    }
     SYS_T::commPrint("     restart_time: %e \n", restart_time);
     SYS_T::commPrint("     restart_index: %d \n", restart_index);
     SYS_T::commPrint("     restart_step: %e \n", restart_step);
   }
 
+  // ===== In-situ output on the analysis mesh =====
+  // The in-situ stages keep raw pointers to the mesh objects, so they are
+  // built before the objects are moved into the global assembly, which owns
+  // them for the whole run.
+  std::unique_ptr<Insitu_Output_NS> insitu = nullptr;
+  if( insitu_freq > 0 )
+    insitu = SYS_T::make_unique<Insitu_Output_NS>( insitu_name, insitu_freq,
+        fNode.get(), locIEN.get(), locElem.get(), pNode.get(),
+        ANL_T::get_elemType(part_file, rank), nqp_vol, is_insitu_vorticity,
+        is_restart );
+
+  // ===== In-situ wall shear stress on the wall partition =====
+  std::unique_ptr<Insitu_WSS_NS> wss = nullptr;
+  if( wss_freq > 0 )
+    wss = SYS_T::make_unique<Insitu_WSS_NS>( wss_name, part_file, rank,
+        wss_freq, wss_start_time, gen_vismodel(), fNode.get(), locIEN.get(),
+        locElem.get(), pNode.get(), ANL_T::get_elemType(part_file, rank) );
+
   // ===== Global assembly =====
   SYS_T::commPrint("===> Initializing Mat K and Vec G ... \n");
-  std::unique_ptr<IPGAssem> gloAssem = SYS_T::make_unique<PGAssem_NS_FEM>( 
+  auto gloAssem = SYS_T::make_unique<PGAssem_NS_FEM>( 
       gbc.get(), std::move(locIEN), std::move(locElem), std::move(fNode), 
       std::move(pNode), std::move(locnbc), std::move(locebc), 
-      std::move(locwbc), std::move(locAssem_ptr), nz_estimate );
+      std::move(locwbc), std::move(locAssem_ptr), nz_estimate, is_resis_lowrank );
 
   SYS_T::commPrint("===> Assembly nonzero estimate matrix ... \n");
   gloAssem->Assem_nonzero_estimate( gbc.get() );
@@ -359,11 +593,40 @@ int main(int argc, char *argv[])
   PCFieldSplitSetFields(upc,"u",3,vfields,vfields);
   PCFieldSplitSetFields(upc,"p",1,pfield,pfield);
 
+  // ===== Shell matrix K + U V^T for the low-rank resistance bc =====
+  Mat shell = nullptr;
+  std::unique_ptr<MF_RESIS_T::PCContext> resis_pc_ctx = nullptr;
+  if( is_resis_lowrank )
+  {
+    PetscInt local_row_size, local_col_size;
+    MatGetLocalSize( gloAssem->K, &local_row_size, &local_col_size );
+
+    MatCreateShell( PETSC_COMM_WORLD, local_row_size, local_col_size,
+        PETSC_DETERMINE, PETSC_DETERMINE, (void *)(gloAssem.get()), &shell );
+
+    MatShellSetOperation(shell, MATOP_MULT, (void(*)(void))MF_RESIS_T::MF_MatMult);
+
+    // The PC given by the command line acts on K as the inner PC, and the
+    // outer shell PC adds the Sherman-Morrison-Woodbury correction
+    resis_pc_ctx = SYS_T::make_unique<MF_RESIS_T::PCContext>( gloAssem.get() );
+
+    PCSetFromOptions( resis_pc_ctx->inner );
+    PCFieldSplitSetBlockSize( resis_pc_ctx->inner, 4 );
+    PCFieldSplitSetFields( resis_pc_ctx->inner, "u", 3, vfields, vfields );
+    PCFieldSplitSetFields( resis_pc_ctx->inner, "p", 1, pfield, pfield );
+
+    PCSetType( upc, PCSHELL );
+    PCShellSetContext( upc, (void *)(resis_pc_ctx.get()) );
+    PCShellSetSetUp( upc, MF_RESIS_T::MF_PCSetUp );
+    PCShellSetApply( upc, MF_RESIS_T::MF_PCApply );
+    PCShellSetName( upc, "resistance_bc_SMW" );
+  }
+
   // ===== Nonlinear solver context =====
   auto nsolver = SYS_T::make_unique<PNonlinear_NS_Solver>(
       std::move(lsolver), std::move(pmat), std::move(tm_galpha), 
       std::move(inflow_rate), std::move(base), nl_rtol, nl_atol, 
-      nl_dtol, nl_maxits, nl_refreq, nl_threshold );
+      nl_dtol, nl_maxits, nl_refreq, nl_threshold, shell );
 
   nsolver->print_info();
 
@@ -371,10 +634,25 @@ int main(int argc, char *argv[])
   auto timeinfo = SYS_T::make_unique<PDNTimeStep>(initial_index, initial_time, 
       initial_step);
 
+  // ===== HDF5 solution files with pressure and velocity fields =====
+  std::unique_ptr<PDNSolution_HDF5> sol_h5 = nullptr;
+  if( is_write_h5 )
+    sol_h5 = SYS_T::make_unique<PDNSolution_HDF5>(
+        std::vector<std::string>{"pressure", "velocity"}, std::vector<int>{1, 3},
+        "node_mapping.h5", 65536, h5_deflate_level, is_h5_shuffle,
+        h5_lossy_digits, h5_filter_id );
+
+  // ===== Solver state checkpoint =====
+  std::unique_ptr<Checkpoint_NS> chk = nullptr;
+  if( chk_freq > 0 )
+    chk = SYS_T::make_unique<Checkpoint_NS>( chk_name, chk_freq );
+
   // ===== Temporal solver context =====
   auto tsolver = SYS_T::make_unique<PTime_NS_Solver>(
       std::move(nsolver), sol_bName, sol_record_freq, 
-      ttan_renew_freq, final_time );
+      ttan_renew_freq, final_time, predictor_type, predictor_order,
+      predictor_period, predictor_max_snap, num_write_buffer, std::move(sol_h5),
+      std::move(insitu), std::move(wss), std::move(chk) );
 
   tsolver->print_info();
 
@@ -388,6 +666,12 @@ int main(int argc, char *argv[])
   tsolver->record_inlet_data(sol.get(), timeinfo.get(), locinfnbc.get(), 
       gloAssem.get(), true, is_restart);
 
+  // ===== GenBC states and flow files at the checkpoint =====
+  if( is_restart && !restart_chk_name.empty() )
+    Checkpoint_NS::Restore( restart_chk_name, gbc.get() );
+
+  SYS_T::Perf_Registry::instance().set_trace_file( perf_trace_file );
+
   // ===== FEM analysis =====
   SYS_T::commPrint("===> Start Finite Element Analysis:\n");
   tsolver->TM_NS_GenAlpha(is_restart, std::move(dot_sol), std::move(sol), 
@@ -396,7 +680,11 @@ int main(int argc, char *argv[])
   // ===== Print complete solver info =====
   tsolver -> print_lsolver_info();
 
-  tsolver.reset(); locinfnbc.reset(); gbc.reset(); gloAssem.reset();
+  SYS_T::Perf_Registry::instance().print_summary();
+
+  tsolver.reset(); resis_pc_ctx.reset();
+  if( shell != nullptr ) MatDestroy(&shell);
+  locinfnbc.reset(); gbc.reset(); gloAssem.reset();
 
   PetscFinalize();
   return EXIT_SUCCESS;
@@ -0,0 +1,93 @@
+#ifndef CHECKPOINT_NS_HPP
+#define CHECKPOINT_NS_HPP
+// ============================================================================
+// Checkpoint_NS.hpp
+//
+// Self-describing checkpoint of the NS time solver for restarts. One HDF5
+// file <bname>.h5 holds the complete state needed to continue a run:
+//
+//   /sol, /dot_sol                  : the solutions written by
+//                                     PDNSolution_HDF5 with the pressure
+//                                     and velocity fields
+//   /solver/time_index, time, step  : the PDNTimeStep data
+//   /solver/genbc_state_size        : num_ebc, the size of the GenBC state
+//                                     of each face
+//   /solver/genbc_state             : the GenBC states of all faces
+//   /solver/flow_file_<ii>          : the name and the size in bytes of
+//   /solver/flow_file_size            the inlet and outlet data files
+//
+// The checkpoint is written into <bname>.h5.tmp and renamed, so that a job
+// killed while writing leaves the previous checkpoint intact. In a restart,
+// the GenBC states are restored after the driver resets the GenBC from the
+// solution, and the flow files are truncated to the recorded sizes, which
+// drops the lines of the steps after the checkpoint.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "PDNSolution_HDF5.hpp"
+#include "HDF5_Writer.hpp"
+#include "PDNTimeStep.hpp"
+#include "IGenBC.hpp"
+
+class Checkpoint_NS
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! The checkpoint is written into in_bname.h5 every in_freq steps. The
+    //   analysis node mapping is read from node_mapping_file.
+    // ------------------------------------------------------------------------
+    Checkpoint_NS( const std::string &in_bname, const int &in_freq,
+        const std::string &node_mapping_file = "node_mapping.h5" );
+
+    ~Checkpoint_NS() = default;
+
+    // ------------------------------------------------------------------------
+    // ! Write the checkpoint if the time step index is a multiple of freq.
+    //   flow_files are the data files appended by the solver in each step.
+    //   This is collective.
+    // ------------------------------------------------------------------------
+    void Write( const PDNSolution * const &sol,
+        const PDNSolution * const &dot_sol,
+        const PDNTimeStep * const &time_info,
+        const IGenBC * const &gbc,
+        const std::vector<std::string> &flow_files ) const;
+
+    // ------------------------------------------------------------------------
+    // ! Read the time step data of the checkpoint file_name
+    // ------------------------------------------------------------------------
+    static void Read_time_info( const std::string &file_name, int &time_index,
+        double &time, double &step );
+
+    // ------------------------------------------------------------------------
+    // ! Read sol and dot_sol of the checkpoint file_name. This is collective.
+    // ------------------------------------------------------------------------
+    static void Read( const std::string &file_name, PDNSolution * const &sol,
+        PDNSolution * const &dot_sol,
+        const std::string &node_mapping_file = "node_mapping.h5" );
+
+    // ------------------------------------------------------------------------
+    // ! Restore the GenBC states and truncate the flow files on rank 0. This
+    //   should be called after the GenBC is reset by the driver.
+    // ------------------------------------------------------------------------
+    static void Restore( const std::string &file_name, IGenBC * const &gbc );
+
+    void print_info() const;
+
+  private:
+    const std::string bname;
+
+    const int freq;
+
+    const std::unique_ptr<PDNSolution_HDF5> sol_h5;
+
+    // Append the group /solver to file_name on rank 0
+    void Write_solver( const std::string &file_name,
+        const PDNTimeStep * const &time_info,
+        const IGenBC * const &gbc,
+        const std::vector<std::string> &flow_files ) const;
+
+    // The size in bytes of file_name, or 0 if it does not exist
+    static int get_file_size( const std::string &file_name );
+};
+
+#endif
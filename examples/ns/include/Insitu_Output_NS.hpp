@@ -0,0 +1,80 @@
+#ifndef INSITU_OUTPUT_NS_HPP
+#define INSITU_OUTPUT_NS_HPP
+// ============================================================================
+// Insitu_Output_NS.hpp
+//
+// In-situ output stage of the NS solver. It is called by PTime_NS_Solver
+// after each time step, and every freq steps it writes the pressure and
+// velocity, and optionally the vorticity, into an XDMF/HDF5 time series.
+//
+// The mesh objects of the solver are reused, i.e., the output is written in
+// the analysis partition from the ghosted local arrays of the solution, and
+// no separate postprocessing partition, solution reload, or node remapping
+// is needed. The nodal vorticity is the volume-weighted average of the mean
+// vorticity of the elements sharing the node, which requires one element
+// loop and one ghost reduction.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "FEAElementFactory.hpp"
+#include "QuadPtsFactory.hpp"
+#include "PDNSolution.hpp"
+#include "PDNTimeStep.hpp"
+#include "XDMF_Writer.hpp"
+
+class Insitu_Output_NS
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! The time series is written into in_bname.xmf and in_bname_p<rank>.h5.
+    //   nqp_vol is the number of volume quadrature points for the vorticity
+    //   projection. If isRestart is true, the steps in the existing files
+    //   are kept. The mesh objects have to outlive this object.
+    // ------------------------------------------------------------------------
+    Insitu_Output_NS( const std::string &in_bname, const int &in_freq,
+        const FEANode * const &in_fnode,
+        const ALocal_IEN * const &in_lien,
+        const ALocal_Elem * const &lelem_ptr,
+        const APart_Node * const &pnode_ptr,
+        const FEType &elemType, const int &nqp_vol,
+        const bool &in_is_vorticity, const bool &isRestart );
+
+    ~Insitu_Output_NS() = default;
+
+    // ------------------------------------------------------------------------
+    // ! Write the solution sol at time_info if the time step index is a
+    //   multiple of freq. This is collective.
+    // ------------------------------------------------------------------------
+    void Execute( const PDNSolution * const &sol,
+        const PDNTimeStep * const &time_info ) const;
+
+    void print_info() const;
+
+  private:
+    const std::string bname;
+
+    const int freq, nLocBas, nlocalele, nlocghonode;
+
+    const bool is_vorticity;
+
+    const FEANode * const fnode;
+    const ALocal_IEN * const lien;
+
+    const std::unique_ptr<IQuadPts> quad;
+    const std::unique_ptr<FEAElement> element;
+
+    // Ghosted vector of the summed vorticity integrals and element volumes
+    const std::unique_ptr<PDNSolution> proj;
+
+    const std::unique_ptr<XDMF_Writer> writer;
+
+    // ------------------------------------------------------------------------
+    // ! Average the vorticity of the local array of an NS solution, with the
+    //   pressure and velocity of a node stored contiguously, onto the local
+    //   and ghost nodes. The output vort has length 3 x nlocghonode.
+    // ------------------------------------------------------------------------
+    void Average_vorticity( const std::vector<double> &array,
+        std::vector<double> &vort ) const;
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef INSITU_WSS_NS_HPP
+#define INSITU_WSS_NS_HPP
+// ============================================================================
+// Insitu_WSS_NS.hpp
+//
+// Parallel wall shear stress stage of the NS solver. It is called by
+// PTime_NS_Solver after each time step, and every freq steps after
+// start_time it evaluates the WSS on the wall cells of the partition and
+// updates the running sums of |WSS| and WSS on the wall nodes. At the end of
+// the simulation, the TAWSS, the OSI, and the time-averaged WSS are written
+// once into an XDMF/HDF5 file of the wall mesh.
+//
+// The wall is read from the group /wall of the part file, which is written
+// by the preprocessor. The WSS of a wall cell at its nodes is evaluated from
+// the velocity gradient of the attached volume element at the nodes, i.e.,
+//   WSS = mu ( a - (a.n) n ), a = ( grad u + grad u^T ) n,
+// with n the outward normal of the cell and mu given by the viscosity model
+// at the strain rate of that node, so that it is consistent with the
+// assembly of a generalized Newtonian fluid. The nodal WSS is the area-weighted
+// average over the wall cells sharing the node, which requires one ghost
+// reduction. With the samples WSS_k, k = 1, ..., N,
+//   TAWSS = sum_k |WSS_k| / N,
+//   OSI   = 0.5 ( 1 - |sum_k WSS_k| / sum_k |WSS_k| ).
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "ALocal_EBC.hpp"
+#include "FEAElementFactory.hpp"
+#include "QuadPtsFactory.hpp"
+#include "PDNSolution.hpp"
+#include "PDNTimeStep.hpp"
+#include "XDMF_Writer.hpp"
+#include "IViscosityModel.hpp"
+
+class Insitu_WSS_NS
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! The wall is read from the group /wall of part_file. The result is
+    //   written into in_bname.xmf and in_bname_p<rank>.h5. The mesh objects
+    //   have to outlive this object.
+    // ------------------------------------------------------------------------
+    Insitu_WSS_NS( const std::string &in_bname,
+        const std::string &part_file, const int &rank,
+        const int &in_freq, const double &in_start_time,
+        std::unique_ptr<IViscosityModel> in_vismodel,
+        const FEANode * const &in_fnode,
+        const ALocal_IEN * const &in_lien,
+        const ALocal_Elem * const &lelem_ptr,
+        const APart_Node * const &pnode_ptr,
+        const FEType &in_elemType );
+
+    ~Insitu_WSS_NS() = default;
+
+    // ------------------------------------------------------------------------
+    // ! Accumulate the WSS of the solution sol if the time step index is a
+    //   multiple of freq and the time is not earlier than start_time. This
+    //   is collective.
+    // ------------------------------------------------------------------------
+    void Accumulate( const PDNSolution * const &sol,
+        const PDNTimeStep * const &time_info );
+
+    // ------------------------------------------------------------------------
+    // ! Write the TAWSS, OSI, and time-averaged WSS of the accumulated
+    //   samples at time_info. If no sample is taken, e.g. the start time is
+    //   after the final time, nothing is written. This is collective.
+    // ------------------------------------------------------------------------
+    void Write( const PDNTimeStep * const &time_info ) const;
+
+    void print_info() const;
+
+  private:
+    const std::string bname, part_name;
+
+    const int freq;
+
+    const double start_time;
+
+    const std::unique_ptr<IViscosityModel> vismodel;
+
+    const FEType elemType;
+
+    const int nLocBas, nlocghonode;
+
+    const FEANode * const fnode;
+    const ALocal_IEN * const lien;
+
+    const std::unique_ptr<ALocal_EBC> wall;
+
+    // The number of wall cells, the number of nodes per cell, and the number
+    // of wall nodes of the partition
+    const int num_cell, cell_nLocBas, num_node;
+
+    // The volume element quadrature and element evaluated at the nodes
+    const std::unique_ptr<IQuadPts> quad;
+    const std::unique_ptr<FEAElement> element;
+
+    // Ghosted vector of the summed area-weighted WSS and areas
+    const std::unique_ptr<PDNSolution> proj;
+
+    // The local volume element of every wall cell, and the position of
+    // every cell node in the IEN of that element
+    std::vector<int> cell_elem, cell_node_loc;
+
+    // The number of samples and the running sums of |WSS| and WSS on the
+    // wall nodes, of length num_node and 3 x num_node
+    int num_sample;
+    std::vector<double> sum_mag, sum_wss;
+
+    // ------------------------------------------------------------------------
+    // ! Evaluate the nodal WSS on the wall nodes from the local array of an
+    //   NS solution. The output wss has length 3 x num_node.
+    // ------------------------------------------------------------------------
+    void Compute_wss( const std::vector<double> &array,
+        std::vector<double> &wss ) const;
+
+    // The surface element type of the wall of the volume element type
+    static FEType get_wall_elemType( const FEType &vol_elemType );
+};
+
+#endif
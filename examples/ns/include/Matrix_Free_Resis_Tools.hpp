@@ -0,0 +1,161 @@
+#ifndef MATRIX_FREE_RESIS_TOOLS_HPP
+#define MATRIX_FREE_RESIS_TOOLS_HPP
+// ============================================================================
+// Matrix_Free_Resis_Tools.hpp
+//
+// Shell matrix and preconditioner for the NS tangent with the low-rank
+// resistance bc term,
+//                  A = K + U V^T,
+// where K is the sparse matrix assembled by PGAssem_NS_FEM, the columns of
+// U are coef_i a_i and the columns of V are b_i, one per outlet.
+//
+// The preconditioner wraps an inner PC built on K and corrects it by the
+// Sherman-Morrison-Woodbury formula
+//   A^{-1} ~ P^{-1} - Z (I + V^T Z)^{-1} V^T P^{-1}, with Z = P^{-1} U.
+// Z and the LU factorization of the num_ebc x num_ebc capacitance matrix
+// I + V^T Z are updated whenever the PC is set up for a new K.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "PGAssem_NS_FEM.hpp"
+
+namespace MF_RESIS_T
+{
+  struct PCContext
+  {
+    PGAssem_NS_FEM * const gloAssem;
+
+    // The PC of K, configured by the command line options
+    PC inner;
+
+    // Z = P^{-1} U, one vector per outlet
+    std::vector<Vec> Z;
+
+    // LU factors of the capacitance matrix and the row pivots
+    std::vector<double> cap;
+    std::vector<int> piv;
+
+    PCContext( PGAssem_NS_FEM * const &in_gloAssem )
+    : gloAssem( in_gloAssem ), Z( in_gloAssem->get_num_ebc(), nullptr )
+    {
+      PCCreate(PETSC_COMM_WORLD, &inner);
+    }
+
+    ~PCContext()
+    {
+      for(auto &zz : Z) if( zz != nullptr ) VecDestroy(&zz);
+      PCDestroy(&inner);
+    }
+  };
+
+  // y = K x + U V^T x
+  inline PetscErrorCode MF_MatMult(Mat shell, Vec x, Vec y)
+  {
+    void * ptr;
+    MatShellGetContext(shell, &ptr);
+    PGAssem_NS_FEM * user = (PGAssem_NS_FEM*) ptr;
+
+    MatMult(user->K, x, y);
+
+    user->Resis_LowRank_MultAdd(x, y);
+
+    return 0;
+  }
+
+  inline PetscErrorCode MF_PCSetUp(PC pc)
+  {
+    void * ptr;
+    PCShellGetContext(pc, &ptr);
+    PCContext * ctx = (PCContext*) ptr;
+
+    Mat Amat, Pmat;
+    PCGetOperators(pc, &Amat, &Pmat);
+    PCSetOperators(ctx->inner, Pmat, Pmat);
+    PCSetUp(ctx->inner);
+
+    const int nn = ctx->gloAssem->get_num_ebc();
+
+    Vec uu;
+    VecDuplicate(ctx->gloAssem->G, &uu);
+
+    // cap = I + V^T Z, stored row-major
+    ctx->cap.assign( nn*nn, 0.0 );
+    ctx->piv.resize( nn );
+
+    std::vector<double> col;
+    for(int jj=0; jj<nn; ++jj)
+    {
+      if( ctx->Z[jj] == nullptr ) VecDuplicate(ctx->gloAssem->G, &ctx->Z[jj]);
+
+      ctx->gloAssem->Resis_LowRank_Get_U(jj, uu);
+      PCApply(ctx->inner, uu, ctx->Z[jj]);
+
+      ctx->gloAssem->Resis_LowRank_Dot(ctx->Z[jj], col);
+      for(int ii=0; ii<nn; ++ii) ctx->cap[ii*nn + jj] = col[ii];
+
+      ctx->cap[jj*nn + jj] += 1.0;
+    }
+
+    VecDestroy(&uu);
+
+    // LU factorization with partial pivoting
+    for(int kk=0; kk<nn; ++kk)
+    {
+      int pp = kk;
+      for(int ii=kk+1; ii<nn; ++ii)
+        if( std::abs(ctx->cap[ii*nn+kk]) > std::abs(ctx->cap[pp*nn+kk]) ) pp = ii;
+
+      ctx->piv[kk] = pp;
+      if( pp != kk )
+        for(int jj=0; jj<nn; ++jj) std::swap( ctx->cap[kk*nn+jj], ctx->cap[pp*nn+jj] );
+
+      SYS_T::print_fatal_if( ctx->cap[kk*nn+kk] == 0.0, "Error: MF_RESIS_T::MF_PCSetUp, the capacitance matrix is singular.\n" );
+
+      for(int ii=kk+1; ii<nn; ++ii)
+      {
+        ctx->cap[ii*nn+kk] /= ctx->cap[kk*nn+kk];
+        for(int jj=kk+1; jj<nn; ++jj)
+          ctx->cap[ii*nn+jj] -= ctx->cap[ii*nn+kk] * ctx->cap[kk*nn+jj];
+      }
+    }
+
+    return 0;
+  }
+
+  inline PetscErrorCode MF_PCApply(PC pc, Vec x, Vec y)
+  {
+    void * ptr;
+    PCShellGetContext(pc, &ptr);
+    PCContext * ctx = (PCContext*) ptr;
+
+    // y = P^{-1} x
+    PCApply(ctx->inner, x, y);
+
+    const int nn = ctx->gloAssem->get_num_ebc();
+    if( nn == 0 ) return 0;
+
+    // cc = (I + V^T Z)^{-1} V^T y
+    std::vector<double> cc;
+    ctx->gloAssem->Resis_LowRank_Dot(y, cc);
+
+    for(int kk=0; kk<nn; ++kk) std::swap( cc[kk], cc[ctx->piv[kk]] );
+
+    for(int ii=1; ii<nn; ++ii)
+      for(int jj=0; jj<ii; ++jj) cc[ii] -= ctx->cap[ii*nn+jj] * cc[jj];
+
+    for(int ii=nn-1; ii>=0; --ii)
+    {
+      for(int jj=ii+1; jj<nn; ++jj) cc[ii] -= ctx->cap[ii*nn+jj] * cc[jj];
+      cc[ii] /= ctx->cap[ii*nn+ii];
+    }
+
+    // y = y - Z cc
+    for(int ii=0; ii<nn; ++ii) cc[ii] = -cc[ii];
+
+    VecMAXPY(y, nn, &cc[0], &ctx->Z[0]);
+
+    return 0;
+  }
+}
+
+#endif
@@ -93,14 +93,6 @@ namespace MF_T
   
   PetscErrorCode MF_PCSchurApply(PC pc, Vec x, Vec y)
   {
-  #ifdef PETSC_USE_LOG
-    PetscLogEvent A_solve, S_solve;
-    PetscClassId classid_solve;
-    PetscClassIdRegister("PCsolve", &classid_solve);
-    PetscLogEventRegister("A_solve", classid_solve, &A_solve);
-    PetscLogEventRegister("S_solve", classid_solve, &S_solve);
-  #endif
-
     void *ptr;
     SolverContext *ctx;
     PCShellGetContext(pc, &ptr);
@@ -121,37 +113,25 @@ namespace MF_T
     VecDuplicate(x1, &tmp1);
     VecDuplicate(x2, &tmp2);
 
-  #ifdef PETSC_USE_LOG
-    PetscLogEventBegin(A_solve, 0,0,0,0);
-  #endif 
+    SYS_T::Perf_Begin( SYS_T::PERF_PC_A_SOLVE );
     // Step 1: Compute y1 = A^{-1} x1
     ctx->lsolver_A->Solve(x1, y1, false);
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(A_solve,0,0,0,0);
-  #endif
+    SYS_T::Perf_End( SYS_T::PERF_PC_A_SOLVE );
 
     // Step 2: Compute y2 = x2 - C * y1
     MatMult(C, y1, tmp2);
     VecWAXPY(y2, -1.0, tmp2, x2);
 
-  #ifdef PETSC_USE_LOG
-    PetscLogEventBegin(S_solve, 0,0,0,0);
-  #endif 
+    SYS_T::Perf_Begin( SYS_T::PERF_PC_S_SOLVE );
     // Step 3: Compute y2 = S^{-1} y2
     ctx->lsolver_S->Solve(y2, y2, false);
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(S_solve,0,0,0,0);
-  #endif
+    SYS_T::Perf_End( SYS_T::PERF_PC_S_SOLVE );
 
     // Step 4: Compute y1 = y1 - A^{-1} B y2 = A^{-1} x1 - A^{-1} B y2
     MatMult(B, y2, tmp1);
-  #ifdef PETSC_USE_LOG
-    PetscLogEventBegin(A_solve, 0,0,0,0);
-  #endif 
+    SYS_T::Perf_Begin( SYS_T::PERF_PC_A_SOLVE );
     ctx->lsolver_A->Solve(tmp1, tmp1, false); 
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(A_solve,0,0,0,0);
-  #endif
+    SYS_T::Perf_End( SYS_T::PERF_PC_A_SOLVE );
     VecAXPY(y1, -1.0, tmp1);
 
     VecDestroy(&tmp1);
@@ -39,7 +39,8 @@ class PGAssem_NS_FEM : public IPGAssem
         std::unique_ptr<ALocal_EBC> in_ebc,
         std::unique_ptr<ALocal_WeakBC> in_wbc,
         std::unique_ptr<IPLocAssem> in_locassem,    
-        const int &in_nz_estimate=60 );
+        const int &in_nz_estimate=60,
+        const bool &in_is_resis_lowrank=false );
 
     // Destructor
     virtual ~PGAssem_NS_FEM();
@@ -93,6 +94,42 @@ class PGAssem_NS_FEM : public IPGAssem
         const ALocal_InflowBC * const &infbc_part,
         const int &infnbc_id ) const;
 
+    // Batched surface integrals over all outlets / inlets, with one
+    // MPI_Allreduce for all faces
+    virtual void Assem_surface_outlet_data(
+        const PDNSolution * const &dot_sol,
+        const PDNSolution * const &sol,
+        std::vector<double> &dot_flrate,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const;
+
+    virtual void Assem_surface_inlet_data(
+        const PDNSolution * const &sol,
+        const ALocal_InflowBC * const &infbc_part,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const;
+
+    // ------------------------------------------------------------------------
+    // Low-rank representation of the resistance bc tangent. If enabled, the
+    // outlet coupling
+    //      K_resis = sum_i coef_i a_i b_i^T, i = 0, ..., num_ebc-1,
+    // with a_i = int_Gamma_i N_A n and b_i = (int_Gamma_i N_B) out_n, is not
+    // inserted into K. The linear solver then works with K + K_resis
+    // through a shell matrix, see Matrix_Free_Resis_Tools.hpp.
+    // ------------------------------------------------------------------------
+    bool get_is_resis_lowrank() const {return is_resis_lowrank;}
+
+    int get_num_ebc() const {return num_ebc;}
+
+    // dot[i] = b_i^T X for all outlets, with one MPI_Allreduce
+    void Resis_LowRank_Dot( const Vec &X, std::vector<double> &dot ) const;
+
+    // Y = Y + sum_i coef_i a_i b_i^T X
+    void Resis_LowRank_MultAdd( const Vec &X, Vec &Y ) const;
+
+    // U = coef_i a_i for the outlet ebc_id, U has the layout of G
+    void Resis_LowRank_Get_U( const int &ebc_id, Vec &U ) const;
+
   private:
     // Private data
     const std::unique_ptr<const ALocal_IEN> locien;
@@ -106,6 +143,16 @@ class PGAssem_NS_FEM : public IPGAssem
 
     const int nLocBas, snLocBas, dof_sol, dof_mat, num_ebc, nlgn;
 
+    const bool is_resis_lowrank;
+
+    // The coefficient of each outlet, updated in NatBC_Resis_KG
+    std::vector<double> resis_coef;
+
+    // Nonzero entries of a_i and b_i in the rows owned by this CPU, stored
+    // as offsets into the local part of a vector with the layout of G
+    std::vector< std::vector<int> > resis_a_idx, resis_b_idx;
+    std::vector< std::vector<double> > resis_a_val, resis_b_val;
+
     // Private function
     // Essential boundary condition
     void EssBC_KG( const int &field );
@@ -121,6 +168,19 @@ class PGAssem_NS_FEM : public IPGAssem
     void BackFlow_KG( const double &dt,
         const PDNSolution * const &sol );
 
+    // Flow rates of dot_sol and sol on all outlets, and optionally the
+    // surface integrals of pressure and area, reduced over CPUs in one
+    // MPI_Allreduce. The output is ordered as num_ebc values of dot Q,
+    // num_ebc values of Q, then num_ebc pressure and area integrals.
+    void Assem_surface_outlet_integrals(
+        const PDNSolution * const &dot_sol,
+        const PDNSolution * const &sol,
+        const bool &is_pressure,
+        std::vector<double> &sum ) const;
+
+    // Build a_i and b_i of the low-rank resistance bc tangent
+    void Init_Resis_LowRank();
+
     // Resistance type boundary condition on outlet surfaces
     void NatBC_Resis_G( const double &curr_time, const double &dt,
         const PDNSolution * const &dot_sol,
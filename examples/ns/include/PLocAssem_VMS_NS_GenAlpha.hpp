@@ -154,10 +154,30 @@ class PLocAssem_VMS_NS_GenAlpha : public IPLocAssem
 
     SymmTensor2_3D get_metric( const std::array<double, 9> &dxi_dx ) const;
 
-    // Return tau_m and tau_c in RB-VMS
+    // Return tau_m and tau_c in RB-VMS with the dynamic viscosity mu
     std::array<double, 2> get_tau( const double &dt, 
         const std::array<double, 9> &dxi_dx,
-        const double &u, const double &v, const double &w ) const;
+        const double &u, const double &v, const double &w,
+        const double &mu ) const;
+
+    // ------------------------------------------------------------------------
+    // Viscosity at the volumetric quadrature points. eval_viscosity is called
+    // once per element after the basis of elementv is built, and
+    // get_viscosity returns mu at the quadrature point qua of that element.
+    // The default is the constant vis_mu.
+    // ------------------------------------------------------------------------
+    virtual void eval_viscosity( const double * const &sol ) {}
+
+    virtual double get_viscosity( const int &qua ) const { return vis_mu; }
+
+    // ------------------------------------------------------------------------
+    // Add coef x the derivative of the Galerkin viscous term through the
+    // velocity dependence of mu at the quadrature point qua into Tangent.
+    // The default, a constant mu, adds nothing.
+    // ------------------------------------------------------------------------
+    virtual void add_viscosity_tangent( const int &qua, const double &coef,
+        const double * const &dR_dx, const double * const &dR_dy,
+        const double * const &dR_dz ) {}
 
     // Return tau_bar := (v' G v')^-0.5 x rho0, 
     //        which scales like Time x Density
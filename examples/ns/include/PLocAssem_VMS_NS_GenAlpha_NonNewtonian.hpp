@@ -0,0 +1,74 @@
+#ifndef PLOCASSEM_VMS_NS_GENALPHA_NONNEWTONIAN_HPP
+#define PLOCASSEM_VMS_NS_GENALPHA_NONNEWTONIAN_HPP
+// ==================================================================
+// PLocAssem_VMS_NS_GenAlpha_NonNewtonian.hpp
+//
+// Parallel Local Assembly routine for VMS and Gen-alpha based NS
+// solver with a generalized Newtonian fluid, whose viscosity is
+// given by an IViscosityModel as a function of the strain rate.
+//
+// The residual and tangent are the ones of the base class, which
+// reads mu at each quadrature point through its viscosity hooks. In
+// each element, the strain rates at all volumetric quadrature
+// points are evaluated first, and the viscosity mu and its
+// derivative dmu_dI2 with respect to I2 = D : D are obtained in one
+// batched call of the viscosity model. The tangent includes the
+// derivative 4 dmu_dI2 (D gradN_A)_i (D gradN_B)_j of the viscous
+// stress. In the strong residual of tau_m, the viscous term is
+// mu Laplacian(u), i.e., the gradient of mu is neglected, and the
+// dependence of mu in tau_m and in the residual is not linearized.
+// The viscosity vis_mu of the base class is the one at zero strain
+// rate.
+//
+// Date: Oct. 19 2026
+// ==================================================================
+#include "PLocAssem_VMS_NS_GenAlpha.hpp"
+#include "IViscosityModel.hpp"
+
+class PLocAssem_VMS_NS_GenAlpha_NonNewtonian : public PLocAssem_VMS_NS_GenAlpha
+{
+  public:
+    PLocAssem_VMS_NS_GenAlpha_NonNewtonian(
+        const FEType &in_type, const int &in_nqp_v, const int &in_nqp_s,
+        const TimeMethod_GenAlpha * const &tm_gAlpha, const double &in_rho,
+        std::unique_ptr<IViscosityModel> in_vismodel, const double &in_beta,
+        const double &in_ct = 4.0, const double &in_ctauc = 1.0 );
+
+    virtual ~PLocAssem_VMS_NS_GenAlpha_NonNewtonian() = default;
+
+  protected:
+    // ----------------------------------------------------------------
+    // ! eval_viscosity : Evaluate strain_rate_qua, mu_qua, and dmu_qua
+    //   from the element solution sol. The basis of elementv should be
+    //   built.
+    // ----------------------------------------------------------------
+    virtual void eval_viscosity( const double * const &sol );
+
+    virtual double get_viscosity( const int &qua ) const
+    { return mu_qua[qua]; }
+
+    // ----------------------------------------------------------------
+    // ! add_viscosity_tangent : Add
+    //   coef x 4 dmu_dI2 (D gradN_A)_i (D gradN_B)_j
+    //   to the velocity-velocity blocks of Tangent.
+    // ----------------------------------------------------------------
+    virtual void add_viscosity_tangent( const int &qua, const double &coef,
+        const double * const &dR_dx, const double * const &dR_dy,
+        const double * const &dR_dz );
+
+  private:
+    const std::unique_ptr<IViscosityModel> vismodel;
+
+    // ----------------------------------------------------------------
+    // The strain rate, mu, and dmu_dI2 at the volumetric quadrature
+    // points of the current element. Size is nqpv.
+    // ----------------------------------------------------------------
+    std::vector<SymmTensor2_3D> strain_rate_qua;
+
+    std::vector<double> mu_qua, dmu_qua;
+
+    // D gradN_A of the basis functions at one quadrature point, 3 x nLocBas
+    std::vector<double> DN;
+};
+
+#endif
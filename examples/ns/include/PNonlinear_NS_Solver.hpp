@@ -27,7 +27,8 @@ class PNonlinear_NS_Solver
         const double &input_nrtol, const double &input_natol, 
         const double &input_ndtol, const int &input_max_iteration, 
         const int &input_renew_freq, 
-        const int &input_renew_threshold = 4 );
+        const int &input_renew_threshold = 4,
+        const Mat &in_shell = nullptr );
 
     ~PNonlinear_NS_Solver() = default;
 
@@ -43,6 +44,11 @@ class PNonlinear_NS_Solver
     //
     // This solver solves the Navier-Stokes using 2nd-order Generalized
     // alpha method.
+    //
+    // If pred_dot_sol is nullptr, the same-Y predictor is used; otherwise
+    // pred_dot_sol is taken as the predicted dot_sol and the predicted sol
+    // is made consistent with it through the Newmark relation
+    //   sol = pre_sol + dt (1-gamma) pre_dot_sol + dt gamma dot_sol.
     // --------------------------------------------------------------
     void GenAlpha_Solve_NS(
         const bool &new_tangent_flag,
@@ -50,6 +56,7 @@ class PNonlinear_NS_Solver
         const double &dt,
         const PDNSolution * const &pre_dot_sol,
         const PDNSolution * const &pre_sol,
+        const PDNSolution * const &pred_dot_sol,
         PDNSolution * const &dot_sol,
         PDNSolution * const &sol,
         const ALocal_InflowBC * const &infnbc_part,
@@ -67,6 +74,16 @@ class PNonlinear_NS_Solver
     const std::unique_ptr<IFlowRate> flrate;
     const std::unique_ptr<PDNSolution> sol_base;
 
+    // If not null, the shell matrix is the linear operator and the
+    // assembled K is used to build the preconditioner
+    const Mat shell;
+
+    void SetOperator( const IPGAssem * const &gassem_ptr ) const
+    {
+      if( shell != nullptr ) lsolver->SetOperator( shell, gassem_ptr->K );
+      else lsolver->SetOperator( gassem_ptr->K );
+    }
+
     void Print_convergence_info( const int &count, const double rel_err,
         const double abs_err ) const
     {
@@ -9,6 +9,12 @@
 // Date: May 23 2017
 // ==================================================================
 #include "PDNTimeStep.hpp"
+#include "PDNSolution_History.hpp"
+#include "PDNSolution_Writer.hpp"
+#include "PDNSolution_HDF5.hpp"
+#include "Insitu_Output_NS.hpp"
+#include "Insitu_WSS_NS.hpp"
+#include "Checkpoint_NS.hpp"
 #include "PNonlinear_NS_Solver.hpp"
 
 class PTime_NS_Solver
@@ -18,7 +24,16 @@ class PTime_NS_Solver
         std::unique_ptr<PNonlinear_NS_Solver> in_nsolver,
         const std::string &input_name,      
         const int &input_record_freq, const int &input_renew_tang_freq, 
-        const double &input_final_time );
+        const double &input_final_time,
+        const int &input_predictor_type = 0,
+        const int &input_predictor_order = 2,
+        const double &input_predictor_period = 0.0,
+        const int &input_predictor_max_snap = 100,
+        const int &input_num_write_buffer = 0,
+        std::unique_ptr<PDNSolution_HDF5> in_sol_h5 = nullptr,
+        std::unique_ptr<Insitu_Output_NS> in_insitu = nullptr,
+        std::unique_ptr<Insitu_WSS_NS> in_wss = nullptr,
+        std::unique_ptr<Checkpoint_NS> in_chk = nullptr );
 
     ~PTime_NS_Solver() = default;
 
@@ -78,14 +93,92 @@ class PTime_NS_Solver
     const int renew_tang_freq; // the frequency for renewing tangents
     const std::string pb_name; // the problem base name for the solution
 
+    // ------------------------------------------------------------------------
+    // predictor_type 0 : same-Y predictor;
+    //                1 : polynomial extrapolation of dot_sol of order
+    //                    predictor_order from the last converged steps;
+    //                2 : projection of dot_sol onto the snapshots of the
+    //                    previous cycle of length predictor_period, with the
+    //                    polynomial extrapolation used before a full cycle is
+    //                    stored.
+    // predictor_max_snap is the upper bound of the number of dot_sol
+    // snapshots kept in memory by the predictors. The POD predictor needs
+    // one cycle plus two steps; if that exceeds the bound, the run stops
+    // instead of allocating the snapshots.
+    // ------------------------------------------------------------------------
+    const int predictor_type, predictor_order;
+    const double predictor_period;
+    const int predictor_max_snap;
+
+    // ------------------------------------------------------------------------
+    // The number of staging buffers of the asynchronous solution writer.
+    // If it is 0, the solutions are written synchronously by WriteBinary.
+    // ------------------------------------------------------------------------
+    const int num_write_buffer;
+
     const std::unique_ptr<PNonlinear_NS_Solver> nsolver;
 
+    // ------------------------------------------------------------------------
+    // If not nullptr, the recorded sol and dot_sol are also written into
+    // the HDF5 file pb_name_xxx.h5 in the groups "sol" and "dot_sol"
+    // ------------------------------------------------------------------------
+    const std::unique_ptr<PDNSolution_HDF5> sol_h5;
+
+    // ------------------------------------------------------------------------
+    // If not nullptr, the in-situ output stage is executed after each time
+    // step and writes the visualization data directly from the solver
+    // ------------------------------------------------------------------------
+    const std::unique_ptr<Insitu_Output_NS> insitu;
+
+    // ------------------------------------------------------------------------
+    // If not nullptr, the WSS is accumulated after each time step, and the
+    // TAWSS and OSI are written at the end of the time integration
+    // ------------------------------------------------------------------------
+    const std::unique_ptr<Insitu_WSS_NS> wss;
+
+    // ------------------------------------------------------------------------
+    // If not nullptr, the solver state is checkpointed after the outlet and
+    // inlet data of a step are recorded
+    // ------------------------------------------------------------------------
+    const std::unique_ptr<Checkpoint_NS> chk;
+
     std::string Name_Generator( const int &counter ) const;
 
     std::string Name_dot_Generator( const int &counter ) const;
 
     void Write_restart_file(const PDNTimeStep * const &timeinfo,
         const std::string &solname ) const;
+
+    // ------------------------------------------------------------------------
+    // Write sol into file_name by the writer, or synchronously if writer is
+    // nullptr
+    // ------------------------------------------------------------------------
+    void Write_sol( PDNSolution_Writer * const &writer,
+        const PDNSolution * const &sol, const std::string &file_name ) const;
+
+    // ------------------------------------------------------------------------
+    // Write sol and dot_sol at the time step of time_info
+    // ------------------------------------------------------------------------
+    void Record_sol( PDNSolution_Writer * const &writer,
+        const PDNSolution * const &sol, const PDNSolution * const &dot_sol,
+        const PDNTimeStep * const &time_info ) const;
+
+    // ------------------------------------------------------------------------
+    // Lagrange extrapolation of the last predictor_order + 1 dot_sol in hist
+    // to the time new_time. Return false if hist does not hold enough data.
+    // ------------------------------------------------------------------------
+    bool Predict_polynomial( const PDNSolution_History * const &hist,
+        const double &new_time, PDNSolution * const &pred_dot_sol ) const;
+
+    // ------------------------------------------------------------------------
+    // Let H(n) denote the dot_sol at step n and N be the number of steps per
+    // cycle. The latest H(n) is projected onto B_j = H(n-N+j), j = -1, 0, 1,
+    // in the L2 sense, and the resulting coefficients c_j are applied to the
+    // snapshots one step later: pred = sum_j c_j H(n-N+j+1).
+    // Return false if hist does not hold a full cycle.
+    // ------------------------------------------------------------------------
+    bool Predict_POD( const PDNSolution_History * const &hist,
+        const int &cycle_steps, PDNSolution * const &pred_dot_sol ) const;
 };
 
 #endif
@@ -34,8 +34,17 @@ class VisDataPrep_NS : public IVisDataPrep
         const int &input_dof,
         double ** &solArrays ) const;
 
+    virtual void get_pointArray(
+        const std::string &solution_file_name,
+        const PostVectScatter * const &scatter,
+        double ** &solArrays ) const;
+
   private:
     std::vector<int> pt_array_len;
+
+    // Assign the pressure and velocity of the nodes in pvsolu to solArrays
+    void fill_pointArray( const PostVectSolution &pvsolu,
+        double ** &solArrays ) const;
 };
 
 #endif
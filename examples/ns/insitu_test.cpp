@@ -0,0 +1,241 @@
+// ============================================================================
+// insitu_test.cpp
+//
+// Smoke run of the in-situ output and WSS stages of the NS solver. A
+// partition file of a single Tet4 element with its face z = 0 as the wall
+// is written, the mesh objects are built from it and handed to the stages
+// in the same order as in driver.cpp, i.e., the stages are built from the
+// raw pointers before the objects are moved into their owner. The stages
+// are then executed for a few steps of the shear flow u = (z, 0, 0), and
+// the written velocity, vorticity (0, 1, 0), TAWSS mu, OSI 0, and
+// time-averaged WSS (-mu, 0, 0) are read back and checked, as well as the
+// number of steps in the XDMF index. A WSS stage whose start time is after
+// the last step has to finish without output.
+//
+// Usage: ./insitu_test (on one CPU)
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "Insitu_Output_NS.hpp"
+#include "Insitu_WSS_NS.hpp"
+#include "ViscosityModel_Newtonian.hpp"
+#include "HDF5_Reader.hpp"
+
+namespace
+{
+  const std::string part_name("insitu_test_part");
+
+  // Nodes of the unit Tet4
+  const std::vector<double> node_x { 0.0, 1.0, 0.0, 0.0 };
+  const std::vector<double> node_y { 0.0, 0.0, 1.0, 0.0 };
+  const std::vector<double> node_z { 0.0, 0.0, 0.0, 1.0 };
+
+  // --------------------------------------------------------------------------
+  // Write the partition file of the single element on rank 0, with the
+  // groups read by FEANode, ALocal_IEN, ALocal_Elem, APart_Node, and the
+  // ALocal_EBC of the wall.
+  // --------------------------------------------------------------------------
+  void write_partition()
+  {
+    const std::string fName = SYS_T::gen_partfile_name( part_name, 0 );
+
+    hid_t file_id = H5Fcreate( fName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+
+    auto h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+
+    hid_t group_id = H5Gcreate( file_id, "Global_Mesh_Info", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "nLocBas", 4 );
+    h5w -> write_intScalar( group_id, "dofNum", 4 );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "Local_Elem", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "nlocalele", 1 );
+    h5w -> write_intVector( group_id, "elem_loc", std::vector<int>{ 0 } );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "LIEN", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intMatrix( group_id, "LIEN", std::vector<int>{ 0, 1, 2, 3 }, 1, 4 );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "Local_Node", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "nlocalnode", 4 );
+    h5w -> write_intScalar( group_id, "nghostnode", 0 );
+    h5w -> write_intScalar( group_id, "nbadnode", 0 );
+    h5w -> write_intScalar( group_id, "nlocghonode", 4 );
+    h5w -> write_intScalar( group_id, "ntotalnode", 4 );
+    h5w -> write_intVector( group_id, "local_to_global", std::vector<int>{ 0, 1, 2, 3 } );
+    h5w -> write_intVector( group_id, "node_loc", std::vector<int>{ 0, 1, 2, 3 } );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "ctrlPts_loc", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_doubleVector( group_id, "ctrlPts_x_loc", node_x );
+    h5w -> write_doubleVector( group_id, "ctrlPts_y_loc", node_y );
+    h5w -> write_doubleVector( group_id, "ctrlPts_z_loc", node_z );
+    H5Gclose( group_id );
+
+    // The wall is the face of the nodes 0, 1, 2
+    group_id = H5Gcreate( file_id, "wall", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "num_ebc", 1 );
+    h5w -> write_intVector( group_id, "num_local_cell_node", std::vector<int>{ 3 } );
+    h5w -> write_intVector( group_id, "num_local_cell", std::vector<int>{ 1 } );
+    h5w -> write_intVector( group_id, "cell_nLocBas", std::vector<int>{ 3 } );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "wall/ebcid_0", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_doubleVector( group_id, "local_cell_node_xyz",
+        std::vector<double>{ 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0, 0.0 } );
+    h5w -> write_intVector( group_id, "local_cell_ien", std::vector<int>{ 0, 1, 2 } );
+    h5w -> write_intVector( group_id, "local_cell_node_vol_id", std::vector<int>{ 0, 1, 2 } );
+    h5w -> write_intVector( group_id, "local_cell_node_pos", std::vector<int>{ 0, 1, 2 } );
+    h5w -> write_intVector( group_id, "local_cell_vol_id", std::vector<int>{ 0 } );
+    H5Gclose( group_id );
+
+    h5w.reset(); H5Fclose( file_id );
+  }
+
+  // The mesh objects, owned after the stage is built as by PGAssem_NS_FEM
+  struct Mesh_Owner
+  {
+    std::unique_ptr<FEANode> fNode;
+    std::unique_ptr<ALocal_IEN> locIEN;
+    std::unique_ptr<ALocal_Elem> locElem;
+    std::unique_ptr<APart_Node> pNode;
+  };
+
+  // max | data - exact | over the num_node nodes for a data set of comp
+  // components
+  double read_error( const std::string &h5_name, const std::string &dname,
+      const int &num_node, const int &comp, const double * const &exact )
+  {
+    hid_t file_id = H5Fopen( h5_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+    auto h5r = SYS_T::make_unique<HDF5_Reader>( file_id );
+
+    int num_row, num_col;
+    const std::vector<double> data = h5r -> read_doubleMatrix( "/step_900000003", dname.c_str(), num_row, num_col );
+
+    h5r.reset(); H5Fclose( file_id );
+
+    double err = 0.0;
+    if( num_row != num_node || num_col != comp ) return 1.0;
+
+    for(int ii=0; ii<num_row*num_col; ++ii)
+      err = std::max( err, std::abs( data[ii] - exact[ii] ) );
+
+    return err;
+  }
+
+  // Number of the steps indexed in an XDMF file
+  int count_xmf_steps( const std::string &xmf_name )
+  {
+    std::ifstream xmf( xmf_name.c_str() );
+    std::string line;
+    int num = 0;
+    while( std::getline( xmf, line ) )
+      if( line.find("<Time ") != std::string::npos ) ++num;
+
+    return num;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+#if PETSC_VERSION_LT(3,19,0)
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULL);
+#else
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULLPTR);
+#endif
+
+  SYS_T::print_fatal_if( SYS_T::get_MPI_size() != 1, "Error: insitu_test runs on one CPU.\n" );
+
+  write_partition();
+
+  auto fNode   = SYS_T::make_unique<FEANode>( part_name, 0 );
+  auto locIEN  = SYS_T::make_unique<ALocal_IEN>( part_name, 0 );
+  auto locElem = SYS_T::make_unique<ALocal_Elem>( part_name, 0 );
+  auto pNode   = SYS_T::make_unique<APart_Node>( part_name, 0 );
+
+  const double mu = 3.5e-2;
+
+  // Build the stages as the driver does, then move the mesh into the owner
+  auto insitu = SYS_T::make_unique<Insitu_Output_NS>( "insitu_test_sol", 1,
+      fNode.get(), locIEN.get(), locElem.get(), pNode.get(), FEType::Tet4, 5,
+      true, false );
+
+  auto wss = SYS_T::make_unique<Insitu_WSS_NS>( "insitu_test_wss", part_name, 0,
+      1, 0.0, SYS_T::make_unique<ViscosityModel_Newtonian>( mu ), fNode.get(),
+      locIEN.get(), locElem.get(), pNode.get(), FEType::Tet4 );
+
+  auto wss_late = SYS_T::make_unique<Insitu_WSS_NS>( "insitu_test_wss_late", part_name, 0,
+      1, 10.0, SYS_T::make_unique<ViscosityModel_Newtonian>( mu ), fNode.get(),
+      locIEN.get(), locElem.get(), pNode.get(), FEType::Tet4 );
+
+  const Mesh_Owner owner { std::move(fNode), std::move(locIEN),
+    std::move(locElem), std::move(pNode) };
+
+  insitu -> print_info();
+  wss -> print_info();
+
+  // The shear flow u = (z, 0, 0) with zero pressure
+  auto sol = SYS_T::make_unique<PDNSolution>( owner.pNode.get(), 4 );
+  for(int ii=0; ii<4; ++ii)
+    VecSetValue( sol->solution, 4*ii+1, node_z[ii], INSERT_VALUES );
+  VecAssemblyBegin( sol->solution ); VecAssemblyEnd( sol->solution );
+  sol->GhostUpdate();
+
+  const PDNTimeStep final_info( 3, 0.3, 0.1 );
+
+  for(int step=1; step<=3; ++step)
+  {
+    const PDNTimeStep time_info( step, 0.1 * step, 0.1 );
+    insitu -> Execute( sol.get(), &time_info );
+    wss -> Accumulate( sol.get(), &time_info );
+    wss_late -> Accumulate( sol.get(), &time_info );
+  }
+
+  wss -> Write( &final_info );
+  wss_late -> Write( &final_info );
+
+  double exact_velo[12], exact_vort[12];
+  for(int ii=0; ii<4; ++ii)
+  {
+    exact_velo[3*ii] = node_z[ii]; exact_velo[3*ii+1] = 0.0; exact_velo[3*ii+2] = 0.0;
+    exact_vort[3*ii] = 0.0; exact_vort[3*ii+1] = 1.0; exact_vort[3*ii+2] = 0.0;
+  }
+
+  const double exact_tawss[3] { mu, mu, mu }, exact_osi[3] { 0.0, 0.0, 0.0 };
+  const double exact_wss[9] { -mu, 0.0, 0.0, -mu, 0.0, 0.0, -mu, 0.0, 0.0 };
+
+  const double err_velo = read_error( "insitu_test_sol_p0.h5", "Velocity", 4, 3, exact_velo );
+  const double err_vort = read_error( "insitu_test_sol_p0.h5", "Vorticity", 4, 3, exact_vort );
+
+  const double err_tawss = read_error( "insitu_test_wss_p0.h5", "TAWSS", 3, 1, exact_tawss );
+  const double err_osi   = read_error( "insitu_test_wss_p0.h5", "OSI", 3, 1, exact_osi );
+  const double err_wss   = read_error( "insitu_test_wss_p0.h5", "Time_averaged_WSS", 3, 3, exact_wss );
+
+  // The steps 2 and 3 are appended to the index written in the step 1
+  const int num_xmf_step = count_xmf_steps( "insitu_test_sol.xmf" );
+
+  // The stage without samples does not write its file
+  std::ifstream late_file( "insitu_test_wss_late_p0.h5" );
+  const bool is_late_written = late_file.good();
+
+  std::cout<<"velocity error "<<err_velo<<", vorticity error "<<err_vort<<'\n';
+  std::cout<<"TAWSS error "<<err_tawss<<", OSI error "<<err_osi
+    <<", time-averaged WSS error "<<err_wss<<'\n';
+  std::cout<<"indexed steps "<<num_xmf_step<<'\n';
+  std::cout<<"WSS without samples written: "<<( is_late_written ? "yes" : "no" )<<'\n';
+
+  const bool is_passed = err_velo < 1.0e-12 && err_vort < 1.0e-12
+    && err_tawss < 1.0e-12 && err_osi < 1.0e-12 && err_wss < 1.0e-12
+    && num_xmf_step == 3 && !is_late_written;
+
+  std::cout<<( is_passed ? "PASSED" : "FAILED" )<<'\n';
+
+  insitu.reset(); wss.reset(); wss_late.reset(); sol.reset();
+
+  PetscFinalize();
+
+  return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// EOF
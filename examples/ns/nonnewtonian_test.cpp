@@ -0,0 +1,215 @@
+// ============================================================================
+// nonnewtonian_test.cpp
+//
+// Consistency checks of the local assembly for generalized Newtonian fluids
+// on a single perturbed Tet4 and Hex8 element with a random solution.
+//
+// 1. With the Newtonian viscosity model, PLocAssem_VMS_NS_GenAlpha_NonNewtonian
+//    has to reproduce the residual, tangent, and mass residual of
+//    PLocAssem_VMS_NS_GenAlpha bitwise.
+// 2. With the Carreau and power-law models, the tangent added through the
+//    velocity dependence of mu is compared with the central finite
+//    difference of the mass residual, which contains the Galerkin viscous
+//    term only. The contribution of the remaining terms is removed by
+//    subtracting the same difference with mu frozen.
+//
+// Usage: ./nonnewtonian_test
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include <random>
+#include "PLocAssem_VMS_NS_GenAlpha_NonNewtonian.hpp"
+#include "ViscosityModel_Newtonian.hpp"
+#include "ViscosityModel_Carreau.hpp"
+#include "ViscosityModel_Power_Law.hpp"
+
+namespace
+{
+  // Expose the viscosity hooks of the non-Newtonian assembly
+  class NonNewtonian_Probe : public PLocAssem_VMS_NS_GenAlpha_NonNewtonian
+  {
+    public:
+      using PLocAssem_VMS_NS_GenAlpha_NonNewtonian::PLocAssem_VMS_NS_GenAlpha_NonNewtonian;
+
+      // If true, mu and dmu_dI2 of the previous element evaluation are kept
+      bool is_frozen = false;
+
+      // Tangent = derivative of the Galerkin viscous term through mu only
+      void Assem_Viscosity_Tangent( const double * const &sol,
+          const double * const &eleCtrlPts_x,
+          const double * const &eleCtrlPts_y,
+          const double * const &eleCtrlPts_z )
+      {
+        elementv->buildBasis( quadv.get(), eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
+
+        eval_viscosity( sol );
+
+        Zero_Tangent_Residual();
+
+        std::vector<double> dR_dx(nLocBas, 0.0), dR_dy(nLocBas, 0.0), dR_dz(nLocBas, 0.0);
+
+        for(int qua=0; qua<nqpv; ++qua)
+        {
+          elementv->get_gradR( qua, &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+
+          add_viscosity_tangent( qua, elementv->get_detJac(qua) * quadv->get_qw(qua),
+              &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+        }
+      }
+
+    protected:
+      virtual void eval_viscosity( const double * const &sol )
+      {
+        if( !is_frozen ) PLocAssem_VMS_NS_GenAlpha_NonNewtonian::eval_viscosity( sol );
+      }
+  };
+
+  struct Test_Element
+  {
+    FEType type;
+    int nqp_v, nqp_s;
+    std::vector<double> x, y, z;
+  };
+
+  // Unit Tet4 and Hex8 with perturbed nodes
+  std::vector<Test_Element> gen_elements( std::mt19937 &gen )
+  {
+    std::uniform_real_distribution<double> perturb( -0.1, 0.1 );
+
+    std::vector<Test_Element> elem {
+      { FEType::Tet4, 5, 4, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1} },
+      { FEType::Hex8, 27, 9, {0, 1, 1, 0, 0, 1, 1, 0}, {0, 0, 1, 1, 0, 0, 1, 1},
+        {0, 0, 0, 0, 1, 1, 1, 1} } };
+
+    for(auto &ee : elem)
+    {
+      for(auto &val : ee.x) val += perturb( gen );
+      for(auto &val : ee.y) val += perturb( gen );
+      for(auto &val : ee.z) val += perturb( gen );
+    }
+
+    return elem;
+  }
+
+  double max_abs( const int &num, const double * const &aa )
+  {
+    double val = 0.0;
+    for(int ii=0; ii<num; ++ii) val = std::max( val, std::abs( aa[ii] ) );
+    return val;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+#if PETSC_VERSION_LT(3,19,0)
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULL);
+#else
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULLPTR);
+#endif
+
+  const double rho = 1.065, mu = 3.5e-2, beta = 0.2, dt = 1.0e-2;
+
+  const TimeMethod_GenAlpha tm_galpha( 0.5, false );
+
+  std::mt19937 gen( 2026 );
+  std::uniform_real_distribution<double> dist( -1.0, 1.0 );
+
+  bool is_passed = true;
+
+  for(const auto &ee : gen_elements( gen ))
+  {
+    const int nLocBas = static_cast<int>( ee.x.size() );
+    const int vec_size = 4 * nLocBas;
+
+    std::vector<double> sol( vec_size ), dot_sol( vec_size );
+    for(int ii=0; ii<vec_size; ++ii) { sol[ii] = dist( gen ); dot_sol[ii] = dist( gen ); }
+
+    // 1. Newtonian model against the constant-viscosity assembly
+    PLocAssem_VMS_NS_GenAlpha base( ee.type, ee.nqp_v, ee.nqp_s, &tm_galpha,
+        rho, mu, beta );
+
+    PLocAssem_VMS_NS_GenAlpha_NonNewtonian newt( ee.type, ee.nqp_v, ee.nqp_s,
+        &tm_galpha, rho, SYS_T::make_unique<ViscosityModel_Newtonian>( mu ), beta );
+
+    bool is_equal = true;
+
+    base.Assem_Residual( 0.0, dt, &dot_sol[0], &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    newt.Assem_Residual( 0.0, dt, &dot_sol[0], &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    is_equal = is_equal && std::equal( base.Residual, base.Residual + vec_size, newt.Residual );
+
+    base.Assem_Tangent_Residual( 0.0, dt, &dot_sol[0], &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    newt.Assem_Tangent_Residual( 0.0, dt, &dot_sol[0], &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    is_equal = is_equal && std::equal( base.Residual, base.Residual + vec_size, newt.Residual );
+    is_equal = is_equal && std::equal( base.Tangent, base.Tangent + vec_size * vec_size, newt.Tangent );
+
+    base.Assem_Mass_Residual( &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    newt.Assem_Mass_Residual( &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+    is_equal = is_equal && std::equal( base.Residual, base.Residual + vec_size, newt.Residual );
+
+    std::cout<<"nLocBas "<<nLocBas<<", Newtonian model bitwise identical: "
+      <<( is_equal ? "yes" : "NO" )<<'\n';
+
+    is_passed = is_passed && is_equal;
+
+    // 2. Finite-difference tangent of the viscosity models
+    std::vector< std::unique_ptr<IViscosityModel> > models {};
+    models.push_back( SYS_T::make_unique<ViscosityModel_Carreau>( 3.45e-2, 0.56, 3.313, 0.3568, false ) );
+    models.push_back( SYS_T::make_unique<ViscosityModel_Carreau>( 3.45e-2, 0.56, 3.313, 0.3568, true ) );
+    models.push_back( SYS_T::make_unique<ViscosityModel_Power_Law>( 0.35, 0.6, 10.0, 1.0e-3 ) );
+
+    for(auto &model : models)
+    {
+      const std::string name = model->get_model_name();
+
+      NonNewtonian_Probe probe( ee.type, ee.nqp_v, ee.nqp_s, &tm_galpha, rho,
+          std::move(model), beta );
+
+      probe.Assem_Viscosity_Tangent( &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+      const std::vector<double> tangent( probe.Tangent, probe.Tangent + vec_size * vec_size );
+
+      const double hh = 1.0e-6;
+      double err = 0.0;
+      for(int B=0; B<nLocBas; ++B)
+      {
+        for(int jj=1; jj<4; ++jj)
+        {
+          // d Residual / d sol[4B+jj] with mu evaluated at the perturbed
+          // solution, minus the same with mu frozen at sol
+          std::vector<double> fd( vec_size, 0.0 );
+          for(int sign=-1; sign<=1; sign+=2)
+          {
+            std::vector<double> sol_h( sol );
+            sol_h[4*B+jj] += sign * hh;
+
+            probe.is_frozen = false;
+            probe.Assem_Mass_Residual( &sol_h[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+            for(int ii=0; ii<vec_size; ++ii) fd[ii] += sign * probe.Residual[ii];
+
+            probe.Assem_Mass_Residual( &sol[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+            probe.is_frozen = true;
+            probe.Assem_Mass_Residual( &sol_h[0], &ee.x[0], &ee.y[0], &ee.z[0] );
+            for(int ii=0; ii<vec_size; ++ii) fd[ii] -= sign * probe.Residual[ii];
+          }
+
+          for(int ii=0; ii<vec_size; ++ii)
+            err = std::max( err, std::abs( tangent[vec_size*ii + 4*B+jj] - 0.5 * fd[ii] / hh ) );
+        }
+      }
+
+      const double scale = std::max( max_abs( vec_size * vec_size, &tangent[0] ), 1.0e-12 );
+
+      std::cout<<"nLocBas "<<nLocBas<<", "<<name<<" tangent of mu: max "<<scale
+        <<", finite difference error "<<err<<'\n';
+
+      is_passed = is_passed && ( err < 1.0e-6 * scale );
+    }
+  }
+
+  std::cout<<( is_passed ? "PASSED" : "FAILED" )<<'\n';
+
+  PetscFinalize();
+
+  return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// EOF
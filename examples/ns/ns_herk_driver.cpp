@@ -58,6 +58,7 @@ int main(int argc, char *argv[])
   int initial_index = 0;     // indiex of the initial condition
   double final_time = 1.0;   // final time
   std::string sol_bName("SOL_"); // base name of the solution file
+  std::string perf_trace_file(""); // per-step timing trace, disabled if empty
   int sol_record_freq = 1;   // frequency of recording the solution
 
   // Restart options
@@ -111,6 +112,7 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt("-init_index", initial_index);
   SYS_T::GetOptionInt("-sol_rec_freq", sol_record_freq);
   SYS_T::GetOptionString("-sol_name", sol_bName);
+  SYS_T::GetOptionString("-perf_trace_file", perf_trace_file);
   SYS_T::GetOptionBool("-is_restart", is_restart);
   SYS_T::GetOptionInt("-restart_index", restart_index);
   SYS_T::GetOptionReal("-restart_time", restart_time);
@@ -138,6 +140,8 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-fina_time:", final_time);
   SYS_T::cmdPrint("-sol_rec_freq:", sol_record_freq);
   SYS_T::cmdPrint("-sol_name:", sol_bName);
+  if( !perf_trace_file.empty() )
+    SYS_T::cmdPrint("-perf_trace_file:", perf_trace_file);
   if(is_restart)
   {
     SYS_T::commPrint("-is_restart: true \n");
@@ -344,6 +348,8 @@ int main(int argc, char *argv[])
 
   MPI_Barrier(PETSC_COMM_WORLD);
 
+  SYS_T::Perf_Registry::instance().set_trace_file( perf_trace_file );
+
   // ===== FEM analysis =====
   SYS_T::commPrint("===> Start Finite Element Analysis:\n");
   tsolver->TM_NS_HERK(is_restart, std::move(sol), std::move(velo), std::move(dot_velo), 
@@ -354,6 +360,8 @@ int main(int argc, char *argv[])
   solverCtx -> lsolver_A -> print_info();
   solverCtx -> lsolver_S -> print_info();
 
+  SYS_T::Perf_Registry::instance().print_summary();
+
   MatDestroy(&S_approx);
   MatDestroy(&K_shell);
   PCDestroy(&pc_shell);
@@ -235,6 +235,9 @@ int main( int argc, char * argv[] )
 
   // Setup weakly enforced Dirichlet BC on wall if wall_model_type > 0
   ElemBC * wbc = new ElemBC_3D_WallModel( weak_list, wall_model_type, IEN, elemType );
+
+  // Setup the wall cells for the in-situ wall shear stress
+  ElemBC * wall_ebc = new ElemBC_3D( {sur_file_wall}, elemType );
  
   // Start partition the mesh for each cpu_rank 
 
@@ -281,6 +284,11 @@ int main( int argc, char * argv[] )
 
     wbcpart -> write_hdf5( part_file );
 
+    // Partition the wall cells and write to h5 file in group /wall
+    auto wallpart = SYS_T::make_unique<EBC_Partition>(part.get(), mnindex, wall_ebc);
+
+    wallpart -> write_hdf5( part_file, "/wall" );
+
     // Collect partition statistics
     list_nlocalnode.push_back(part->get_nlocalnode());
     list_nghostnode.push_back(part->get_nghostnode());
@@ -308,7 +316,7 @@ int main( int argc, char * argv[] )
   // Finalize the code and exit
   for(auto &it_nbc : NBC_list) delete it_nbc;
 
-  delete InFBC; delete ebc; delete wbc;
+  delete InFBC; delete ebc; delete wbc; delete wall_ebc;
   delete mnindex; delete global_part; delete IEN;
 
   return EXIT_SUCCESS;
@@ -0,0 +1,201 @@
+#include "Checkpoint_NS.hpp"
+
+Checkpoint_NS::Checkpoint_NS( const std::string &in_bname, const int &in_freq,
+    const std::string &node_mapping_file )
+: bname( in_bname ), freq( in_freq ),
+  sol_h5( SYS_T::make_unique<PDNSolution_HDF5>(
+        std::vector<std::string>{"pressure", "velocity"}, std::vector<int>{1, 3},
+        node_mapping_file ) )
+{
+  SYS_T::print_fatal_if( freq <= 0, "Error: Checkpoint_NS the checkpoint frequency should be positive.\n" );
+}
+
+void Checkpoint_NS::Write( const PDNSolution * const &sol,
+    const PDNSolution * const &dot_sol,
+    const PDNTimeStep * const &time_info,
+    const IGenBC * const &gbc,
+    const std::vector<std::string> &flow_files ) const
+{
+  if( time_info->get_index() % freq != 0 ) return;
+
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  const std::string file_name = bname + ".h5";
+  const std::string tmp_name  = file_name + ".tmp";
+
+  sol_h5 -> Write( tmp_name, {"sol", "dot_sol"}, {sol, dot_sol},
+      time_info->get_time(), time_info->get_index() );
+
+  if( SYS_T::get_MPI_rank() == 0 )
+  {
+    Write_solver( tmp_name, time_info, gbc, flow_files );
+
+    SYS_T::print_fatal_if( std::rename( tmp_name.c_str(), file_name.c_str() ) != 0,
+        "Error: Checkpoint_NS cannot rename %s.\n", tmp_name.c_str() );
+  }
+
+  MPI_Barrier( PETSC_COMM_WORLD );
+
+  SYS_T::commPrint("     Checkpoint written into %s at index %d \n",
+      file_name.c_str(), time_info->get_index());
+}
+
+void Checkpoint_NS::Write_solver( const std::string &file_name,
+    const PDNTimeStep * const &time_info,
+    const IGenBC * const &gbc,
+    const std::vector<std::string> &flow_files ) const
+{
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: Checkpoint_NS cannot open %s.\n", file_name.c_str() );
+
+  hid_t group_id = H5Gcreate( file_id, "solver", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+  auto h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+
+  h5w -> write_intScalar( group_id, "time_index", time_info->get_index() );
+  h5w -> write_doubleScalar( group_id, "time", time_info->get_time() );
+  h5w -> write_doubleScalar( group_id, "step", time_info->get_step() );
+
+  // GenBC states of all faces stored one after another
+  const int num_ebc = gbc -> get_num_ebc();
+
+  std::vector<int> state_size( num_ebc, 0 );
+  std::vector<double> state {};
+  for(int ff=0; ff<num_ebc; ++ff)
+  {
+    const std::vector<double> face_state = gbc -> get_state( ff );
+    state_size[ff] = VEC_T::get_size( face_state );
+    VEC_T::insert_end( state, face_state );
+  }
+
+  h5w -> write_intScalar( group_id, "num_ebc", num_ebc );
+  if( num_ebc > 0 ) h5w -> write_intVector( group_id, "genbc_state_size", state_size );
+  if( !state.empty() ) h5w -> write_doubleVector( group_id, "genbc_state", state );
+
+  // Sizes of the flow files at this step
+  const int num_flow_file = VEC_T::get_size( flow_files );
+
+  std::vector<int> file_size( num_flow_file, 0 );
+  for(int ii=0; ii<num_flow_file; ++ii)
+  {
+    const std::string dname = "flow_file_" + std::to_string(ii);
+    h5w -> write_string( group_id, dname.c_str(), flow_files[ii] );
+    file_size[ii] = get_file_size( flow_files[ii] );
+  }
+
+  h5w -> write_intScalar( group_id, "num_flow_file", num_flow_file );
+  if( num_flow_file > 0 ) h5w -> write_intVector( group_id, "flow_file_size", file_size );
+
+  H5Gclose( group_id );
+  H5Fclose( file_id );
+}
+
+void Checkpoint_NS::Read_time_info( const std::string &file_name,
+    int &time_index, double &time, double &step )
+{
+  SYS_T::file_check( file_name );
+
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+  auto h5r = SYS_T::make_unique<HDF5_Reader>( file_id );
+
+  time_index = h5r -> read_intScalar( "solver", "time_index" );
+  time       = h5r -> read_doubleScalar( "solver", "time" );
+  step       = h5r -> read_doubleScalar( "solver", "step" );
+
+  H5Fclose( file_id );
+}
+
+void Checkpoint_NS::Read( const std::string &file_name,
+    PDNSolution * const &sol, PDNSolution * const &dot_sol,
+    const std::string &node_mapping_file )
+{
+  SYS_T::file_check( file_name );
+
+  const PDNSolution_HDF5 reader( std::vector<std::string>{"pressure", "velocity"},
+      std::vector<int>{1, 3}, node_mapping_file );
+
+  reader.Read( file_name, "sol", sol );
+  reader.Read( file_name, "dot_sol", dot_sol );
+}
+
+void Checkpoint_NS::Restore( const std::string &file_name, IGenBC * const &gbc )
+{
+  SYS_T::file_check( file_name );
+
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+  auto h5r = SYS_T::make_unique<HDF5_Reader>( file_id );
+
+  const int num_ebc = h5r -> read_intScalar( "solver", "num_ebc" );
+
+  SYS_T::print_fatal_if( num_ebc != gbc->get_num_ebc(),
+      "Error: Checkpoint_NS the GenBC of %s has %d faces.\n", file_name.c_str(), num_ebc );
+
+  if( num_ebc > 0 )
+  {
+    std::vector<int> state_size = h5r -> read_intVector( "solver", "genbc_state_size" );
+
+    std::vector<double> state {};
+    if( VEC_T::sum( state_size ) > 0 ) state = h5r -> read_doubleVector( "solver", "genbc_state" );
+
+    int offset = 0;
+    for(int ff=0; ff<num_ebc; ++ff)
+    {
+      gbc -> set_state( ff, std::vector<double>( state.begin() + offset,
+            state.begin() + offset + state_size[ff] ) );
+      offset += state_size[ff];
+    }
+  }
+
+  // Drop the lines written after the checkpoint from the flow files
+  const int num_flow_file = h5r -> read_intScalar( "solver", "num_flow_file" );
+
+  if( SYS_T::get_MPI_rank() == 0 && num_flow_file > 0 )
+  {
+    const std::vector<int> file_size = h5r -> read_intVector( "solver", "flow_file_size" );
+
+    for(int ii=0; ii<num_flow_file; ++ii)
+    {
+      const std::string dname = "flow_file_" + std::to_string(ii);
+      const std::string flow_file = h5r -> read_string( "solver", dname.c_str() );
+
+      std::ifstream ifile( flow_file, std::ios::binary );
+      std::string content( (std::istreambuf_iterator<char>(ifile)), std::istreambuf_iterator<char>() );
+      ifile.close();
+
+      SYS_T::print_fatal_if( static_cast<int>( content.size() ) < file_size[ii],
+          "Error: Checkpoint_NS %s is shorter than at the checkpoint.\n", flow_file.c_str() );
+
+      std::ofstream ofile( flow_file, std::ios::binary | std::ios::trunc );
+      ofile.write( content.data(), file_size[ii] );
+      ofile.close();
+    }
+  }
+
+  H5Fclose( file_id );
+
+  MPI_Barrier( PETSC_COMM_WORLD );
+}
+
+int Checkpoint_NS::get_file_size( const std::string &file_name )
+{
+  std::ifstream ifile( file_name, std::ios::binary | std::ios::ate );
+
+  if( !ifile.is_open() ) return 0;
+
+  return static_cast<int>( ifile.tellg() );
+}
+
+void Checkpoint_NS::print_info() const
+{
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+  SYS_T::commPrint("Checkpoint: \n");
+  SYS_T::commPrint("  file: %s.h5 \n", bname.c_str());
+  SYS_T::commPrint("  checkpoint frequency: %d \n", freq);
+  SYS_T::commPrint("  state: sol, dot_sol, time step, GenBC, flow files \n");
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+}
+
+// EOF
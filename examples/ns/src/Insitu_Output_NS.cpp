@@ -0,0 +1,166 @@
+#include "Insitu_Output_NS.hpp"
+
+Insitu_Output_NS::Insitu_Output_NS( const std::string &in_bname,
+    const int &in_freq,
+    const FEANode * const &in_fnode,
+    const ALocal_IEN * const &in_lien,
+    const ALocal_Elem * const &lelem_ptr,
+    const APart_Node * const &pnode_ptr,
+    const FEType &elemType, const int &nqp_vol,
+    const bool &in_is_vorticity, const bool &isRestart )
+: bname( in_bname ), freq( in_freq ), nLocBas( in_lien->get_stride() ),
+  nlocalele( lelem_ptr->get_nlocalele() ),
+  nlocghonode( pnode_ptr->get_nlocghonode() ),
+  is_vorticity( in_is_vorticity ), fnode( in_fnode ), lien( in_lien ),
+  quad( QuadPtsFactory::createVolQuadrature(elemType, nqp_vol) ),
+  element( ElementFactory::createVolElement(elemType, nqp_vol) ),
+  proj( SYS_T::make_unique<PDNSolution>(pnode_ptr, 4) ),
+  writer( SYS_T::make_unique<XDMF_Writer>( in_bname, in_fnode, in_lien,
+        lelem_ptr, elemType, pnode_ptr->get_nlocghonode(),
+        std::vector<int>{}, isRestart ) )
+{
+  SYS_T::print_fatal_if( freq <= 0, "Error: Insitu_Output_NS the output frequency should be positive.\n" );
+}
+
+void Insitu_Output_NS::Execute( const PDNSolution * const &sol,
+    const PDNTimeStep * const &time_info ) const
+{
+  if( time_info->get_index() % freq != 0 ) return;
+
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  SYS_T::print_fatal_if( sol->get_dof_num() != 4,
+      "Error: Insitu_Output_NS requires the NS solution with 4 dofs.\n" );
+
+  const std::vector<double> array = sol -> GetLocalArray();
+
+  std::vector<double> pres( nlocghonode, 0.0 ), velo( 3 * nlocghonode, 0.0 );
+  for(int ii=0; ii<nlocghonode; ++ii)
+  {
+    pres[ii]       = array[4*ii+0];
+    velo[3*ii + 0] = array[4*ii+1];
+    velo[3*ii + 1] = array[4*ii+2];
+    velo[3*ii + 2] = array[4*ii+3];
+  }
+
+  std::vector<std::string> names { "Pressure", "Velocity" };
+  std::vector<int> comps { 1, 3 };
+  std::vector<const double *> pointArrays { pres.data(), velo.data() };
+
+  std::vector<double> vort {};
+  if( is_vorticity )
+  {
+    Average_vorticity( array, vort );
+
+    names.push_back( "Vorticity" );
+    comps.push_back( 3 );
+    pointArrays.push_back( vort.data() );
+  }
+
+  writer -> write_step( time_info->get_index(), time_info->get_time(),
+      names, comps, pointArrays.data() );
+}
+
+void Insitu_Output_NS::Average_vorticity( const std::vector<double> &array,
+    std::vector<double> &vort ) const
+{
+  const int nqp = quad -> get_num_quadPts();
+
+  std::vector<double> R( nLocBas, 0.0 ), dR_dx( nLocBas, 0.0 ),
+    dR_dy( nLocBas, 0.0 ), dR_dz( nLocBas, 0.0 );
+
+  std::vector<double> ectrl_x( nLocBas, 0.0 ), ectrl_y( nLocBas, 0.0 ),
+    ectrl_z( nLocBas, 0.0 );
+
+  // Integral of the vorticity and the volume of the elements attached to
+  // the local and ghost nodes
+  std::vector<double> moment( 4 * nlocghonode, 0.0 );
+
+  for(int ee=0; ee<nlocalele; ++ee)
+  {
+    const std::vector<int> IEN_e = lien -> get_LIEN( ee );
+
+    fnode -> get_ctrlPts_xyz( nLocBas, &IEN_e[0], &ectrl_x[0], &ectrl_y[0], &ectrl_z[0] );
+
+    element -> buildBasis( quad.get(), &ectrl_x[0], &ectrl_y[0], &ectrl_z[0] );
+
+    double omega_x = 0.0, omega_y = 0.0, omega_z = 0.0, vol = 0.0;
+
+    for(int qua=0; qua<nqp; ++qua)
+    {
+      element -> get_R_gradR( qua, &R[0], &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+
+      double u_y = 0.0, u_z = 0.0, v_x = 0.0, v_z = 0.0, w_x = 0.0, w_y = 0.0;
+      for(int ii=0; ii<nLocBas; ++ii)
+      {
+        const int pos = 4 * IEN_e[ii];
+        u_y += array[pos+1] * dR_dy[ii];
+        u_z += array[pos+1] * dR_dz[ii];
+        v_x += array[pos+2] * dR_dx[ii];
+        v_z += array[pos+2] * dR_dz[ii];
+        w_x += array[pos+3] * dR_dx[ii];
+        w_y += array[pos+3] * dR_dy[ii];
+      }
+
+      const double gwts = element->get_detJac(qua) * quad->get_qw(qua);
+
+      omega_x += gwts * ( w_y - v_z );
+      omega_y += gwts * ( u_z - w_x );
+      omega_z += gwts * ( v_x - u_y );
+      vol     += gwts;
+    }
+
+    for(int ii=0; ii<nLocBas; ++ii)
+    {
+      const int pos = 4 * IEN_e[ii];
+      moment[pos+0] += omega_x;
+      moment[pos+1] += omega_y;
+      moment[pos+2] += omega_z;
+      moment[pos+3] += vol;
+    }
+  }
+
+  // Add the ghost contributions to their owners and send the sums back
+  Vec lsol;
+  double * lval;
+  VecGhostGetLocalForm( proj->solution, &lsol );
+  VecGetArray( lsol, &lval );
+  for(int ii=0; ii<4*nlocghonode; ++ii) lval[ii] = moment[ii];
+  VecRestoreArray( lsol, &lval );
+  VecGhostRestoreLocalForm( proj->solution, &lsol );
+
+  VecGhostUpdateBegin( proj->solution, ADD_VALUES, SCATTER_REVERSE );
+  VecGhostUpdateEnd( proj->solution, ADD_VALUES, SCATTER_REVERSE );
+
+  proj -> GhostUpdate();
+
+  const std::vector<double> sum = proj -> GetLocalArray();
+
+  vort.assign( 3 * nlocghonode, 0.0 );
+  for(int ii=0; ii<nlocghonode; ++ii)
+  {
+    // Nodes not attached to any local element keep zero
+    if( sum[4*ii+3] > 0.0 )
+    {
+      const double inv_vol = 1.0 / sum[4*ii+3];
+      vort[3*ii+0] = sum[4*ii+0] * inv_vol;
+      vort[3*ii+1] = sum[4*ii+1] * inv_vol;
+      vort[3*ii+2] = sum[4*ii+2] * inv_vol;
+    }
+  }
+}
+
+void Insitu_Output_NS::print_info() const
+{
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+  SYS_T::commPrint("In-situ output: \n");
+  SYS_T::commPrint("  time series: %s.xmf \n", bname.c_str());
+  SYS_T::commPrint("  output frequency: %d \n", freq);
+  if( is_vorticity )
+    SYS_T::commPrint("  fields: Pressure, Velocity, Vorticity \n");
+  else
+    SYS_T::commPrint("  fields: Pressure, Velocity \n");
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+}
+
+// EOF
@@ -0,0 +1,282 @@
+#include "Insitu_WSS_NS.hpp"
+
+Insitu_WSS_NS::Insitu_WSS_NS( const std::string &in_bname,
+    const std::string &part_file, const int &rank,
+    const int &in_freq, const double &in_start_time,
+    std::unique_ptr<IViscosityModel> in_vismodel,
+    const FEANode * const &in_fnode,
+    const ALocal_IEN * const &in_lien,
+    const ALocal_Elem * const &lelem_ptr,
+    const APart_Node * const &pnode_ptr,
+    const FEType &in_elemType )
+: bname( in_bname ), part_name( part_file ), freq( in_freq ),
+  start_time( in_start_time ), vismodel( std::move(in_vismodel) ), elemType( in_elemType ),
+  nLocBas( in_lien->get_stride() ),
+  nlocghonode( pnode_ptr->get_nlocghonode() ),
+  fnode( in_fnode ), lien( in_lien ),
+  wall( SYS_T::make_unique<ALocal_EBC>(part_file, rank, "/wall") ),
+  num_cell( wall->get_num_local_cell(0) ),
+  cell_nLocBas( wall->get_cell_nLocBas(0) ),
+  num_node( wall->get_num_local_cell_node(0) ),
+  quad( QuadPtsFactory::createVisQuadrature(in_elemType) ),
+  element( ElementFactory::createVolElement(in_elemType, quad->get_num_quadPts()) ),
+  proj( SYS_T::make_unique<PDNSolution>(pnode_ptr, 4) ),
+  num_sample( 0 ), sum_mag( num_node, 0.0 ), sum_wss( 3 * num_node, 0.0 )
+{
+  SYS_T::print_fatal_if( freq <= 0, "Error: Insitu_WSS_NS the sampling frequency should be positive.\n" );
+
+  SYS_T::print_fatal_if( wall->get_num_ebc() != 1, "Error: Insitu_WSS_NS requires a single wall surface in %s.\n", part_file.c_str() );
+
+  SYS_T::print_fatal_if( quad->get_num_quadPts() != nLocBas, "Error: Insitu_WSS_NS the visualization points are not the element nodes.\n" );
+
+  // Global to local index of the volume elements of the partition
+  std::map<int, int> elem_g2l {};
+  for(int ee=0; ee<lelem_ptr->get_nlocalele(); ++ee)
+    elem_g2l[ lelem_ptr->get_elem_loc(ee) ] = ee;
+
+  cell_elem.resize( num_cell );
+  cell_node_loc.resize( num_cell * cell_nLocBas );
+
+  for(int ee=0; ee<num_cell; ++ee)
+  {
+    const auto it = elem_g2l.find( wall->get_local_cell_vol_id(0, ee) );
+
+    SYS_T::print_fatal_if( it == elem_g2l.end(), "Error: Insitu_WSS_NS the wall cell %d is not attached to a local element.\n", ee );
+
+    cell_elem[ee] = it->second;
+
+    const std::vector<int> IEN_v = lien -> get_LIEN( cell_elem[ee] );
+
+    for(int ii=0; ii<cell_nLocBas; ++ii)
+    {
+      const int pos = wall -> get_local_cell_node_pos( 0, wall->get_local_cell_ien(0, ee*cell_nLocBas+ii) );
+
+      cell_node_loc[ee*cell_nLocBas+ii] = VEC_T::get_pos( IEN_v, pos );
+
+      SYS_T::print_fatal_if( cell_node_loc[ee*cell_nLocBas+ii] < 0, "Error: Insitu_WSS_NS the wall cell %d does not match its volume element.\n", ee );
+    }
+  }
+}
+
+void Insitu_WSS_NS::Accumulate( const PDNSolution * const &sol,
+    const PDNTimeStep * const &time_info )
+{
+  if( time_info->get_index() % freq != 0 || time_info->get_time() < start_time ) return;
+
+  SYS_T::print_fatal_if( sol->get_dof_num() != 4,
+      "Error: Insitu_WSS_NS requires the NS solution with 4 dofs.\n" );
+
+  std::vector<double> wss {};
+  Compute_wss( sol->GetLocalArray(), wss );
+
+  for(int ii=0; ii<num_node; ++ii)
+  {
+    sum_mag[ii] += std::sqrt( wss[3*ii]*wss[3*ii] + wss[3*ii+1]*wss[3*ii+1] + wss[3*ii+2]*wss[3*ii+2] );
+
+    sum_wss[3*ii+0] += wss[3*ii+0];
+    sum_wss[3*ii+1] += wss[3*ii+1];
+    sum_wss[3*ii+2] += wss[3*ii+2];
+  }
+
+  num_sample += 1;
+}
+
+void Insitu_WSS_NS::Compute_wss( const std::vector<double> &array,
+    std::vector<double> &wss ) const
+{
+  std::vector<double> dR_dx( nLocBas, 0.0 ), dR_dy( nLocBas, 0.0 ),
+    dR_dz( nLocBas, 0.0 );
+
+  std::vector<double> ectrl_x( nLocBas, 0.0 ), ectrl_y( nLocBas, 0.0 ),
+    ectrl_z( nLocBas, 0.0 );
+
+  std::vector<double> sctrl_x( cell_nLocBas, 0.0 ), sctrl_y( cell_nLocBas, 0.0 ),
+    sctrl_z( cell_nLocBas, 0.0 );
+
+  // Area-weighted WSS and the area of the cells attached to the local and
+  // ghost nodes
+  std::vector<double> moment( 4 * nlocghonode, 0.0 );
+
+  for(int ee=0; ee<num_cell; ++ee)
+  {
+    const std::vector<int> IEN_v = lien -> get_LIEN( cell_elem[ee] );
+
+    fnode -> get_ctrlPts_xyz( nLocBas, &IEN_v[0], &ectrl_x[0], &ectrl_y[0], &ectrl_z[0] );
+
+    element -> buildBasis( quad.get(), &ectrl_x[0], &ectrl_y[0], &ectrl_z[0] );
+
+    wall -> get_ctrlPts_xyz( 0, ee, &sctrl_x[0], &sctrl_y[0], &sctrl_z[0] );
+
+    // Normal and area of the cell by its corners; for a quadrilateral, the
+    // cross product of the diagonals
+    Vector_3 normal;
+    if( cell_nLocBas == 3 || cell_nLocBas == 6 )
+    {
+      const Vector_3 l01( sctrl_x[1]-sctrl_x[0], sctrl_y[1]-sctrl_y[0], sctrl_z[1]-sctrl_z[0] );
+      const Vector_3 l02( sctrl_x[2]-sctrl_x[0], sctrl_y[2]-sctrl_y[0], sctrl_z[2]-sctrl_z[0] );
+      normal = Vec3::cross_product( l01, l02 );
+    }
+    else
+    {
+      const Vector_3 l02( sctrl_x[2]-sctrl_x[0], sctrl_y[2]-sctrl_y[0], sctrl_z[2]-sctrl_z[0] );
+      const Vector_3 l13( sctrl_x[3]-sctrl_x[1], sctrl_y[3]-sctrl_y[1], sctrl_z[3]-sctrl_z[1] );
+      normal = Vec3::cross_product( l02, l13 );
+    }
+
+    const double area = 0.5 * normal.normalize();
+
+    // Orient the normal away from the centroid of the volume element
+    Vector_3 inward( 0.0, 0.0, 0.0 );
+    for(int ii=0; ii<nLocBas; ++ii)
+      inward += Vector_3( ectrl_x[ii] - sctrl_x[0], ectrl_y[ii] - sctrl_y[0], ectrl_z[ii] - sctrl_z[0] );
+
+    if( Vec3::dot_product( normal, inward ) > 0.0 ) normal *= -1.0;
+
+    const double nx = normal.x(), ny = normal.y(), nz = normal.z();
+
+    for(int ii=0; ii<cell_nLocBas; ++ii)
+    {
+      const int qua = cell_node_loc[ee*cell_nLocBas+ii];
+
+      element -> get_gradR( qua, &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+
+      double u_x = 0.0, u_y = 0.0, u_z = 0.0, v_x = 0.0, v_y = 0.0, v_z = 0.0;
+      double w_x = 0.0, w_y = 0.0, w_z = 0.0;
+      for(int jj=0; jj<nLocBas; ++jj)
+      {
+        const int pos = 4 * IEN_v[jj];
+        u_x += array[pos+1] * dR_dx[jj];
+        u_y += array[pos+1] * dR_dy[jj];
+        u_z += array[pos+1] * dR_dz[jj];
+        v_x += array[pos+2] * dR_dx[jj];
+        v_y += array[pos+2] * dR_dy[jj];
+        v_z += array[pos+2] * dR_dz[jj];
+        w_x += array[pos+3] * dR_dx[jj];
+        w_y += array[pos+3] * dR_dy[jj];
+        w_z += array[pos+3] * dR_dz[jj];
+      }
+
+      const double ax = 2.0 * u_x * nx + (u_y + v_x) * ny + (u_z + w_x) * nz;
+      const double ay = (v_x + u_y) * nx + 2.0 * v_y * ny + (v_z + w_y) * nz;
+      const double az = (w_x + u_z) * nx + (w_y + v_z) * ny + 2.0 * w_z * nz;
+
+      const double b = ax * nx + ay * ny + az * nz;
+
+      const double mu = vismodel -> get_mu( SymmTensor2_3D( u_x, v_y, w_z,
+            0.5 * (v_z + w_y), 0.5 * (u_z + w_x), 0.5 * (u_y + v_x) ) );
+
+      const int pos = 4 * IEN_v[qua];
+      moment[pos+0] += area * mu * ( ax - b * nx );
+      moment[pos+1] += area * mu * ( ay - b * ny );
+      moment[pos+2] += area * mu * ( az - b * nz );
+      moment[pos+3] += area;
+    }
+  }
+
+  // Add the ghost contributions to their owners and send the sums back
+  Vec lsol;
+  double * lval;
+  VecGhostGetLocalForm( proj->solution, &lsol );
+  VecGetArray( lsol, &lval );
+  for(int ii=0; ii<4*nlocghonode; ++ii) lval[ii] = moment[ii];
+  VecRestoreArray( lsol, &lval );
+  VecGhostRestoreLocalForm( proj->solution, &lsol );
+
+  VecGhostUpdateBegin( proj->solution, ADD_VALUES, SCATTER_REVERSE );
+  VecGhostUpdateEnd( proj->solution, ADD_VALUES, SCATTER_REVERSE );
+
+  proj -> GhostUpdate();
+
+  const std::vector<double> sum = proj -> GetLocalArray();
+
+  wss.assign( 3 * num_node, 0.0 );
+  for(int ii=0; ii<num_node; ++ii)
+  {
+    const int pos = 4 * wall -> get_local_cell_node_pos( 0, ii );
+
+    const double inv_area = 1.0 / sum[pos+3];
+    wss[3*ii+0] = sum[pos+0] * inv_area;
+    wss[3*ii+1] = sum[pos+1] * inv_area;
+    wss[3*ii+2] = sum[pos+2] * inv_area;
+  }
+}
+
+void Insitu_WSS_NS::Write( const PDNTimeStep * const &time_info ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  // No sample is taken if the start time is after the final time
+  if( num_sample == 0 )
+  {
+    SYS_T::commPrint("     No WSS sample is taken after the start time %e, %s.xmf is not written. \n",
+        start_time, bname.c_str());
+    return;
+  }
+
+  std::vector<double> tawss( num_node, 0.0 ), osi( num_node, 0.0 ),
+    mean_wss( 3 * num_node, 0.0 );
+
+  for(int ii=0; ii<num_node; ++ii)
+  {
+    mean_wss[3*ii+0] = sum_wss[3*ii+0] / num_sample;
+    mean_wss[3*ii+1] = sum_wss[3*ii+1] / num_sample;
+    mean_wss[3*ii+2] = sum_wss[3*ii+2] / num_sample;
+
+    tawss[ii] = sum_mag[ii] / num_sample;
+
+    const double mag_mean = std::sqrt( mean_wss[3*ii]*mean_wss[3*ii]
+        + mean_wss[3*ii+1]*mean_wss[3*ii+1] + mean_wss[3*ii+2]*mean_wss[3*ii+2] );
+
+    if( tawss[ii] > 1.0e-12 ) osi[ii] = 0.5 * ( 1.0 - mag_mean / tawss[ii] );
+  }
+
+  std::vector<double> xyz( 3 * num_node, 0.0 );
+  for(int ii=0; ii<3*num_node; ++ii) xyz[ii] = wall -> get_local_cell_node_xyz( 0, ii );
+
+  std::vector<int> ien( num_cell * cell_nLocBas, -1 );
+  for(int ii=0; ii<num_cell*cell_nLocBas; ++ii) ien[ii] = wall -> get_local_cell_ien( 0, ii );
+
+  XDMF_Writer writer( bname, get_wall_elemType(elemType), cell_nLocBas,
+      xyz, ien, std::vector<int>{} );
+
+  const double * const pointArrays[3] { tawss.data(), osi.data(), mean_wss.data() };
+
+  writer.write_step( time_info->get_index(), time_info->get_time(),
+      { "TAWSS", "OSI", "Time_averaged_WSS" }, { 1, 1, 3 }, pointArrays );
+
+  SYS_T::commPrint("     WSS of %d samples written into %s.xmf \n", num_sample, bname.c_str());
+}
+
+FEType Insitu_WSS_NS::get_wall_elemType( const FEType &vol_elemType )
+{
+  switch( vol_elemType )
+  {
+    case FEType::Tet4:
+      return FEType::Tri3;
+    case FEType::Tet10:
+      return FEType::Tri6;
+    case FEType::Hex8:
+      return FEType::Quad4;
+    case FEType::Hex27:
+      return FEType::Quad9;
+    default:
+      SYS_T::print_fatal("Error: Insitu_WSS_NS unknown element type.\n");
+      return FEType::Unknown;
+  }
+}
+
+void Insitu_WSS_NS::print_info() const
+{
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+  SYS_T::commPrint("In-situ wall shear stress: \n");
+  SYS_T::commPrint("  wall: %s, group /wall \n", part_name.c_str());
+  SYS_T::commPrint("  output: %s.xmf \n", bname.c_str());
+  SYS_T::commPrint("  sampling frequency: %d \n", freq);
+  SYS_T::commPrint("  start time: %e \n", start_time);
+  SYS_T::commPrint("  viscosity model: %s, mu at zero strain rate: %e \n",
+      vismodel->get_model_name().c_str(), vismodel->get_mu( STen2::gen_zero() ));
+  SYS_T::commPrint("  fields: TAWSS, OSI, Time_averaged_WSS \n");
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+}
+
+// EOF
@@ -10,7 +10,8 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
     std::unique_ptr<ALocal_EBC> in_ebc,
     std::unique_ptr<ALocal_WeakBC> in_wbc,
     std::unique_ptr<IPLocAssem> in_locassem,    
-    const int &in_nz_estimate )
+    const int &in_nz_estimate,
+    const bool &in_is_resis_lowrank )
 : locien( std::move(in_locien) ),
   locelem( std::move(in_locelem) ),
   fnode( std::move(in_fnode) ),
@@ -24,7 +25,9 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
   dof_sol( pnode->get_dof() ),
   dof_mat( locassem->get_dof_mat() ),
   num_ebc( ebc->get_num_ebc() ),
-  nlgn( pnode->get_nlocghonode() )
+  nlgn( pnode->get_nlocghonode() ),
+  is_resis_lowrank( in_is_resis_lowrank ),
+  resis_coef( num_ebc, 0.0 )
 {
   SYS_T::print_fatal_if(dof_sol != locassem->get_dof(),
       "PGAssem_NS_FEM::dof_sol != locassem->get_dof(). \n");
@@ -51,6 +54,8 @@ PGAssem_NS_FEM::PGAssem_NS_FEM(
   VecSet(G, 0.0);
   VecSetOption(G, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
 
+  if( is_resis_lowrank ) Init_Resis_LowRank();
+
   SYS_T::commPrint("===> MAT_NEW_NONZERO_ALLOCATION_ERR = FALSE.\n");
   Release_nonzero_err_str();
 
@@ -238,6 +243,8 @@ void PGAssem_NS_FEM::Assem_residual(
     const double &dt,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_G );
+
   const int nElem = locelem->get_nlocalele();
   const int loc_dof = dof_mat * nLocBas;
   
@@ -254,6 +261,8 @@ void PGAssem_NS_FEM::Assem_residual(
   sol_a->GetLocalArray( array_a );
   sol_b->GetLocalArray( array_b );
 
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
   for( int ee=0; ee<nElem; ++ee )
   {
     locien->get_LIEN(ee, IEN_e);
@@ -274,6 +283,8 @@ void PGAssem_NS_FEM::Assem_residual(
     VecSetValues(G, loc_dof, row_index, locassem->Residual, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] array_a; array_a = nullptr;
   delete [] array_b; array_b = nullptr;
   delete [] local_a; local_a = nullptr;
@@ -312,6 +323,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
     const double &dt,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_ASSEM_KG );
+
   const int nElem = locelem->get_nlocalele();
   const int loc_dof = dof_mat * nLocBas;
   
@@ -328,6 +341,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
   sol_a->GetLocalArray( array_a );
   sol_b->GetLocalArray( array_b );
 
+  SYS_T::Perf_Begin( SYS_T::PERF_ASSEM_VOL );
+
   for(int ee=0; ee<nElem; ++ee)
   {
     locien->get_LIEN(ee, IEN_e);
@@ -351,6 +366,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
     VecSetValues(G, loc_dof, row_index, locassem->Residual, ADD_VALUES);
   }
 
+  SYS_T::Perf_End( SYS_T::PERF_ASSEM_VOL );
+
   delete [] array_a; array_a = nullptr;
   delete [] array_b; array_b = nullptr;
   delete [] local_a; local_a = nullptr;
@@ -384,6 +401,8 @@ void PGAssem_NS_FEM::Assem_tangent_residual(
 
 void PGAssem_NS_FEM::NatBC_G( const double &curr_time, const double &dt )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_G );
+
   int * LSIEN = new int [snLocBas];
   double * sctrl_x = new double [snLocBas];
   double * sctrl_y = new double [snLocBas];
@@ -423,6 +442,8 @@ void PGAssem_NS_FEM::NatBC_G( const double &curr_time, const double &dt )
 void PGAssem_NS_FEM::BackFlow_G( 
   const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_G );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -470,6 +491,8 @@ void PGAssem_NS_FEM::BackFlow_G(
 void PGAssem_NS_FEM::BackFlow_KG( const double &dt,
     const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_BACKFLOW_KG );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -521,6 +544,8 @@ double PGAssem_NS_FEM::Assem_surface_flowrate(
     const PDNSolution * const &vec,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -566,6 +591,8 @@ double PGAssem_NS_FEM::Assem_surface_flowrate(
     const ALocal_InflowBC * const &infbc_part,
     const int &infnbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -610,6 +637,8 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
     const PDNSolution * const &vec,
     const int &ebc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -664,6 +693,8 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
     const ALocal_InflowBC * const &infbc_part,
     const int &infnbc_id ) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
   double * array = new double [nlgn * dof_sol];
   double * local = new double [snLocBas * dof_sol];
   int * LSIEN = new int [snLocBas];
@@ -713,12 +744,335 @@ double PGAssem_NS_FEM::Assem_surface_ave_pressure(
   return sum_pres / sum_area;
 }
 
+void PGAssem_NS_FEM::Assem_surface_outlet_integrals(
+    const PDNSolution * const &dot_sol,
+    const PDNSolution * const &sol,
+    const bool &is_pressure,
+    std::vector<double> &sum ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
+  double * dot_array = new double [nlgn * dof_sol];
+  double * array = new double [nlgn * dof_sol];
+  double * dot_local = new double [snLocBas * dof_sol];
+  double * local = new double [snLocBas * dof_sol];
+  int * LSIEN = new int [snLocBas];
+  double * sctrl_x = new double [snLocBas];
+  double * sctrl_y = new double [snLocBas];
+  double * sctrl_z = new double [snLocBas];
+
+  dot_sol -> GetLocalArray( dot_array );
+  sol -> GetLocalArray( array );
+
+  // Layout: [dot Q | Q | int p | area], each with num_ebc slots
+  const int num_val = is_pressure ? 4 * num_ebc : 2 * num_ebc;
+
+  std::vector<double> esum( num_val, 0.0 );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    const int num_sele = ebc -> get_num_local_cell(ebc_id);
+
+    for(int ee=0; ee<num_sele; ++ee)
+    {
+      ebc -> get_SIEN( ebc_id, ee, LSIEN );
+
+      ebc -> get_ctrlPts_xyz(ebc_id, ee, sctrl_x, sctrl_y, sctrl_z);
+
+      GetLocal(dot_array, LSIEN, snLocBas, dot_local);
+      GetLocal(array, LSIEN, snLocBas, local);
+
+      esum[ebc_id]           += locassem -> get_flowrate( dot_local, sctrl_x, sctrl_y, sctrl_z );
+      esum[num_ebc + ebc_id] += locassem -> get_flowrate( local, sctrl_x, sctrl_y, sctrl_z );
+
+      if( is_pressure )
+      {
+        double ele_pres, ele_area;
+
+        locassem-> get_pressure_area( local, sctrl_x, sctrl_y,
+            sctrl_z, ele_pres, ele_area );
+
+        esum[2*num_ebc + ebc_id] += ele_pres;
+        esum[3*num_ebc + ebc_id] += ele_area;
+      }
+    }
+  }
+
+  delete [] dot_array; dot_array = nullptr;
+  delete [] array; array = nullptr;
+  delete [] dot_local; dot_local = nullptr;
+  delete [] local; local = nullptr;
+  delete [] LSIEN; LSIEN = nullptr;
+  delete [] sctrl_x; sctrl_x = nullptr;
+  delete [] sctrl_y; sctrl_y = nullptr;
+  delete [] sctrl_z; sctrl_z = nullptr;
+
+  sum.assign( num_val, 0.0 );
+
+  if( num_val > 0 )
+    MPI_Allreduce(&esum[0], &sum[0], num_val, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+}
+
+void PGAssem_NS_FEM::Assem_surface_outlet_data(
+    const PDNSolution * const &dot_sol,
+    const PDNSolution * const &sol,
+    std::vector<double> &dot_flrate,
+    std::vector<double> &flrate,
+    std::vector<double> &ave_pres ) const
+{
+  std::vector<double> sum;
+
+  Assem_surface_outlet_integrals( dot_sol, sol, true, sum );
+
+  dot_flrate.resize( num_ebc );
+  flrate.resize( num_ebc );
+  ave_pres.resize( num_ebc );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    dot_flrate[ebc_id] = sum[ebc_id];
+    flrate[ebc_id]     = sum[num_ebc + ebc_id];
+    ave_pres[ebc_id]   = sum[2*num_ebc + ebc_id] / sum[3*num_ebc + ebc_id];
+  }
+}
+
+void PGAssem_NS_FEM::Assem_surface_inlet_data(
+    const PDNSolution * const &sol,
+    const ALocal_InflowBC * const &infbc_part,
+    std::vector<double> &flrate,
+    std::vector<double> &ave_pres ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_SURFACE_INT );
+
+  const int num_nbc = infbc_part -> get_num_nbc();
+
+  double * array = new double [nlgn * dof_sol];
+  double * local = new double [snLocBas * dof_sol];
+  int * LSIEN = new int [snLocBas];
+  double * sctrl_x = new double [snLocBas];
+  double * sctrl_y = new double [snLocBas];
+  double * sctrl_z = new double [snLocBas];
+
+  sol -> GetLocalArray( array );
+
+  // Layout: [Q | int p | area], each with num_nbc slots
+  std::vector<double> esum( 3 * num_nbc, 0.0 );
+
+  for(int nbc_id = 0; nbc_id < num_nbc; ++nbc_id)
+  {
+    const int num_sele = infbc_part -> get_num_local_cell(nbc_id);
+
+    for(int ee=0; ee<num_sele; ++ee)
+    {
+      infbc_part -> get_SIEN( nbc_id, ee, LSIEN );
+
+      infbc_part -> get_ctrlPts_xyz( nbc_id, ee, sctrl_x, sctrl_y, sctrl_z);
+
+      GetLocal(array, LSIEN, snLocBas, local);
+
+      double ele_pres, ele_area;
+
+      locassem-> get_pressure_area( local, sctrl_x, sctrl_y,
+          sctrl_z, ele_pres, ele_area );
+
+      esum[nbc_id]             += locassem -> get_flowrate( local, sctrl_x, sctrl_y, sctrl_z );
+      esum[num_nbc + nbc_id]   += ele_pres;
+      esum[2*num_nbc + nbc_id] += ele_area;
+    }
+  }
+
+  delete [] array; array = nullptr;
+  delete [] local; local = nullptr;
+  delete [] LSIEN; LSIEN = nullptr;
+  delete [] sctrl_x; sctrl_x = nullptr;
+  delete [] sctrl_y; sctrl_y = nullptr;
+  delete [] sctrl_z; sctrl_z = nullptr;
+
+  std::vector<double> sum( 3 * num_nbc, 0.0 );
+
+  if( num_nbc > 0 )
+    MPI_Allreduce(&esum[0], &sum[0], 3 * num_nbc, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+
+  flrate.resize( num_nbc );
+  ave_pres.resize( num_nbc );
+
+  for(int nbc_id = 0; nbc_id < num_nbc; ++nbc_id)
+  {
+    flrate[nbc_id]   = sum[nbc_id];
+    ave_pres[nbc_id] = sum[num_nbc + nbc_id] / sum[2*num_nbc + nbc_id];
+  }
+}
+
+void PGAssem_NS_FEM::Init_Resis_LowRank()
+{
+  resis_a_idx.resize( num_ebc ); resis_a_val.resize( num_ebc );
+  resis_b_idx.resize( num_ebc ); resis_b_val.resize( num_ebc );
+
+  PetscScalar * Res = new PetscScalar [snLocBas * 3];
+  PetscInt * srow_idx = new PetscInt [snLocBas * 3];
+  int * LSIEN = new int [snLocBas];
+  double * sctrl_x = new double [snLocBas];
+  double * sctrl_y = new double [snLocBas];
+  double * sctrl_z = new double [snLocBas];
+
+  Vec aa, bb;
+  VecDuplicate(G, &aa); VecDuplicate(G, &bb);
+  VecSetOption(aa, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
+  VecSetOption(bb, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
+
+  PetscInt row_start, row_end;
+  VecGetOwnershipRange(G, &row_start, &row_end);
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    VecSet(aa, 0.0); VecSet(bb, 0.0);
+
+    // a_i is assembled from the surface cells with unit traction
+    const int num_sele = ebc -> get_num_local_cell(ebc_id);
+    for(int ee=0; ee<num_sele; ++ee)
+    {
+      ebc -> get_SIEN(ebc_id, ee, LSIEN);
+      ebc -> get_ctrlPts_xyz(ebc_id, ee, sctrl_x, sctrl_y, sctrl_z);
+
+      locassem->Assem_Residual_EBC_Resistance(ebc_id, 1.0,
+          sctrl_x, sctrl_y, sctrl_z);
+
+      for(int ii=0; ii<snLocBas; ++ii)
+      {
+        Res[3*ii+0] = locassem->sur_Residual[4*ii+1];
+        Res[3*ii+1] = locassem->sur_Residual[4*ii+2];
+        Res[3*ii+2] = locassem->sur_Residual[4*ii+3];
+
+        srow_idx[3*ii+0] = dof_mat * nbc->get_LID(1, LSIEN[ii]) + 1;
+        srow_idx[3*ii+1] = dof_mat * nbc->get_LID(2, LSIEN[ii]) + 2;
+        srow_idx[3*ii+2] = dof_mat * nbc->get_LID(3, LSIEN[ii]) + 3;
+      }
+
+      VecSetValues(aa, snLocBas*3, srow_idx, Res, ADD_VALUES);
+    }
+
+    // b_i is given on all face nodes by every CPU owning a part of the
+    // face, the values are identical and are inserted
+    const int num_face_nodes = ebc -> get_num_face_nodes(ebc_id);
+    if( num_face_nodes > 0 )
+    {
+      const Vector_3 out_n = ebc -> get_outvec( ebc_id );
+      const std::vector<double> intNB = ebc -> get_intNA( ebc_id );
+      const std::vector<int> map_Bj = ebc -> get_LID( ebc_id );
+
+      std::vector<PetscInt> scol_idx( 3 * num_face_nodes );
+      std::vector<PetscScalar> val( 3 * num_face_nodes );
+      for(int ii=0; ii<num_face_nodes; ++ii)
+      {
+        for(int jj=0; jj<3; ++jj)
+          scol_idx[3*ii+jj] = dof_mat * map_Bj[3*ii+jj] + jj + 1;
+
+        val[3*ii+0] = intNB[ii] * out_n.x();
+        val[3*ii+1] = intNB[ii] * out_n.y();
+        val[3*ii+2] = intNB[ii] * out_n.z();
+      }
+
+      VecSetValues(bb, 3*num_face_nodes, &scol_idx[0], &val[0], INSERT_VALUES);
+    }
+
+    VecAssemblyBegin(aa); VecAssemblyEnd(aa);
+    VecAssemblyBegin(bb); VecAssemblyEnd(bb);
+
+    // Keep the nonzero entries in the locally owned rows
+    const PetscScalar * array_a, * array_b;
+    VecGetArrayRead(aa, &array_a);
+    VecGetArrayRead(bb, &array_b);
+
+    for(int ii=0; ii<row_end - row_start; ++ii)
+    {
+      if( array_a[ii] != 0.0 )
+      {
+        resis_a_idx[ebc_id].push_back( ii );
+        resis_a_val[ebc_id].push_back( array_a[ii] );
+      }
+
+      if( array_b[ii] != 0.0 )
+      {
+        resis_b_idx[ebc_id].push_back( ii );
+        resis_b_val[ebc_id].push_back( array_b[ii] );
+      }
+    }
+
+    VecRestoreArrayRead(aa, &array_a);
+    VecRestoreArrayRead(bb, &array_b);
+  }
+
+  VecDestroy(&aa); VecDestroy(&bb);
+
+  delete [] Res; Res = nullptr; delete [] srow_idx; srow_idx = nullptr;
+  delete [] LSIEN; LSIEN = nullptr;
+  delete [] sctrl_x; sctrl_x = nullptr;
+  delete [] sctrl_y; sctrl_y = nullptr;
+  delete [] sctrl_z; sctrl_z = nullptr;
+}
+
+void PGAssem_NS_FEM::Resis_LowRank_Dot( const Vec &X,
+    std::vector<double> &dot ) const
+{
+  std::vector<double> loc_dot( num_ebc, 0.0 );
+
+  const PetscScalar * array_x;
+  VecGetArrayRead(X, &array_x);
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    for(unsigned int ii=0; ii<resis_b_idx[ebc_id].size(); ++ii)
+      loc_dot[ebc_id] += resis_b_val[ebc_id][ii] * array_x[ resis_b_idx[ebc_id][ii] ];
+  }
+
+  VecRestoreArrayRead(X, &array_x);
+
+  dot.assign( num_ebc, 0.0 );
+
+  if( num_ebc > 0 )
+    MPI_Allreduce(&loc_dot[0], &dot[0], num_ebc, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+}
+
+void PGAssem_NS_FEM::Resis_LowRank_MultAdd( const Vec &X, Vec &Y ) const
+{
+  std::vector<double> dot;
+  Resis_LowRank_Dot( X, dot );
+
+  PetscScalar * array_y;
+  VecGetArray(Y, &array_y);
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
+    const double scale = resis_coef[ebc_id] * dot[ebc_id];
+
+    for(unsigned int ii=0; ii<resis_a_idx[ebc_id].size(); ++ii)
+      array_y[ resis_a_idx[ebc_id][ii] ] += scale * resis_a_val[ebc_id][ii];
+  }
+
+  VecRestoreArray(Y, &array_y);
+}
+
+void PGAssem_NS_FEM::Resis_LowRank_Get_U( const int &ebc_id, Vec &U ) const
+{
+  VecSet(U, 0.0);
+
+  PetscScalar * array_u;
+  VecGetArray(U, &array_u);
+
+  for(unsigned int ii=0; ii<resis_a_idx[ebc_id].size(); ++ii)
+    array_u[ resis_a_idx[ebc_id][ii] ] = resis_coef[ebc_id] * resis_a_val[ebc_id][ii];
+
+  VecRestoreArray(U, &array_u);
+}
+
 void PGAssem_NS_FEM::NatBC_Resis_G(
     const double &curr_time, const double &dt,
     const PDNSolution * const &dot_sol,
     const PDNSolution * const &sol,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_G );
+
   PetscScalar * Res = new PetscScalar [snLocBas * 3];
   PetscInt * srow_idx = new PetscInt [snLocBas * 3];
   int * LSIEN = new int [snLocBas];
@@ -726,17 +1080,21 @@ void PGAssem_NS_FEM::NatBC_Resis_G(
   double * sctrl_y = new double [snLocBas];
   double * sctrl_z = new double [snLocBas];
 
+  // Calculate the dot flow rate and flow rate of all faces from dot_sol
+  // and sol, which are reduced over CPUs together
+  std::vector<double> face_flrate;
+  Assem_surface_outlet_integrals( dot_sol, sol, false, face_flrate );
+
   for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
   {
-    // Calculate dot flow rate for face with ebc_id from solution vector dot_sol
-    const double dot_flrate = Assem_surface_flowrate( dot_sol, ebc_id ); 
-
-    // Calculate flow rate for face with ebc_id from solution vector sol
-    const double flrate = Assem_surface_flowrate( sol, ebc_id );
+    const double dot_flrate = face_flrate[ebc_id];
+    const double flrate     = face_flrate[num_ebc + ebc_id];
 
     // Get the (pressure) value on the outlet surface for traction evaluation    
+    SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
     const double P_n   = gbc -> get_P0( ebc_id );
     const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    SYS_T::Perf_End( SYS_T::PERF_GENBC );
 
     // P_n+alpha_f
     // lassem_ptr->get_model_para_1() gives alpha_f 
@@ -781,6 +1139,8 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
     const PDNSolution * const &sol,
     const IGenBC * const &gbc )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_NATBC_RESIS_KG );
+
   const double a_f = locassem -> get_model_para_1();
 
   // dd_dv = dt x alpha_f x gamma
@@ -800,34 +1160,41 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
   double * sctrl_y = new double [snLocBas];
   double * sctrl_z = new double [snLocBas];
   
-  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
-  {
-    // Calculate dot flow rate for face with ebc_id and MPI_Allreduce them
-    // Here, dot_sol is the solution at time step n+1 (not n+alpha_f!)
-    const double dot_flrate = Assem_surface_flowrate( dot_sol, ebc_id ); 
+  // Calculate the dot flow rate and flow rate of all faces and reduce
+  // them over CPUs together. The values are shared by the evaluation of
+  // P, m, and n below.
+  // Here, dot_sol and sol are the solutions at time step n+1 (not n+alpha_f!)
+  std::vector<double> face_flrate;
+  Assem_surface_outlet_integrals( dot_sol, sol, false, face_flrate );
+
+  const std::vector<double> dot_flrate( face_flrate.begin(), face_flrate.begin() + num_ebc );
+  const std::vector<double> flrate( face_flrate.begin() + num_ebc, face_flrate.begin() + 2*num_ebc );
 
-    // Calculate flow rate for face with ebc_id and MPI_Allreduce them
-    // Here, sol is the solution at time step n+1 (not n+alpha_f!)
-    const double flrate = Assem_surface_flowrate( sol, ebc_id );
+  // Get P_n+1, m := dP/dQ, and n := dP/d(dot_Q) of all faces from the
+  // 0D model in one call
+  std::vector<double> P_np1, m_val, n_val;
 
+  SYS_T::Perf_Begin( SYS_T::PERF_GENBC );
+  gbc -> get_P_m_n( dot_flrate, flrate, curr_time + dt, P_np1, m_val, n_val );
+  SYS_T::Perf_End( SYS_T::PERF_GENBC );
+
+  for(int ebc_id = 0; ebc_id < num_ebc; ++ebc_id)
+  {
     // Get the (pressure) value on the outlet surface for traction evaluation    
-    const double P_n   = gbc -> get_P0( ebc_id );
-    const double P_np1 = gbc -> get_P( ebc_id, dot_flrate, flrate, curr_time + dt );
+    const double P_n = gbc -> get_P0( ebc_id );
 
     // P_n+alpha_f 
-    const double resis_val = P_n + a_f * (P_np1 - P_n);
-
-    // Get the (potentially approximated) m := dP/dQ
-    const double m_val = gbc -> get_m( ebc_id, dot_flrate, flrate );
+    const double resis_val = P_n + a_f * (P_np1[ebc_id] - P_n);
 
-    // Get the (potentially approximated) n := dP/d(dot_Q)
-    const double n_val = gbc -> get_n( ebc_id, dot_flrate, flrate );
-    
     // Define alpha_f * n + alpha_f * gamma * dt * m
     // coef a^t a enters as the consistent tangent for the resistance-type bc
-    const double coef = a_f * n_val + dd_dv * m_val;
+    const double coef = a_f * n_val[ebc_id] + dd_dv * m_val[ebc_id];
 
-    const int num_face_nodes = ebc -> get_num_face_nodes(ebc_id);
+    // In the low-rank mode, only coef is recorded and the coupling block
+    // is applied outside of K
+    if( is_resis_lowrank ) resis_coef[ebc_id] = coef;
+
+    const int num_face_nodes = is_resis_lowrank ? 0 : ebc -> get_num_face_nodes(ebc_id);
     if(num_face_nodes > 0)
     {
       Tan = new PetscScalar [snLocBas * 3 * num_face_nodes * 3];
@@ -860,6 +1227,17 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
         Res[3*ii+2] = resis_val * locassem->sur_Residual[4*ii+3];
       }
 
+      for(int ii=0; ii<snLocBas; ++ii)
+      {
+        srow_idx[3*ii+0] = dof_mat * nbc->get_LID(1,LSIEN[ii]) + 1;
+        srow_idx[3*ii+1] = dof_mat * nbc->get_LID(2,LSIEN[ii]) + 2;
+        srow_idx[3*ii+2] = dof_mat * nbc->get_LID(3,LSIEN[ii]) + 3;
+      }
+
+      VecSetValues(G, snLocBas*3, srow_idx, Res, ADD_VALUES);
+
+      if( num_face_nodes == 0 ) continue;
+
       for(int A=0; A<snLocBas; ++A)
       {
         for(int ii=0; ii<3; ++ii)
@@ -875,13 +1253,6 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
         }
       }
 
-      for(int ii=0; ii<snLocBas; ++ii)
-      {
-        srow_idx[3*ii+0] = dof_mat * nbc->get_LID(1,LSIEN[ii]) + 1;
-        srow_idx[3*ii+1] = dof_mat * nbc->get_LID(2,LSIEN[ii]) + 2;
-        srow_idx[3*ii+2] = dof_mat * nbc->get_LID(3,LSIEN[ii]) + 3;
-      }
-
       for(int ii=0; ii<num_face_nodes; ++ii)
       {
         scol_idx[ii*3+0] = dof_mat * map_Bj[ii*3+0] + 1;
@@ -890,7 +1261,6 @@ void PGAssem_NS_FEM::NatBC_Resis_KG(
       }
 
       MatSetValues(K, snLocBas*3, srow_idx, num_face_nodes*3, scol_idx, Tan, ADD_VALUES);
-      VecSetValues(G, snLocBas*3, srow_idx, Res, ADD_VALUES);
     }
 
     if( num_face_nodes > 0 ) 
@@ -911,6 +1281,8 @@ void PGAssem_NS_FEM::Weak_EssBC_KG(
     const double &curr_time, const double &dt,
     const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_WEAK_ESSBC_KG );
+
   const int loc_dof {dof_mat * nLocBas};
   double * array_b = new double [nlgn * dof_sol];
   double * local_b = new double [nLocBas * dof_sol];
@@ -963,6 +1335,8 @@ void PGAssem_NS_FEM::Weak_EssBC_G(
     const double &curr_time, const double &dt,
     const PDNSolution * const &sol )
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_WEAK_ESSBC_G );
+
   const int loc_dof {dof_mat * nLocBas};
   double * array_b = new double [nlgn * dof_sol];
   double * local_b = new double [nLocBas * dof_sol];
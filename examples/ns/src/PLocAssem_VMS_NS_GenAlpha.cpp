@@ -86,13 +86,14 @@ SymmTensor2_3D PLocAssem_VMS_NS_GenAlpha::get_metric(
 
 std::array<double, 2> PLocAssem_VMS_NS_GenAlpha::get_tau(
     const double &dt, const std::array<double, 9> &dxi_dx,
-    const double &u, const double &v, const double &w ) const
+    const double &u, const double &v, const double &w,
+    const double &mu ) const
 {
   const SymmTensor2_3D G = get_metric( dxi_dx );
 
   const Vector_3 velo_vec( u, v, w );
 
-  const double temp_nu = vis_mu / rho0;
+  const double temp_nu = mu / rho0;
 
   const double denom_m = std::sqrt( CT / (dt*dt) + G.VecMatVec( velo_vec, velo_vec) + CI * temp_nu * temp_nu * G.MatContraction( G ) );
 
@@ -126,7 +127,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
 {
   elementv->buildBasis( quadv.get(), eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
 
-  const double two_mu = 2.0 * vis_mu;
+  eval_viscosity( sol );
 
   const double curr = time + alpha_f * dt;
 
@@ -137,6 +138,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
 
   for(int qua=0; qua<nqpv; ++qua)
   {
+    const double mu = get_viscosity( qua ), two_mu = 2.0 * mu;
+
     double u = 0.0, u_t = 0.0, u_x = 0.0, u_y = 0.0, u_z = 0.0;
     double v = 0.0, v_t = 0.0, v_x = 0.0, v_y = 0.0, v_z = 0.0;
     double w = 0.0, w_t = 0.0, w_x = 0.0, w_y = 0.0, w_z = 0.0;
@@ -198,7 +201,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
     // Get the tau_m and tau_c
     const auto dxi_dx = elementv->get_invJacobian(qua);
 
-    const std::array<double, 2> tau = get_tau( dt, dxi_dx, u, v, w );
+    const std::array<double, 2> tau = get_tau( dt, dxi_dx, u, v, w, mu );
     const double tau_m = tau[0];
     const double tau_c = tau[1];
 
@@ -213,9 +216,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
     const double v_lap = v_xx + v_yy + v_zz;
     const double w_lap = w_xx + w_yy + w_zz;
 
-    const double rx = rho0 * ( u_t + u_x * u + u_y * v + u_z * w - f_body.x() ) + p_x - vis_mu * u_lap;
-    const double ry = rho0 * ( v_t + v_x * u + v_y * v + v_z * w - f_body.y() ) + p_y - vis_mu * v_lap;
-    const double rz = rho0 * ( w_t + w_x * u + w_y * v + w_z * w - f_body.z() ) + p_z - vis_mu * w_lap;
+    const double rx = rho0 * ( u_t + u_x * u + u_y * v + u_z * w - f_body.x() ) + p_x - mu * u_lap;
+    const double ry = rho0 * ( v_t + v_x * u + v_y * v + v_z * w - f_body.y() ) + p_y - mu * v_lap;
+    const double rz = rho0 * ( w_t + w_x * u + w_y * v + w_z * w - f_body.z() ) + p_z - mu * w_lap;
 
     const double div_vel = u_x + v_y + w_z;
 
@@ -243,8 +246,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
           + NA * rho0 * (u * u_x + v * u_y + w * u_z)
           - NA_x * p
           + NA_x * two_mu * u_x
-          + NA_y * vis_mu * (u_y + v_x)
-          + NA_z * vis_mu * (u_z + w_x)
+          + NA_y * mu * (u_y + v_x)
+          + NA_z * mu * (u_z + w_x)
           + velo_dot_gradR * tau_m * rho0 * rx
           - NA * tau_m * rho0 * r_dot_gradu
           + NA_x * tau_c * div_vel
@@ -256,9 +259,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
       Residual[4*A+2] += gwts * ( NA * rho0 * v_t
           + NA * rho0 * (u * v_x + v * v_y + w * v_z)
           - NA_y * p
-          + NA_x * vis_mu * (u_y + v_x)
+          + NA_x * mu * (u_y + v_x)
           + NA_y * two_mu * v_y
-          + NA_z * vis_mu * (v_z + w_y)
+          + NA_z * mu * (v_z + w_y)
           + velo_dot_gradR * tau_m * rho0 * ry
           - NA * tau_m * rho0 * r_dot_gradv
           + NA_y * tau_c * div_vel
@@ -270,8 +273,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Residual(
       Residual[4*A+3] += gwts * (NA * rho0 * w_t
           + NA * rho0 * (u * w_x + v * w_y + w * w_z)
           - NA_z * p
-          + NA_x * vis_mu * (u_z + w_x)
-          + NA_y * vis_mu * (w_y + v_z)
+          + NA_x * mu * (u_z + w_x)
+          + NA_y * mu * (w_y + v_z)
           + NA_z * two_mu * w_z
           + velo_dot_gradR * tau_m * rho0 * rz
           - NA * tau_m * rho0 * r_dot_gradw
@@ -294,7 +297,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 {
   elementv->buildBasis( quadv.get(), eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
 
-  const double two_mu = 2.0 * vis_mu;
+  eval_viscosity( sol );
 
   const double rho0_2 = rho0 * rho0;
 
@@ -309,6 +312,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
   for(int qua=0; qua<nqpv; ++qua)
   {
+    const double mu = get_viscosity( qua ), two_mu = 2.0 * mu;
+
     double u = 0.0, u_t = 0.0, u_x = 0.0, u_y = 0.0, u_z = 0.0;
     double v = 0.0, v_t = 0.0, v_x = 0.0, v_y = 0.0, v_z = 0.0;
     double w = 0.0, w_t = 0.0, w_x = 0.0, w_y = 0.0, w_z = 0.0;
@@ -369,7 +374,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
     const auto dxi_dx = elementv->get_invJacobian(qua);
 
-    const std::array<double, 2> tau = get_tau( dt, dxi_dx, u, v, w );
+    const std::array<double, 2> tau = get_tau( dt, dxi_dx, u, v, w, mu );
     const double tau_m = tau[0];
     const double tau_c = tau[1];
 
@@ -383,9 +388,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
     const double v_lap = v_xx + v_yy + v_zz;
     const double w_lap = w_xx + w_yy + w_zz;
 
-    const double rx = rho0 * ( u_t + u_x * u + u_y * v + u_z * w - f_body.x() ) + p_x - vis_mu * u_lap;
-    const double ry = rho0 * ( v_t + v_x * u + v_y * v + v_z * w - f_body.y() ) + p_y - vis_mu * v_lap ;
-    const double rz = rho0 * ( w_t + w_x * u + w_y * v + w_z * w - f_body.z() ) + p_z - vis_mu * w_lap;
+    const double rx = rho0 * ( u_t + u_x * u + u_y * v + u_z * w - f_body.x() ) + p_x - mu * u_lap;
+    const double ry = rho0 * ( v_t + v_x * u + v_y * v + v_z * w - f_body.y() ) + p_y - mu * v_lap ;
+    const double rz = rho0 * ( w_t + w_x * u + w_y * v + w_z * w - f_body.z() ) + p_z - mu * w_lap;
 
     const double div_vel = u_x + v_y + w_z;
 
@@ -413,8 +418,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
           + NA * rho0 * (u * u_x + v * u_y + w * u_z)
           - NA_x * p
           + NA_x * two_mu * u_x
-          + NA_y * vis_mu * (u_y + v_x)
-          + NA_z * vis_mu * (u_z + w_x)
+          + NA_y * mu * (u_y + v_x)
+          + NA_z * mu * (u_z + w_x)
           + velo_dot_gradR * tau_m * rho0 * rx
           - NA * tau_m * rho0 * r_dot_gradu
           + NA_x * tau_c * div_vel
@@ -426,9 +431,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
       Residual[4*A+2] += gwts * ( NA * rho0 * v_t
           + NA * rho0 * (u * v_x + v * v_y + w * v_z)
           - NA_y * p
-          + NA_x * vis_mu * (u_y + v_x)
+          + NA_x * mu * (u_y + v_x)
           + NA_y * two_mu * v_y
-          + NA_z * vis_mu * (v_z + w_y)
+          + NA_z * mu * (v_z + w_y)
           + velo_dot_gradR * tau_m * rho0 * ry
           - NA * tau_m * rho0 * r_dot_gradv
           + NA_y * tau_c * div_vel
@@ -440,8 +445,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
       Residual[4*A+3] += gwts * (NA * rho0 * w_t
           + NA * rho0 * (u * w_x + v * w_y + w * w_z)
           - NA_z * p
-          + NA_x * vis_mu * (u_z + w_x)
-          + NA_y * vis_mu * (w_y + v_z)
+          + NA_x * mu * (u_z + w_x)
+          + NA_y * mu * (w_y + v_z)
           + NA_z * two_mu * w_z
           + velo_dot_gradR * tau_m * rho0 * rz
           - NA * tau_m * rho0 * r_dot_gradw
@@ -464,17 +469,17 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
         const double NAyNB = NA_y*NB, NAyNBx = NA_y*NB_x, NAyNBy = NA_y*NB_y, NAyNBz = NA_y*NB_z;
         const double NAzNB = NA_z*NB, NAzNBx = NA_z*NB_x, NAzNBy = NA_z*NB_y, NAzNBz = NA_z*NB_z;
 
-        const double drx_du_B = rho0 * ( u_x * NB + velo_dot_gradNB ) - vis_mu * NB_lap; 
+        const double drx_du_B = rho0 * ( u_x * NB + velo_dot_gradNB ) - mu * NB_lap; 
         const double drx_dv_B = rho0 * u_y * NB;
         const double drx_dw_B = rho0 * u_z * NB;
 
         const double dry_du_B = rho0 * v_x * NB;
-        const double dry_dv_B = rho0 * ( v_y * NB + velo_dot_gradNB ) - vis_mu * NB_lap;
+        const double dry_dv_B = rho0 * ( v_y * NB + velo_dot_gradNB ) - mu * NB_lap;
         const double dry_dw_B = rho0 * v_z * NB;
 
         const double drz_du_B = rho0 * w_x * NB;
         const double drz_dv_B = rho0 * w_y * NB;
-        const double drz_dw_B = rho0 * ( w_z * NB + velo_dot_gradNB ) - vis_mu * NB_lap;
+        const double drz_dw_B = rho0 * ( w_z * NB + velo_dot_gradNB ) - mu * NB_lap;
 
         // Continuity equation with respect to p, u, v, w
         Tangent[16*nLocBas*A+4*B] += gwts * dd_dv * tau_m * (NAxNBx + NAyNBy + NAzNBz);
@@ -505,7 +510,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
               - rho0_2 * tau_m_2 * rx * NAxNB
               - rho0_2 * tau_m_2 * (rx * NAxNB + ry * NAyNB + rz * NAzNB) )
             + dd_dv * ( NA * rho0 * velo_dot_gradNB + NANB * rho0 * u_x
-              + vis_mu * (2.0*NAxNBx + NAyNBy + NAzNBz)
+              + mu * (2.0*NAxNBx + NAyNBy + NAzNBz)
               + velo_dot_gradR * rho0 * tau_m * drx_du_B
               + rho0 * tau_m * rx * NAxNB
               - rho0 * tau_m * (rx * NANBx + ry * NANBy + rz * NANBz)
@@ -521,7 +526,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+1)+4*B+2] += gwts * ( 
             alpha_m * (-1.0) * rho0_2 * (tau_m * u_y * NANB + tau_m_2 * rx * NAyNB)
-            + dd_dv * ( NANB * rho0 * u_y + vis_mu * NAyNBx 
+            + dd_dv * ( NANB * rho0 * u_y + mu * NAyNBx 
               + rho0 * tau_m * rx * NAyNB
               + velo_dot_gradR * rho0 * tau_m * drx_dv_B
               - rho0 * tau_m * NA * (u_x*drx_dv_B + u_y*dry_dv_B + u_z*drz_dv_B)
@@ -532,7 +537,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+1)+4*B+3] += gwts * (
             alpha_m * (-1.0) * rho0_2 * (tau_m * u_z * NANB + tau_m_2 * rx * NAzNB)
-            + dd_dv * ( NANB * rho0 * u_z + vis_mu * NAzNBx 
+            + dd_dv * ( NANB * rho0 * u_z + mu * NAzNBx 
               + rho0 * tau_m * rx * NAzNB
               + velo_dot_gradR * rho0 * tau_m * drx_dw_B
               - rho0 * tau_m * NA * (u_x*drx_dw_B + u_y*dry_dw_B + u_z*drz_dw_B)
@@ -551,7 +556,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+2)+4*B+1] += gwts * (
             alpha_m * (-1.0) * rho0_2 * (tau_m * v_x * NANB + tau_m_2 * ry * NAxNB)
-            + dd_dv * ( NANB * rho0 * v_x + vis_mu * NAxNBy
+            + dd_dv * ( NANB * rho0 * v_x + mu * NAxNBy
               + rho0 * tau_m * ry * NAxNB
               + velo_dot_gradR * rho0 * tau_m * dry_du_B
               - rho0 * tau_m * NA * (v_x*drx_du_B + v_y*dry_du_B + v_z*drz_du_B)
@@ -566,7 +571,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
               - rho0_2 * tau_m_2 * ry * NAyNB
               - rho0_2 * tau_m_2 * (rx * NAxNB + ry * NAyNB + rz * NAzNB) )
             + dd_dv * ( NA * rho0 * velo_dot_gradNB + NANB * rho0 * v_y
-              + vis_mu * (NAxNBx + 2.0 * NAyNBy + NAzNBz)
+              + mu * (NAxNBx + 2.0 * NAyNBy + NAzNBz)
               + velo_dot_gradR * rho0 * tau_m * dry_dv_B
               + rho0 * tau_m * ry * NAyNB
               - rho0 * tau_m * ( rx * NANBx + ry * NANBy + rz * NANBz )
@@ -579,7 +584,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+2)+4*B+3] += gwts * (
             alpha_m * (-1.0) * rho0_2 * ( tau_m * v_z * NANB + tau_m_2 * ry * NAzNB ) 
-            + dd_dv * ( NANB * rho0 * v_z + vis_mu * NAzNBy
+            + dd_dv * ( NANB * rho0 * v_z + mu * NAzNBy
               + rho0 * tau_m * ry * NAzNB
               + velo_dot_gradR * rho0 * tau_m * dry_dw_B
               - rho0 * tau_m * NA * (v_x*drx_dw_B + v_y*dry_dw_B + v_z*drz_dw_B)
@@ -598,7 +603,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+3)+4*B+1] += gwts * (
             alpha_m * (-1.0) * rho0_2 * (tau_m * w_x * NANB + tau_m_2 * rz * NAxNB)
-            + dd_dv * ( NANB * rho0 * w_x + vis_mu * NAxNBz
+            + dd_dv * ( NANB * rho0 * w_x + mu * NAxNBz
               + rho0 * tau_m * rz * NAxNB
               + velo_dot_gradR * rho0 * tau_m * drz_du_B
               - rho0 * tau_m * NA * (w_x*drx_du_B + w_y*dry_du_B + w_z*drz_du_B)
@@ -609,7 +614,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
 
         Tangent[4*nLocBas*(4*A+3)+4*B+2] += gwts * (
             alpha_m * (-1.0) * rho0_2 * (tau_m * w_y * NANB + tau_m_2 * rz * NAyNB)
-            + dd_dv * ( NANB * rho0 * w_y + vis_mu * NAyNBz
+            + dd_dv * ( NANB * rho0 * w_y + mu * NAyNBz
               + rho0 * tau_m * rz * NAyNB
               + velo_dot_gradR * rho0 * tau_m * drz_dv_B
               - rho0 * tau_m * NA * (w_x*drx_dv_B + w_y*dry_dv_B + w_z*drz_dv_B)
@@ -624,7 +629,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
               - rho0_2 * tau_m_2 * rz * NAzNB
               - rho0_2 * tau_m_2 * (rx*NAxNB + ry*NAyNB + rz * NAzNB) )
             + dd_dv * ( rho0 * NA * velo_dot_gradNB + NANB * rho0 * w_z
-              + vis_mu * (NAxNBx + NAyNBy + 2.0 * NAzNBz)
+              + mu * (NAxNBx + NAyNBy + 2.0 * NAzNBz)
               + velo_dot_gradR * rho0 * tau_m * drz_dw_B
               + rho0 * tau_m * rz * NAzNB
               - rho0 * tau_m * (rx*NANBx + ry * NANBy + rz * NANBz)
@@ -636,6 +641,9 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Tangent_Residual(
               + velo_prime_dot_gradR * tau_dc * velo_prime_dot_gradNB ) );
       } // B-loop
     } // A-loop
+
+    // Tangent of the viscous term through the strain-rate dependence of mu
+    add_viscosity_tangent( qua, gwts * dd_dv, &dR_dx[0], &dR_dy[0], &dR_dz[0] );
   } // qua-loop
   // ----------------------------------------------------------------
   // The local `stiffness' matrix 
@@ -654,7 +662,7 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Mass_Residual(
 {
   elementv->buildBasis( quadv.get(), eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
 
-  const double two_mu = 2.0 * vis_mu;
+  eval_viscosity( sol );
 
   const double curr = 0.0;
 
@@ -664,6 +672,8 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Mass_Residual(
 
   for(int qua=0; qua<nqpv; ++qua)
   {
+    const double mu = get_viscosity( qua ), two_mu = 2.0 * mu;
+
     double u = 0.0, u_x = 0.0, u_y = 0.0, u_z = 0.0;
     double v = 0.0, v_x = 0.0, v_y = 0.0, v_z = 0.0;
     double w = 0.0, w_x = 0.0, w_y = 0.0, w_z = 0.0;
@@ -710,21 +720,21 @@ void PLocAssem_VMS_NS_GenAlpha::Assem_Mass_Residual(
       Residual[4*A+1] += gwts * ( NA * rho0 * (u*u_x + v*u_y + w*u_z) 
           - NA_x * p
           + two_mu * NA_x * u_x
-          + vis_mu * NA_y * (u_y + v_x)
-          + vis_mu * NA_z * (u_z + w_x)
+          + mu * NA_y * (u_y + v_x)
+          + mu * NA_z * (u_z + w_x)
           - NA * rho0 * f_body.x() );
 
       Residual[4*A+2] += gwts * ( NA * rho0 * (u*v_x + v*v_y + w*v_z) 
           - NA_y * p
-          + vis_mu * NA_x * (u_y + v_x)
+          + mu * NA_x * (u_y + v_x)
           + two_mu * NA_y * v_y
-          + vis_mu * NA_z * (v_z + w_y)
+          + mu * NA_z * (v_z + w_y)
           - NA * rho0 * f_body.y() );
 
       Residual[4*A+3] += gwts * ( NA * rho0 * (u*w_x + v*w_y + w*w_z) 
           - NA_z * p
-          + vis_mu * NA_x * (u_z + w_x)
-          + vis_mu * NA_y * (w_y + v_z)
+          + mu * NA_x * (u_z + w_x)
+          + mu * NA_y * (w_y + v_z)
           + two_mu * NA_z * w_z
           - NA * rho0 * f_body.z() );
 
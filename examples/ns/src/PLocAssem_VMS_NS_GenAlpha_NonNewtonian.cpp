@@ -0,0 +1,95 @@
+#include "PLocAssem_VMS_NS_GenAlpha_NonNewtonian.hpp"
+
+PLocAssem_VMS_NS_GenAlpha_NonNewtonian::PLocAssem_VMS_NS_GenAlpha_NonNewtonian(
+    const FEType &in_type, const int &in_nqp_v, const int &in_nqp_s,
+    const TimeMethod_GenAlpha * const &tm_gAlpha, const double &in_rho,
+    std::unique_ptr<IViscosityModel> in_vismodel, const double &in_beta,
+    const double &in_ct, const double &in_ctauc )
+: PLocAssem_VMS_NS_GenAlpha(in_type, in_nqp_v, in_nqp_s, tm_gAlpha, in_rho,
+  in_vismodel->get_mu( STen2::gen_zero() ), in_beta, in_ct, in_ctauc),
+  vismodel( std::move(in_vismodel) ),
+  strain_rate_qua( nqpv, STen2::gen_zero() ),
+  mu_qua( nqpv, 0.0 ), dmu_qua( nqpv, 0.0 ), DN( 3 * nLocBas, 0.0 )
+{
+  SYS_T::commPrint("  Non-Newtonian fluid, mu above is at zero strain rate: \n");
+  vismodel->print_info();
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+}
+
+void PLocAssem_VMS_NS_GenAlpha_NonNewtonian::eval_viscosity(
+    const double * const &sol )
+{
+  std::vector<double> dR_dx(nLocBas, 0.0), dR_dy(nLocBas, 0.0), dR_dz(nLocBas, 0.0);
+
+  for(int qua=0; qua<nqpv; ++qua)
+  {
+    double u_x = 0.0, u_y = 0.0, u_z = 0.0;
+    double v_x = 0.0, v_y = 0.0, v_z = 0.0;
+    double w_x = 0.0, w_y = 0.0, w_z = 0.0;
+
+    elementv->get_gradR( qua, &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+
+    for(int ii=0; ii<nLocBas; ++ii)
+    {
+      const int ii4 = 4 * ii;
+
+      u_x += sol[ii4+1] * dR_dx[ii];
+      v_x += sol[ii4+2] * dR_dx[ii];
+      w_x += sol[ii4+3] * dR_dx[ii];
+
+      u_y += sol[ii4+1] * dR_dy[ii];
+      v_y += sol[ii4+2] * dR_dy[ii];
+      w_y += sol[ii4+3] * dR_dy[ii];
+
+      u_z += sol[ii4+1] * dR_dz[ii];
+      v_z += sol[ii4+2] * dR_dz[ii];
+      w_z += sol[ii4+3] * dR_dz[ii];
+    }
+
+    strain_rate_qua[qua] = SymmTensor2_3D( u_x, v_y, w_z, 0.5 * (v_z + w_y),
+        0.5 * (u_z + w_x), 0.5 * (u_y + v_x) );
+  }
+
+  // One call of the viscosity model for all quadrature points
+  vismodel->eval_mu_batch( nqpv, &strain_rate_qua[0], &mu_qua[0], &dmu_qua[0] );
+}
+
+void PLocAssem_VMS_NS_GenAlpha_NonNewtonian::add_viscosity_tangent(
+    const int &qua, const double &coef,
+    const double * const &dR_dx, const double * const &dR_dy,
+    const double * const &dR_dz )
+{
+  const SymmTensor2_3D &DD = strain_rate_qua[qua];
+  const double dmu_coef = 4.0 * coef * dmu_qua[qua];
+
+  for(int B=0; B<nLocBas; ++B)
+  {
+    DN[3*B+0] = DD.xx() * dR_dx[B] + DD.xy() * dR_dy[B] + DD.xz() * dR_dz[B];
+    DN[3*B+1] = DD.yx() * dR_dx[B] + DD.yy() * dR_dy[B] + DD.yz() * dR_dz[B];
+    DN[3*B+2] = DD.zx() * dR_dx[B] + DD.zy() * dR_dy[B] + DD.zz() * dR_dz[B];
+  }
+
+  for(int A=0; A<nLocBas; ++A)
+  {
+    const double DA_x = dmu_coef * DN[3*A+0];
+    const double DA_y = dmu_coef * DN[3*A+1];
+    const double DA_z = dmu_coef * DN[3*A+2];
+
+    for(int B=0; B<nLocBas; ++B)
+    {
+      const double DB_x = DN[3*B+0], DB_y = DN[3*B+1], DB_z = DN[3*B+2];
+
+      Tangent[4*nLocBas*(4*A+1)+4*B+1] += DA_x * DB_x;
+      Tangent[4*nLocBas*(4*A+1)+4*B+2] += DA_x * DB_y;
+      Tangent[4*nLocBas*(4*A+1)+4*B+3] += DA_x * DB_z;
+      Tangent[4*nLocBas*(4*A+2)+4*B+1] += DA_y * DB_x;
+      Tangent[4*nLocBas*(4*A+2)+4*B+2] += DA_y * DB_y;
+      Tangent[4*nLocBas*(4*A+2)+4*B+3] += DA_y * DB_z;
+      Tangent[4*nLocBas*(4*A+3)+4*B+1] += DA_z * DB_x;
+      Tangent[4*nLocBas*(4*A+3)+4*B+2] += DA_z * DB_y;
+      Tangent[4*nLocBas*(4*A+3)+4*B+3] += DA_z * DB_z;
+    }
+  }
+}
+
+// EOF
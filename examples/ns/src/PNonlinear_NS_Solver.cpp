@@ -10,7 +10,8 @@ PNonlinear_NS_Solver::PNonlinear_NS_Solver(
     const double &input_ndtol,
     const int &input_max_iteration, 
     const int &input_renew_freq,
-    const int &input_renew_threshold )
+    const int &input_renew_threshold,
+    const Mat &in_shell )
 : nr_tol(input_nrtol), na_tol(input_natol), nd_tol(input_ndtol),
   nmaxits(input_max_iteration), nrenew_freq(input_renew_freq),
   nrenew_threshold(input_renew_threshold),
@@ -18,7 +19,8 @@ PNonlinear_NS_Solver::PNonlinear_NS_Solver(
   bc_mat(std::move(in_bc_mat)),
   tmga(std::move(in_tmga)),
   flrate(std::move(in_flrate)),
-  sol_base(std::move(in_sol_base))
+  sol_base(std::move(in_sol_base)),
+  shell(in_shell)
 {}
 
 void PNonlinear_NS_Solver::print_info() const
@@ -34,13 +36,13 @@ void PNonlinear_NS_Solver::print_info() const
   SYS_T::commPrint("----------------------------------------------------------- \n");
 }
 
-
 void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     const bool &new_tangent_flag,
     const double &curr_time,
     const double &dt,
     const PDNSolution * const &pre_dot_sol,
     const PDNSolution * const &pre_sol,
+    const PDNSolution * const &pred_dot_sol,
     PDNSolution * const &dot_sol,
     PDNSolution * const &sol,
     const ALocal_InflowBC * const &infnbc_part,
@@ -48,19 +50,6 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     IPGAssem * const &gassem_ptr,
     bool &conv_flag, int &nl_counter ) const
 {
-#ifdef PETSC_USE_LOG
-  PetscLogEvent mat_assem_0_event, mat_assem_1_event;
-  PetscLogEvent vec_assem_0_event, vec_assem_1_event;
-  PetscLogEvent lin_solve_event;
-  PetscClassId classid_assembly;
-  PetscClassIdRegister("mat_vec_assembly", &classid_assembly);
-  PetscLogEventRegister("assembly mat 0", classid_assembly, &mat_assem_0_event);
-  PetscLogEventRegister("assembly mat 1", classid_assembly, &mat_assem_1_event);
-  PetscLogEventRegister("assembly vec 0", classid_assembly, &vec_assem_0_event);
-  PetscLogEventRegister("assembly vec 1", classid_assembly, &vec_assem_1_event);
-  PetscLogEventRegister("lin_solve", classid_assembly, &lin_solve_event);
-#endif
-
   // Initialize the counter and error
   nl_counter = 0;
   double residual_norm = 0.0, initial_norm = 0.0, relative_error = 0.0;
@@ -70,10 +59,21 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   const double alpha_m = tmga->get_alpha_m();
   const double alpha_f = tmga->get_alpha_f();
 
-  // Same-Y predictor
-  sol->Copy(*pre_sol);
-  dot_sol->Copy(*pre_dot_sol);
-  dot_sol->ScaleValue( (gamma-1.0)/gamma );
+  if( pred_dot_sol == nullptr )
+  {
+    // Same-Y predictor
+    sol->Copy(*pre_sol);
+    dot_sol->Copy(*pre_dot_sol);
+    dot_sol->ScaleValue( (gamma-1.0)/gamma );
+  }
+  else
+  {
+    // Extrapolated dot_sol with the consistent sol
+    dot_sol->Copy(*pred_dot_sol);
+    sol->Copy(*pre_sol);
+    sol->PlusAX( *pre_dot_sol, (1.0 - gamma) * dt );
+    sol->PlusAX( *pred_dot_sol, gamma * dt );
+  }
 
   // Define the dol_sol at alpha_m: dot_sol_alpha
   PDNSolution dot_sol_alpha(*pre_dot_sol);
@@ -97,37 +97,22 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   {
     gassem_ptr->Clear_KG();
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(mat_assem_0_event, 0,0,0,0);
-#endif
-
     gassem_ptr->Assem_tangent_residual( &dot_sol_alpha, &sol_alpha, dot_sol, sol, 
         curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(mat_assem_0_event,0,0,0,0);
-#endif
-
     SYS_T::commPrint("  --- M updated");
     
     // SetOperator will pass the tangent matrix to the linear solver and the
     // linear solver will generate the preconditioner based on the new matrix.
-    lsolver->SetOperator( gassem_ptr->K );
+    SetOperator( gassem_ptr );
   }
   else
   {
     gassem_ptr->Clear_G();
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(vec_assem_0_event, 0,0,0,0);
-#endif
-
     gassem_ptr->Assem_residual( &dot_sol_alpha, &sol_alpha, dot_sol, sol,
         curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(vec_assem_0_event,0,0,0,0);
-#endif
   }
 
   VecNorm(gassem_ptr->G, NORM_2, &initial_norm);
@@ -138,17 +123,9 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
   // Now do consistent Newton-Raphson iteration
   do
   {
-#ifdef PETSC_USE_LOG
-    PetscLogEventBegin(lin_solve_event, 0,0,0,0);
-#endif
-    
     // solve the equation K dot_step = G
     lsolver->Solve( gassem_ptr->G, dot_step.get() );
 
-#ifdef PETSC_USE_LOG
-    PetscLogEventEnd(lin_solve_event,0,0,0,0);
-#endif
-
     bc_mat->MatMultSol( dot_step.get() );
 
     nl_counter += 1;
@@ -164,34 +141,19 @@ void PNonlinear_NS_Solver::GenAlpha_Solve_NS(
     {
       gassem_ptr->Clear_KG();
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventBegin(mat_assem_1_event, 0,0,0,0);
-#endif
-
       gassem_ptr->Assem_tangent_residual( &dot_sol_alpha, &sol_alpha, dot_sol, sol,
           curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventEnd(mat_assem_1_event,0,0,0,0);
-#endif
-
       SYS_T::commPrint("  --- M updated");
-      lsolver->SetOperator(gassem_ptr->K);
+      SetOperator( gassem_ptr );
     }
     else
     {
       gassem_ptr->Clear_G();
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventBegin(vec_assem_1_event, 0,0,0,0);
-#endif
-
       gassem_ptr->Assem_residual( &dot_sol_alpha, &sol_alpha, dot_sol, sol,
           curr_time, dt, gbc );
 
-#ifdef PETSC_USE_LOG
-      PetscLogEventEnd(vec_assem_1_event,0,0,0,0);
-#endif
     }
 
     VecNorm(gassem_ptr->G, NORM_2, &residual_norm);
@@ -137,6 +137,9 @@ void PTime_NS_HERK_Solver::TM_NS_HERK(
       cur_sol->WriteBinary(sol_name);
     }
 
+    // Write the timing of this step into the performance trace
+    SYS_T::Perf_Registry::instance().Record_step( time_info->get_index() );
+
     // Prepare for next time step
     pre_velo_before->Copy(pre_velo);
     pre_velo->Copy(cur_velo);
@@ -173,14 +176,6 @@ void PTime_NS_HERK_Solver::HERK_Solve_NS(
     PDNSolution * const &pre_velo_before,
     PDNSolution * const &cur_sol ) const
 {
-  #ifdef PETSC_USE_LOG
-    PetscLogEvent K_solve, update_dotstep;
-    PetscClassId classid_solve;
-    PetscClassIdRegister("matsolve", &classid_solve);
-    PetscLogEventRegister("K_solve", classid_solve, &K_solve);
-    PetscLogEventRegister("update_dotstep", classid_solve, &update_dotstep);
-  #endif
-
   auto dot_step = SYS_T::make_unique<PDNSolution>( cur_sol );
 
   // HERK's number of steps
@@ -207,21 +202,11 @@ void PTime_NS_HERK_Solver::HERK_Solve_NS(
    
     Vec sol_vp;
     VecDuplicate( gassem->G, &sol_vp );
-  #ifdef PETSC_USE_LOG
-    PetscLogEventBegin(K_solve, 0,0,0,0);
-  #endif    
     lsolver->Solve( gassem->G, sol_vp ); 
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(K_solve,0,0,0,0);
-  #endif
 
-  #ifdef PETSC_USE_LOG
-  PetscLogEventBegin(update_dotstep, 0,0,0,0);
-  #endif 
+    SYS_T::Perf_Begin( SYS_T::PERF_SOL_UPDATE );
     Update_dot_step( sol_vp, dot_step.get() );
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(update_dotstep, 0,0,0,0);
-  #endif
+    SYS_T::Perf_End( SYS_T::PERF_SOL_UPDATE );
 
     bc_mat->MatMultSol( dot_step.get() );
   
@@ -247,21 +232,11 @@ void PTime_NS_HERK_Solver::HERK_Solve_NS(
 
     Vec sol_vp;
     VecDuplicate( gassem->G, &sol_vp );
-  #ifdef PETSC_USE_LOG
-    PetscLogEventBegin(K_solve, 0,0,0,0);
-  #endif 
     lsolver->Solve( gassem->G, sol_vp ); 
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(K_solve,0,0,0,0);
-  #endif
 
-  #ifdef PETSC_USE_LOG
-  PetscLogEventBegin(update_dotstep, 0,0,0,0);
-  #endif 
+    SYS_T::Perf_Begin( SYS_T::PERF_SOL_UPDATE );
     Update_dot_step( sol_vp, dot_step.get() );
-  #ifdef PETSC_USE_LOG
-    PetscLogEventEnd(update_dotstep, 0,0,0,0);
-  #endif
+    SYS_T::Perf_End( SYS_T::PERF_SOL_UPDATE );
   
     bc_mat->MatMultSol( dot_step.get() );
   
@@ -4,10 +4,41 @@ PTime_NS_Solver::PTime_NS_Solver(
     std::unique_ptr<PNonlinear_NS_Solver> in_nsolver,
     const std::string &input_name,
     const int &input_record_freq, const int &input_renew_tang_freq,
-    const double &input_final_time )
+    const double &input_final_time,
+    const int &input_predictor_type,
+    const int &input_predictor_order,
+    const double &input_predictor_period,
+    const int &input_predictor_max_snap,
+    const int &input_num_write_buffer,
+    std::unique_ptr<PDNSolution_HDF5> in_sol_h5,
+    std::unique_ptr<Insitu_Output_NS> in_insitu,
+    std::unique_ptr<Insitu_WSS_NS> in_wss,
+    std::unique_ptr<Checkpoint_NS> in_chk )
 : final_time(input_final_time), sol_record_freq(input_record_freq),
-  renew_tang_freq(input_renew_tang_freq), pb_name(input_name), nsolver(std::move(in_nsolver))
-{}
+  renew_tang_freq(input_renew_tang_freq), pb_name(input_name),
+  predictor_type(input_predictor_type), predictor_order(input_predictor_order),
+  predictor_period(input_predictor_period),
+  predictor_max_snap(input_predictor_max_snap),
+  num_write_buffer(input_num_write_buffer), nsolver(std::move(in_nsolver)),
+  sol_h5(std::move(in_sol_h5)), insitu(std::move(in_insitu)),
+  wss(std::move(in_wss)), chk(std::move(in_chk))
+{
+  SYS_T::print_fatal_if( predictor_type < 0 || predictor_type > 2,
+      "Error: PTime_NS_Solver unknown predictor type %d.\n", predictor_type );
+
+  SYS_T::print_fatal_if( predictor_type != 0 && predictor_order < 1,
+      "Error: PTime_NS_Solver predictor order should be at least 1.\n" );
+
+  SYS_T::print_fatal_if( predictor_type == 2 && predictor_period <= 0.0,
+      "Error: PTime_NS_Solver POD predictor requires a positive period.\n" );
+
+  SYS_T::print_fatal_if( predictor_type != 0 && predictor_order + 1 > predictor_max_snap,
+      "Error: PTime_NS_Solver predictor order %d requires %d snapshots, more than the cap %d.\n",
+      predictor_order, predictor_order + 1, predictor_max_snap );
+
+  SYS_T::print_fatal_if( num_write_buffer < 0,
+      "Error: PTime_NS_Solver the number of write buffers cannot be negative.\n" );
+}
 
 std::string PTime_NS_Solver::Name_Generator(const int &counter) const
 {
@@ -35,6 +66,24 @@ void PTime_NS_Solver::print_info() const
   SYS_T::commPrint("  solution record frequency : %d \n", sol_record_freq);
   SYS_T::commPrint("  tangent update frequency over time steps: %d \n", renew_tang_freq);
   SYS_T::commPrint("  solution base name: %s \n", pb_name.c_str());
+  if( predictor_type == 0 )
+    SYS_T::commPrint("  predictor: same-Y \n");
+  else if( predictor_type == 1 )
+    SYS_T::commPrint("  predictor: polynomial extrapolation of order %d \n", predictor_order);
+  else
+  {
+    SYS_T::commPrint("  predictor: POD over the previous cycle of period %e \n", predictor_period);
+    SYS_T::commPrint("             polynomial extrapolation of order %d in the first cycle \n", predictor_order);
+    SYS_T::commPrint("             at most %d stored snapshots \n", predictor_max_snap);
+  }
+  if( num_write_buffer > 0 )
+    SYS_T::commPrint("  solution writer: asynchronous with %d staging buffer(s) \n", num_write_buffer);
+  else
+    SYS_T::commPrint("  solution writer: synchronous \n");
+  if( sol_h5 != nullptr ) sol_h5 -> print_info();
+  if( insitu != nullptr ) insitu -> print_info();
+  if( wss != nullptr ) wss -> print_info();
+  if( chk != nullptr ) chk -> print_info();
   SYS_T::commPrint("----------------------------------------------------------- \n");
 }
 
@@ -54,6 +103,28 @@ void PTime_NS_Solver::Write_restart_file(const PDNTimeStep * const &timeinfo,
     SYS_T::print_fatal("Error: PTimeSolver cannot open restart_file.txt");
 }
 
+void PTime_NS_Solver::Write_sol( PDNSolution_Writer * const &writer,
+    const PDNSolution * const &sol, const std::string &file_name ) const
+{
+  if( writer != nullptr ) writer -> Write( sol, file_name );
+  else sol -> WriteBinary( file_name );
+}
+
+void PTime_NS_Solver::Record_sol( PDNSolution_Writer * const &writer,
+    const PDNSolution * const &sol, const PDNSolution * const &dot_sol,
+    const PDNTimeStep * const &time_info ) const
+{
+  const auto sol_name = Name_Generator( time_info->get_index() );
+  Write_sol( writer, sol, sol_name );
+
+  const auto sol_dot_name = Name_dot_Generator( time_info->get_index() );
+  Write_sol( writer, dot_sol, sol_dot_name );
+
+  if( sol_h5 != nullptr )
+    sol_h5 -> Write( sol_name + ".h5", {"sol", "dot_sol"}, {sol, dot_sol},
+        time_info->get_time(), time_info->get_index() );
+}
+
 void PTime_NS_Solver::TM_NS_GenAlpha( 
     const bool &restart_init_assembly_flag,
     std::unique_ptr<PDNSolution> init_dot_sol,
@@ -68,14 +139,20 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
   auto pre_dot_sol = SYS_T::make_unique<PDNSolution>(*init_dot_sol);
   auto cur_dot_sol = SYS_T::make_unique<PDNSolution>(*init_dot_sol);
 
+  // The solutions are staged and written in the background if buffers are
+  // requested
+  std::unique_ptr<PDNSolution_Writer> writer = nullptr;
+  if( num_write_buffer > 0 )
+    writer = SYS_T::make_unique<PDNSolution_Writer>( num_write_buffer );
+
   // If this is a restart run, do not re-write the solution binaries
   if(restart_init_assembly_flag == false)
   {
-    const auto sol_name = Name_Generator(time_info->get_index());
-    cur_sol->WriteBinary(sol_name);
-    
-    const auto sol_dot_name = Name_dot_Generator(time_info->get_index());
-    cur_dot_sol->WriteBinary(sol_dot_name);
+    Record_sol( writer.get(), cur_sol.get(), cur_dot_sol.get(), time_info.get() );
+
+    if( insitu != nullptr ) insitu -> Execute( cur_sol.get(), time_info.get() );
+
+    if( wss != nullptr ) wss -> Accumulate( cur_sol.get(), time_info.get() );
   }
 
   bool conv_flag, renew_flag;
@@ -83,6 +160,44 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
 
   bool rest_flag = restart_init_assembly_flag;
 
+  // Converged dot_sol of the previous steps for the extrapolated predictors
+  int cycle_steps = 0;
+  std::unique_ptr<PDNSolution_History> dot_sol_hist = nullptr;
+  std::unique_ptr<PDNSolution> pred_dot_sol = nullptr;
+
+  if( predictor_type != 0 )
+  {
+    int capacity = predictor_order + 1;
+
+    if( predictor_type == 2 )
+    {
+      cycle_steps = static_cast<int>( std::round( predictor_period / time_info->get_step() ) );
+
+      SYS_T::print_fatal_if( cycle_steps < 2, "Error: PTime_NS_Solver POD predictor requires at least 2 steps per cycle.\n" );
+
+      // The snapshots of one full cycle are kept, do not exceed the cap
+      SYS_T::print_fatal_if( cycle_steps + 2 > predictor_max_snap,
+          "Error: PTime_NS_Solver POD predictor requires %d snapshots for %d steps per cycle, more than the cap %d. Increase -predictor_max_snap if the memory allows.\n",
+          cycle_steps + 2, cycle_steps, predictor_max_snap );
+
+      capacity = std::max( capacity, cycle_steps + 2 );
+    }
+
+    dot_sol_hist = SYS_T::make_unique<PDNSolution_History>( cur_dot_sol.get(), capacity );
+    dot_sol_hist -> Push( cur_dot_sol.get(), time_info->get_time() );
+
+    pred_dot_sol = SYS_T::make_unique<PDNSolution>( *cur_dot_sol );
+
+    dot_sol_hist -> print_info();
+  }
+
+  // The data files appended in each step, whose sizes are checkpointed
+  std::vector<std::string> flow_files {};
+  for(int ff=0; ff<infnbc_part->get_num_nbc(); ++ff)
+    flow_files.push_back( gen_flowfile_name("Inlet_", ff) );
+  for(int ff=0; ff<gbc->get_num_ebc(); ++ff)
+    flow_files.push_back( gen_flowfile_name("Outlet_", ff) );
+
   SYS_T::commPrint("Time = %e, dt = %e, index = %d, %s \n",
       time_info->get_time(), time_info->get_step(), time_info->get_index(),
       SYS_T::get_time().c_str());
@@ -101,28 +216,42 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
     // the tangent matrix
     if( nl_counter == 1 ) renew_flag = false;
 
+    // Predict dot_sol at the new time level, nullptr means same-Y
+    bool is_predicted = false;
+    if( predictor_type == 2 )
+      is_predicted = Predict_POD( dot_sol_hist.get(), cycle_steps, pred_dot_sol.get() );
+
+    if( predictor_type != 0 && !is_predicted )
+      is_predicted = Predict_polynomial( dot_sol_hist.get(),
+          time_info->get_time() + time_info->get_step(), pred_dot_sol.get() );
+
+    const PDNSolution * const pred_ptr = is_predicted ? pred_dot_sol.get() : nullptr;
+
     // Call the nonlinear equation solver
     nsolver->GenAlpha_Solve_NS( renew_flag, 
         time_info->get_time(), time_info->get_step(), pre_dot_sol.get(), 
-        pre_sol.get(), cur_dot_sol.get(), cur_sol.get(), infnbc_part, 
+        pre_sol.get(), pred_ptr, cur_dot_sol.get(), cur_sol.get(), infnbc_part, 
         gbc, gassem_ptr, conv_flag, nl_counter );
 
     // Update the time step information
     time_info->TimeIncrement();
 
+    if( predictor_type != 0 )
+      dot_sol_hist -> Push( cur_dot_sol.get(), time_info->get_time() );
+
     SYS_T::commPrint("Time = %e, dt = %e, index = %d, %s \n",
         time_info->get_time(), time_info->get_step(), time_info->get_index(),
         SYS_T::get_time().c_str());
 
     // Record solution if meets criteria
     if( time_info->get_index()%sol_record_freq == 0 )
-    {
-      const auto sol_name = Name_Generator( time_info->get_index() );
-      cur_sol->WriteBinary(sol_name);
+      Record_sol( writer.get(), cur_sol.get(), cur_dot_sol.get(), time_info.get() );
 
-      const auto sol_dot_name = Name_dot_Generator(time_info->get_index());
-      cur_dot_sol->WriteBinary(sol_dot_name);
-    }
+    // Write the in-situ output if meets its own frequency
+    if( insitu != nullptr ) insitu -> Execute( cur_sol.get(), time_info.get() );
+
+    // Update the running sums of the wall shear stress
+    if( wss != nullptr ) wss -> Accumulate( cur_sol.get(), time_info.get() );
 
     // Calculate the flow rate & averaged pressure on all outlets
     record_outlet_data(cur_sol.get(), cur_dot_sol.get(), time_info.get(), gbc, gassem_ptr, false, true);
@@ -130,10 +259,103 @@ void PTime_NS_Solver::TM_NS_GenAlpha(
     // Calcualte the inlet data
     record_inlet_data(cur_sol.get(), time_info.get(), infnbc_part, gassem_ptr, false, true);
 
+    // Checkpoint the state after the GenBC is reset for the next step
+    if( chk != nullptr )
+      chk -> Write( cur_sol.get(), cur_dot_sol.get(), time_info.get(), gbc, flow_files );
+
+    // Write the timing of this step into the performance trace
+    SYS_T::Perf_Registry::instance().Record_step( time_info->get_index() );
+
     // Prepare for next time step
     pre_sol->Copy(*cur_sol);
     pre_dot_sol->Copy(*cur_dot_sol);
   }
+
+  // Make sure all solution files are complete on disk
+  if( writer != nullptr ) writer -> Flush();
+
+  // Write the TAWSS and OSI of the accumulated samples
+  if( wss != nullptr ) wss -> Write( time_info.get() );
+}
+
+bool PTime_NS_Solver::Predict_polynomial(
+    const PDNSolution_History * const &hist,
+    const double &new_time, PDNSolution * const &pred_dot_sol ) const
+{
+  // Use the highest order the stored history allows
+  const int num = std::min( predictor_order + 1, hist->get_size() );
+
+  if( num < 2 ) return false;
+
+  std::vector<double> weight( num, 1.0 );
+  std::vector<Vec> vecs( num );
+
+  for(int ii=0; ii<num; ++ii)
+  {
+    const double t_ii = hist -> get_time(ii);
+    for(int jj=0; jj<num; ++jj)
+    {
+      if( jj != ii )
+      {
+        const double t_jj = hist -> get_time(jj);
+        weight[ii] *= ( new_time - t_jj ) / ( t_ii - t_jj );
+      }
+    }
+    vecs[ii] = hist -> get_sol(ii) -> solution;
+  }
+
+  VecSet( pred_dot_sol->solution, 0.0 );
+  VecMAXPY( pred_dot_sol->solution, num, &weight[0], &vecs[0] );
+  pred_dot_sol -> GhostUpdate();
+
+  return true;
+}
+
+bool PTime_NS_Solver::Predict_POD( const PDNSolution_History * const &hist,
+    const int &cycle_steps, PDNSolution * const &pred_dot_sol ) const
+{
+  // The basis requires the snapshots up to lag cycle_steps + 1
+  if( hist->get_size() < cycle_steps + 2 ) return false;
+
+  // Basis B_j at lag N-j and the same snapshots shifted by one step forward
+  const Vec basis[3] = { hist->get_sol( cycle_steps + 1 )->solution,
+    hist->get_sol( cycle_steps )->solution,
+    hist->get_sol( cycle_steps - 1 )->solution };
+
+  Vec shift[3] = { hist->get_sol( cycle_steps )->solution,
+    hist->get_sol( cycle_steps - 1 )->solution,
+    hist->get_sol( cycle_steps - 2 )->solution };
+
+  // Gram matrix and the right-hand side with one reduction each
+  MATH_T::Matrix_SymPos_Dense<3> gram;
+  std::array<double, 3> rhs {};
+
+  VecMDot( hist->get_sol(0)->solution, 3, basis, &rhs[0] );
+
+  for(int ii=0; ii<3; ++ii)
+  {
+    double row[3];
+    VecMDot( basis[ii], 3, basis, row );
+    for(int jj=0; jj<3; ++jj) gram(ii, jj) = row[jj];
+  }
+
+  const double trace = gram(0,0) + gram(1,1) + gram(2,2);
+
+  // The previous cycle is at rest, there is nothing to project onto
+  if( trace <= 0.0 ) return false;
+
+  // Consecutive snapshots are nearly parallel: a small Tikhonov shift keeps
+  // the normal equation definite
+  for(int ii=0; ii<3; ++ii) gram(ii, ii) += 1.0e-10 * trace;
+
+  gram.LDLt_fac();
+  const std::array<double, 3> coef = gram.LDLt_solve( rhs );
+
+  VecSet( pred_dot_sol->solution, 0.0 );
+  VecMAXPY( pred_dot_sol->solution, 3, &coef[0], shift );
+  pred_dot_sol -> GhostUpdate();
+
+  return true;
 }
 
 void PTime_NS_Solver::record_inlet_data( 
@@ -146,11 +368,15 @@ void PTime_NS_Solver::record_inlet_data(
 {
   auto mode = is_restart ? std::ofstream::app : std::ofstream::trunc;
 
+  // Surface integrals of all inlets with one reduction over CPUs
+  std::vector<double> face_flrate, face_avepre;
+  gassem_ptr->Assem_surface_inlet_data(sol, infnbc_part, face_flrate, face_avepre);
+
   for(int ff=0; ff<infnbc_part->get_num_nbc(); ++ff)
   {
-    const double flrate = gassem_ptr->Assem_surface_flowrate(sol, infnbc_part, ff); 
+    const double flrate = face_flrate[ff];
 
-    const double avepre = gassem_ptr->Assem_surface_ave_pressure(sol, infnbc_part, ff);
+    const double avepre = face_avepre[ff];
 
     if( SYS_T::get_MPI_rank() == 0 )
     {
@@ -173,8 +399,7 @@ void PTime_NS_Solver::record_inlet_data(
       }
 
       ofile.close();
-    } 
-    MPI_Barrier(PETSC_COMM_WORLD);
+    }
   }
 }
 
@@ -189,16 +414,17 @@ void PTime_NS_Solver::record_outlet_data(
 {
   auto mode = is_restart ? std::ofstream::app : std::ofstream::trunc;
 
+  // Surface integrals of all outlets with one reduction over CPUs
+  std::vector<double> dot_flrate, flrate, avepre;
+  gassem_ptr -> Assem_surface_outlet_data( dot_sol, sol, dot_flrate, flrate, avepre );
+
   for(int ff=0; ff<gbc->get_num_ebc(); ++ff)
   {
-    const double dot_face_flrate = gassem_ptr -> Assem_surface_flowrate( 
-        dot_sol, ff); 
+    const double dot_face_flrate = dot_flrate[ff];
 
-    const double face_flrate = gassem_ptr -> Assem_surface_flowrate( 
-        sol, ff); 
+    const double face_flrate = flrate[ff];
 
-    const double face_avepre = gassem_ptr -> Assem_surface_ave_pressure( 
-        sol, ff);
+    const double face_avepre = avepre[ff];
 
     double lpn_pressure;
 
@@ -241,7 +467,6 @@ void PTime_NS_Solver::record_outlet_data(
 
       ofile.close();
     }
-    MPI_Barrier(PETSC_COMM_WORLD);
   }
 }
 
@@ -28,8 +28,26 @@ void VisDataPrep_NS::get_pointArray(
   PostVectSolution pvsolu(solution_file_name, analysis_node_mapping_file,
       post_node_mapping_file, nNode_ptr, input_nfunc, input_dof);
 
+  fill_pointArray( pvsolu, solArrays );
+}
+
+void VisDataPrep_NS::get_pointArray(
+    const std::string &solution_file_name,
+    const PostVectScatter * const &scatter,
+    double ** &solArrays ) const
+{
+  PostVectSolution pvsolu(solution_file_name, scatter);
+
+  fill_pointArray( pvsolu, solArrays );
+}
+
+void VisDataPrep_NS::fill_pointArray( const PostVectSolution &pvsolu,
+    double ** &solArrays ) const
+{
+  const int input_dof = pvsolu.get_dof();
+
   // Total number of nodes to be read from the solution vector
-  const int ntotal = nNode_ptr->get_nlocghonode();
+  const int ntotal = pvsolu.get_solsize() / input_dof;
  
   // Assign the solution values to the corresponding physical field
   // container 
@@ -12,6 +12,7 @@
 #include "FEAElementFactory.hpp"
 #include "VisDataPrep_NS.hpp"
 #include "VTK_Writer_NS.hpp"
+#include "XDMF_Writer.hpp"
 
 int main( int argc, char * argv[] )
 {
@@ -23,8 +24,12 @@ int main( int argc, char * argv[] )
   
   std::string sol_bname("SOL_");
   std::string out_bname = sol_bname;
+
+  // Suffix of the solution files, e.g. .h5 for the HDF5 snapshots. If it
+  // is empty, the snapshot is read when the PETSc binary file is missing.
+  std::string sol_suffix("");
   int time_start = 0, time_step = 1, time_end = 1;
-  bool isXML = true, isRestart = false;
+  bool isXML = true, isRestart = false, isXDMF = false;
 
   // Read analysis code parameter if the solver_cmd.h5 exists
   hid_t prepcmd_file = H5Fopen("solver_cmd.h5", H5F_ACC_RDONLY, H5P_DEFAULT);
@@ -51,12 +56,15 @@ int main( int argc, char * argv[] )
   SYS_T::GetOptionReal("-dt", dt);
   SYS_T::GetOptionString("-sol_bname", sol_bname);
   SYS_T::GetOptionString("-out_bname", out_bname);
+  SYS_T::GetOptionString("-sol_suffix", sol_suffix);
   SYS_T::GetOptionBool("-xml", isXML);
   SYS_T::GetOptionBool("-restart", isRestart);
+  SYS_T::GetOptionBool("-xdmf", isXDMF);
   
   SYS_T::commPrint("=== Command line arguments ===\n");
   SYS_T::cmdPrint("-sol_bname:", sol_bname);
   SYS_T::cmdPrint("-out_bname:", out_bname);
+  SYS_T::cmdPrint("-sol_suffix:", sol_suffix);
   SYS_T::cmdPrint("-time_start:", time_start);
   SYS_T::cmdPrint("-time_step:", time_step);
   SYS_T::cmdPrint("-time_end:", time_end);
@@ -66,6 +74,9 @@ int main( int argc, char * argv[] )
 
   if(isRestart) SYS_T::commPrint("-restart: true \n");
   else SYS_T::commPrint("-restart: false \n");
+
+  if(isXDMF) SYS_T::commPrint("-xdmf: true \n");
+  else SYS_T::commPrint("-xdmf: false \n");
   SYS_T::commPrint("==============================\n");
   
   // Clean the visualization files if not restart
@@ -109,35 +120,54 @@ int main( int argc, char * argv[] )
   for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
     solArrays[ii] = new double [pNode->get_nlocghonode() * visprep->get_ptarray_comp_length(ii)];
 
-  // VTK writer 
-  auto vtk_w = SYS_T::make_unique<VTK_Writer_NS>( GMIptr->get_nElem(), 
-      GMIptr->get_nLocBas(), element_part_file );
+  // VTK writer, or the XDMF writer that writes the geometry only once
+  std::unique_ptr<VTK_Writer_NS> vtk_w = nullptr;
+  std::unique_ptr<XDMF_Writer> xdmf_w = nullptr;
+
+  if( isXDMF )
+  {
+    xdmf_w = SYS_T::make_unique<XDMF_Writer>( out_bname + "xdmf", fNode.get(),
+        locIEN.get(), locElem.get(), elemType, pNode->get_nlocghonode(),
+        VIS_T::read_epart( element_part_file, GMIptr->get_nElem() ), isRestart );
+
+    xdmf_w->print_info();
+  }
+  else
+    vtk_w = SYS_T::make_unique<VTK_Writer_NS>( GMIptr->get_nElem(),
+        GMIptr->get_nLocBas(), element_part_file );
+
+  // The node reordering is set up once and reused for all time steps
+  auto scatter = SYS_T::make_unique<PostVectScatter>( anode_mapping_file,
+      pnode_mapping_file, pNode.get(), GMIptr->get_nFunc(), dof );
 
   std::ostringstream time_index;
 
   for(int time = time_start; time<=time_end; time+= time_step)
   {
-    std::string name_to_read(sol_bname);
+    const std::string name_to_read = VIS_T::get_sol_name( sol_bname, time, sol_suffix );
     std::string name_to_write(out_bname);
     time_index.str("");
     time_index<< 900000000 + time;
-    name_to_read.append(time_index.str());
     name_to_write.append(time_index.str());
 
     SYS_T::commPrint("Time %d: Read %s and Write %s \n",
         time, name_to_read.c_str(), name_to_write.c_str() );
 
-    visprep->get_pointArray(name_to_read, anode_mapping_file, pnode_mapping_file,
-        pNode.get(), GMIptr->get_nFunc(), dof, solArrays);
+    visprep->get_pointArray(name_to_read, scatter.get(), solArrays);
 
-    vtk_w->writeOutput( fNode.get(), locIEN.get(), locElem.get(),
-        visprep.get(), element.get(), quad.get(), solArrays,
-        rank, size, time * dt, sol_bname, out_bname, name_to_write, isXML );
+    if( isXDMF )
+      xdmf_w->write_step( time, time * dt, visprep.get(), solArrays );
+    else
+      vtk_w->writeOutput( fNode.get(), locIEN.get(), locElem.get(),
+          visprep.get(), element.get(), quad.get(), solArrays,
+          rank, size, time * dt, sol_bname, out_bname, name_to_write, isXML );
   }
 
   MPI_Barrier(PETSC_COMM_WORLD);
 
   // ===== Clean the memory =====
+  xdmf_w.reset();
+  scatter.reset();
   for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
     delete [] solArrays[ii];
   delete [] solArrays;
@@ -0,0 +1,169 @@
+// ============================================================================
+// vis_h5_test.cpp
+//
+// Test of the vis_ns reading path on an HDF5 snapshot. The node mappings of
+// a four-node mesh are written with permuted analysis and postprocessing
+// numberings, and a snapshot of a solution with known nodal values is
+// written by PDNSolution_HDF5, without the PETSc binary file. The name is
+// resolved by VIS_T::get_sol_name as in vis.cpp, and the snapshot is read by
+// VisDataPrep_NS through the PostVectScatter and through the direct
+// PostVectSolution reading. The pressure and velocity of each
+// postprocessing node are checked against the values of its natural node.
+//
+// Usage: ./vis_h5_test (on one CPU)
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "VisDataPrep_NS.hpp"
+#include "PDNSolution_HDF5.hpp"
+#include "Vis_Tools.hpp"
+#include "HDF5_Writer.hpp"
+
+namespace
+{
+  const std::string part_name("vis_h5_test_part");
+  const std::string anode_mapping_file("vis_h5_test_node_mapping.h5");
+  const std::string pnode_mapping_file("vis_h5_test_post_node_mapping.h5");
+  const std::string sol_bname("vis_h5_test_SOL_");
+
+  const int nFunc = 4, dof = 4;
+
+  // The analysis and the postprocessing numberings of the natural nodes
+  const std::vector<int> analysis_old2new { 2, 0, 3, 1 };
+  const std::vector<int> postproc_new2old { 1, 3, 0, 2 };
+
+  // Nodal values of the natural node nn, the pressure and the velocity
+  double exact_value( const int &nn, const int &comp )
+  {
+    return 10.0 * nn + comp;
+  }
+
+  // --------------------------------------------------------------------------
+  // Write the node mappings, and the partition of all nodes on rank 0 with
+  // the groups read by APart_Node. The analysis and the postprocessing runs
+  // share the partition, and only the mappings differ.
+  // --------------------------------------------------------------------------
+  void write_mesh()
+  {
+    hid_t file_id = H5Fcreate( anode_mapping_file.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+    auto h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+    h5w -> write_intVector( "old_2_new", analysis_old2new );
+    h5w.reset(); H5Fclose( file_id );
+
+    file_id = H5Fcreate( pnode_mapping_file.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+    h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+    h5w -> write_intVector( "new_2_old", postproc_new2old );
+    h5w.reset(); H5Fclose( file_id );
+
+    const std::string fName = SYS_T::gen_partfile_name( part_name, 0 );
+
+    file_id = H5Fcreate( fName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+    h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+
+    hid_t group_id = H5Gcreate( file_id, "Global_Mesh_Info", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "dofNum", dof );
+    H5Gclose( group_id );
+
+    group_id = H5Gcreate( file_id, "Local_Node", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    h5w -> write_intScalar( group_id, "nlocalnode", nFunc );
+    h5w -> write_intScalar( group_id, "nghostnode", 0 );
+    h5w -> write_intScalar( group_id, "nbadnode", 0 );
+    h5w -> write_intScalar( group_id, "nlocghonode", nFunc );
+    h5w -> write_intScalar( group_id, "ntotalnode", nFunc );
+    h5w -> write_intVector( group_id, "local_to_global", std::vector<int>{ 0, 1, 2, 3 } );
+    h5w -> write_intVector( group_id, "node_loc", std::vector<int>{ 0, 1, 2, 3 } );
+    H5Gclose( group_id );
+
+    h5w.reset(); H5Fclose( file_id );
+  }
+
+  // max | solArrays - exact | over the postprocessing nodes
+  double get_error( double ** const &solArrays )
+  {
+    double err = 0.0;
+    for(int ii=0; ii<nFunc; ++ii)
+    {
+      const int nn = postproc_new2old[ii];
+      err = std::max( err, std::abs( solArrays[0][ii] - exact_value(nn, 0) ) );
+      for(int cc=0; cc<3; ++cc)
+        err = std::max( err, std::abs( solArrays[1][3*ii+cc] - exact_value(nn, cc+1) ) );
+    }
+    return err;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+#if PETSC_VERSION_LT(3,19,0)
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULL);
+#else
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULLPTR);
+#endif
+
+  SYS_T::print_fatal_if( SYS_T::get_MPI_size() != 1, "Error: vis_h5_test runs on one CPU.\n" );
+
+  write_mesh();
+
+  auto pNode = SYS_T::make_unique<APart_Node>( part_name, 0 );
+
+  // The solution in the analysis numbering, written as the snapshot of the
+  // step 2 only
+  auto sol = SYS_T::make_unique<PDNSolution>( pNode.get(), dof );
+  for(int nn=0; nn<nFunc; ++nn)
+    for(int cc=0; cc<dof; ++cc)
+      VecSetValue( sol->solution, analysis_old2new[nn]*dof+cc, exact_value(nn, cc), INSERT_VALUES );
+  VecAssemblyBegin( sol->solution ); VecAssemblyEnd( sol->solution );
+  sol->GhostUpdate();
+
+  const PDNSolution_HDF5 sol_h5( std::vector<std::string>{"pressure", "velocity"},
+      std::vector<int>{1, 3}, anode_mapping_file );
+
+  const std::string h5_name = sol_bname + "900000002.h5";
+  std::remove( ( sol_bname + "900000002" ).c_str() );
+
+  sol_h5.Write( h5_name, {"sol"}, {sol.get()}, 0.2, 2 );
+
+  // The snapshot is found without and with the suffix
+  const std::string name_fallback = VIS_T::get_sol_name( sol_bname, 2 );
+  const std::string name_suffix   = VIS_T::get_sol_name( sol_bname, 2, ".h5" );
+
+  const bool is_name_ok = name_fallback == h5_name && name_suffix == h5_name;
+
+  std::cout<<"resolved "<<name_fallback<<" and "<<name_suffix<<'\n';
+
+  // Read the snapshot as vis_ns does
+  const auto visprep = SYS_T::make_unique<VisDataPrep_NS>();
+
+  double ** solArrays = new double * [visprep->get_ptarray_size()];
+  for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
+    solArrays[ii] = new double [pNode->get_nlocghonode() * visprep->get_ptarray_comp_length(ii)];
+
+  auto scatter = SYS_T::make_unique<PostVectScatter>( anode_mapping_file,
+      pnode_mapping_file, pNode.get(), nFunc, dof );
+
+  visprep->get_pointArray( name_fallback, scatter.get(), solArrays );
+
+  const double err_scatter = get_error( solArrays );
+
+  visprep->get_pointArray( name_fallback, anode_mapping_file, pnode_mapping_file,
+      pNode.get(), nFunc, dof, solArrays );
+
+  const double err_direct = get_error( solArrays );
+
+  std::cout<<"scatter error "<<err_scatter<<", direct error "<<err_direct<<'\n';
+
+  const bool is_passed = is_name_ok && err_scatter < 1.0e-12 && err_direct < 1.0e-12;
+
+  std::cout<<( is_passed ? "PASSED" : "FAILED" )<<'\n';
+
+  scatter.reset(); sol.reset();
+  for(int ii=0; ii<visprep->get_ptarray_size(); ++ii)
+    delete [] solArrays[ii];
+  delete [] solArrays;
+
+  PetscFinalize();
+
+  return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// EOF
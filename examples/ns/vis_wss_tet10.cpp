@@ -81,6 +81,10 @@ int main( int argc, char * argv[] )
 
   const double fluid_mu = cmd_h5r -> read_doubleScalar("/", "fl_mu");
 
+  // The WSS here uses the constant fl_mu
+  SYS_T::print_fatal_if( cmd_h5r->check_data("/vis_model") && cmd_h5r->read_intScalar("/", "vis_model") != 0,
+      "Error: the solution is computed with a non-Newtonian viscosity model, use the in-situ WSS of the solver (-wss_freq) instead.\n" );
+
   delete cmd_h5r; H5Fclose(prepcmd_file);
 
   // Enforce the element to be quadratic tet for now
@@ -0,0 +1,252 @@
+// ============================================================================
+// matmodel_fused_test.cpp
+//
+// Consistency checks of the fused stress and elasticity tensor evaluation
+// eval_PK_Stiffness of the isochoric GOH06, GOH14, and NeoHookean models at
+// random deformation gradients. The fused result is compared with
+// 1. get_PK_Stiffness, which has to be bitwise identical;
+// 2. eval_PK_Stiffness_batch, which has to be bitwise identical;
+// 3. the separate stress calls get_PK_1st and get_PK_2nd;
+// 4. the former get_PK_Stiffness of each model, kept below verbatim as the
+//    reference of the elasticity tensor.
+//
+// Usage: ./matmodel_fused_test
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include <random>
+#include "MaterialModel_ich_GOH06.hpp"
+#include "MaterialModel_ich_GOH14.hpp"
+#include "MaterialModel_ich_NeoHookean.hpp"
+
+namespace
+{
+  // Material parameters of the fibre-reinforced models
+  constexpr double mu = 1.0e5, f1the = 49.98, f1phi = 49.98, f2the = 49.98,
+            f2phi = 180.0 - 49.98, fk1 = 3.0e5, fk2 = 2.3, fkd = 0.1;
+
+  // --------------------------------------------------------------------------
+  // The get_PK_Stiffness of the models before the fused evaluation
+  // --------------------------------------------------------------------------
+  SymmTensor4_3D ref_GOH06( const Vector_3 &a1, const Vector_3 &a2,
+      const Tensor2_3D &F, Tensor2_3D &P_ich, SymmTensor2_3D &S_ich )
+  {
+    constexpr double pt67 = 2.0 / 3.0;
+    const auto CC = STen2::gen_right_Cauchy_Green(F);
+    const double I1 = CC.tr();
+    const auto invCC = STen2::inverse(CC);
+    const double detFm0d67 = std::pow(F.det(), -pt67);
+
+    const auto S_iso = mu * detFm0d67 * STen2::gen_DEV_part(STen2::gen_id(), CC );
+
+    const double I4 = CC.VecMatVec(a1, a1);
+    const double I6 = CC.VecMatVec(a2, a2);
+
+    const double fE1 = detFm0d67 * (fkd*I1 + (1.0 -3.0*fkd)*I4) - 1.0;
+    const double fE2 = detFm0d67 * (fkd*I1 + (1.0 -3.0*fkd)*I6) - 1.0;
+
+    const double dfpsi1_dfE1 = fk1 * fE1 * std::exp( fk2 * fE1 * fE1);
+    const double dfpsi2_dfE2 = fk1 * fE2 * std::exp( fk2 * fE2 * fE2);
+
+    const auto H_f1 = fkd * STen2::gen_id() + (1 - 3*fkd) * STen2::gen_dyad(a1);
+    const auto H_f2 = fkd * STen2::gen_id() + (1 - 3*fkd) * STen2::gen_dyad(a2);
+
+    const auto S_fi1 = 2.0 * detFm0d67 * dfpsi1_dfE1 * STen2::gen_DEV_part(H_f1, CC );
+    const auto S_fi2 = 2.0 * detFm0d67 * dfpsi2_dfE2 * STen2::gen_DEV_part(H_f2, CC );
+
+    S_ich = S_iso + S_fi1 + S_fi2;
+
+    P_ich = F * S_ich;
+
+    auto PKstiff = pt67 * detFm0d67 * mu * I1 * STen4::gen_Ptilde( invCC );
+
+    const double d2fpsi1_dfE1 = fk1 * (1.0 + 2.0*fk2*fE1*fE1) * std::exp(fk2*fE1*fE1);
+    const double d2fpsi2_dfE2 = fk1 * (1.0 + 2.0*fk2*fE2*fE2) * std::exp(fk2*fE2*fE2);
+
+    const double val1 = 2.0 * pt67 * detFm0d67 * dfpsi1_dfE1 * (fkd * I1 + (1.0-3.0*fkd)*I4);
+    const double val2 = 2.0 * pt67 * detFm0d67 * dfpsi2_dfE2 * (fkd * I1 + (1.0-3.0*fkd)*I6);
+
+    PKstiff += (val1 + val2) * STen4::gen_Ptilde( invCC );
+
+    const double val = 4.0 * detFm0d67 * detFm0d67;
+
+    PKstiff.add_OutProduct(val * d2fpsi1_dfE1, STen2::gen_DEV_part(H_f1, CC));
+    PKstiff.add_OutProduct(val * d2fpsi2_dfE2, STen2::gen_DEV_part(H_f2, CC));
+
+    PKstiff.add_SymmOutProduct(-pt67, invCC, S_ich);
+
+    return PKstiff;
+  }
+
+  SymmTensor4_3D ref_GOH14( const Vector_3 &a1, const Vector_3 &a2,
+      const Tensor2_3D &F, Tensor2_3D &P_ich, SymmTensor2_3D &S_ich )
+  {
+    constexpr double pt67 = 2.0 / 3.0;
+
+    const auto C = STen2::gen_right_Cauchy_Green( F );
+
+    const double val = mu * std::pow( F.det(), -pt67 );
+
+    const double I1 = C.tr();
+    const double I4 = C.VecMatVec( a1, a1 );
+    const double I6 = C.VecMatVec( a2, a2 );
+
+    const double fE1 = fkd * I1 + ( 1.0 - 3.0 * fkd ) * I4 - 1.0;
+    const double fE2 = fkd * I1 + ( 1.0 - 3.0 * fkd ) * I6 - 1.0;
+
+    const double dfpsi1_dfE1 = fk1 * fE1 * std::exp( fk2 * fE1 * fE1 );
+    const double dfpsi2_dfE2 = fk1 * fE2 * std::exp( fk2 * fE2 * fE2 );
+
+    const auto H_f1 = fkd * STen2::gen_id() + ( 1.0 - 3.0 * fkd ) * STen2::gen_dyad( a1 );
+    const auto H_f2 = fkd * STen2::gen_id() + ( 1.0 - 3.0 * fkd ) * STen2::gen_dyad( a2 );
+
+    const auto S_iso = val * STen2::gen_DEV_part(STen2::gen_id(), C );
+
+    S_ich = S_iso + 2.0 * dfpsi1_dfE1 * H_f1 + 2.0 * dfpsi2_dfE2 * H_f2;
+
+    P_ich = F * S_ich;
+
+    const double d2fpsi1_dfE1 = fk1 * ( 1.0 + 2.0 * fk2 * fE1 * fE1 ) * std::exp( fk2 * fE1 * fE1 );
+    const double d2fpsi2_dfE2 = fk1 * ( 1.0 + 2.0 * fk2 * fE2 * fE2 ) * std::exp( fk2 * fE2 * fE2 );
+
+    auto CC_ich = pt67 * val * I1 * STen4::gen_Ptilde( STen2::inverse(C) );
+
+    CC_ich.add_SymmOutProduct( -pt67, STen2::inverse(C), S_iso );
+
+    CC_ich.add_OutProduct( 4.0 * d2fpsi1_dfE1, H_f1 );
+    CC_ich.add_OutProduct( 4.0 * d2fpsi2_dfE2, H_f2 );
+
+    return CC_ich;
+  }
+
+  SymmTensor4_3D ref_NeoHookean( const Vector_3 &, const Vector_3 &,
+      const Tensor2_3D &F, Tensor2_3D &P_ich, SymmTensor2_3D &S_ich )
+  {
+    constexpr double pt67 = 2.0 / 3.0;
+    const auto CC = STen2::gen_right_Cauchy_Green(F);
+    const double val = mu * std::pow(CC.det(), -pt67 * 0.5);
+
+    S_ich = val * STen2::gen_DEV_part( STen2::gen_id(), CC );
+
+    P_ich = F * S_ich;
+
+    const auto invCC = STen2::inverse(CC);
+    auto out = pt67 * val * CC.tr() * STen4::gen_Ptilde( invCC );
+
+    out.add_SymmOutProduct(-pt67, invCC, S_ich);
+
+    return out;
+  }
+
+  // max |aa - bb| and max |bb| over num entries
+  template<typename T>
+  void compare( const int &num, const T &aa, const T &bb, double &diff,
+      double &scale )
+  {
+    for(int ii=0; ii<num; ++ii)
+    {
+      diff  = std::max( diff, std::abs( aa(ii) - bb(ii) ) );
+      scale = std::max( scale, std::abs( bb(ii) ) );
+    }
+  }
+
+  template<typename T>
+  bool is_bitwise( const int &num, const T &aa, const T &bb )
+  {
+    for(int ii=0; ii<num; ++ii)
+      if( aa(ii) != bb(ii) ) return false;
+    return true;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  typedef SymmTensor4_3D (*Ref_Stiffness)( const Vector_3 &, const Vector_3 &,
+      const Tensor2_3D &, Tensor2_3D &, SymmTensor2_3D & );
+
+  std::vector< std::unique_ptr<IMaterialModel_ich> > models {};
+  models.push_back( SYS_T::make_unique<MaterialModel_ich_GOH06>( mu, f1the, f1phi, f2the, f2phi, fk1, fk2, fkd ) );
+  models.push_back( SYS_T::make_unique<MaterialModel_ich_GOH14>( mu, f1the, f1phi, f2the, f2phi, fk1, fk2, fkd ) );
+  models.push_back( SYS_T::make_unique<MaterialModel_ich_NeoHookean>( mu ) );
+
+  const std::vector<Ref_Stiffness> refs { &ref_GOH06, &ref_GOH14, &ref_NeoHookean };
+  const std::vector<bool> has_fibre { true, true, false };
+
+  // Random deformation gradients with positive determinant
+  constexpr int num_F = 20;
+  std::mt19937 gen( 2026 );
+  std::uniform_real_distribution<double> dist( -0.3, 0.3 );
+
+  std::vector<Tensor2_3D> FF( num_F );
+  for(auto &F : FF)
+  {
+    do {
+      F = Ten2::gen_id();
+      for(int ii=0; ii<9; ++ii) F(ii) += dist( gen );
+    } while( F.det() < 0.5 );
+  }
+
+  const double tol = 1.0e-12;
+  bool is_passed = true;
+
+  for(int mm=0; mm<static_cast<int>( models.size() ); ++mm)
+  {
+    const auto &model = models[mm];
+
+    // The fibre directions of GOH06 and GOH14
+    const Vector_3 a1 = has_fibre[mm] ? model->get_fibre_dir(0) : Vector_3();
+    const Vector_3 a2 = has_fibre[mm] ? model->get_fibre_dir(1) : Vector_3();
+
+    std::vector<Tensor2_3D> P_batch( num_F );
+    std::vector<SymmTensor2_3D> S_batch( num_F );
+    std::vector<SymmTensor4_3D> CC_batch( num_F );
+
+    model->eval_PK_Stiffness_batch( num_F, &FF[0], &P_batch[0], &S_batch[0], &CC_batch[0] );
+
+    bool is_same = true;
+    double dP = 0.0, sP = 0.0, dS = 0.0, sS = 0.0, dCC = 0.0, sCC = 0.0;
+
+    for(int ff=0; ff<num_F; ++ff)
+    {
+      const auto &F = FF[ff];
+
+      Tensor2_3D P; SymmTensor2_3D S; SymmTensor4_3D CC;
+      model->eval_PK_Stiffness( F, P, S, CC );
+
+      // 1. and 2. The wrappers of the fused evaluation
+      Tensor2_3D P_wrap; SymmTensor2_3D S_wrap;
+      const SymmTensor4_3D CC_wrap = model->get_PK_Stiffness( F, P_wrap, S_wrap );
+
+      is_same = is_same && is_bitwise( 9, P, P_wrap ) && is_bitwise( 6, S, S_wrap )
+        && is_bitwise( 21, CC, CC_wrap ) && is_bitwise( 9, P, P_batch[ff] )
+        && is_bitwise( 6, S, S_batch[ff] ) && is_bitwise( 21, CC, CC_batch[ff] );
+
+      // 3. The separate stress calls
+      compare( 9, P, model->get_PK_1st( F ), dP, sP );
+      compare( 6, S, model->get_PK_2nd( F ), dS, sS );
+
+      // 4. The former elasticity tensor
+      Tensor2_3D P_ref; SymmTensor2_3D S_ref;
+      const SymmTensor4_3D CC_ref = refs[mm]( a1, a2, F, P_ref, S_ref );
+
+      compare( 9, P, P_ref, dP, sP );
+      compare( 6, S, S_ref, dS, sS );
+      compare( 21, CC, CC_ref, dCC, sCC );
+    }
+
+    const bool is_model_passed = is_same && dP <= tol * sP && dS <= tol * sS
+      && dCC <= tol * sCC;
+
+    std::cout<<model->get_model_name()<<": wrappers and batch bitwise identical: "
+      <<( is_same ? "yes" : "NO" )<<", relative error P "<<dP / sP<<", S "<<dS / sS
+      <<", CC "<<dCC / sCC<<'\n';
+
+    is_passed = is_passed && is_model_passed;
+  }
+
+  std::cout<<( is_passed ? "PASSED" : "FAILED" )<<'\n';
+
+  return is_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// EOF
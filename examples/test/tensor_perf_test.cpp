@@ -0,0 +1,417 @@
+// ============================================================================
+// tensor_perf_test.cpp
+//
+// Microbenchmark of the rank-four tensor kernels evaluated at the solid
+// quadrature points. Each kernel is compared with a copy of its former
+// implementation for correctness, and the time per call, the speedup, and
+// the GFLOP/s of the current kernel are reported.
+//
+// Usage: ./tensor_perf [number of repetitions]
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include <chrono>
+#include "SymmTensor4_3D.hpp"
+
+namespace
+{
+  // Former Tensor4_3D::TenLRMult: temp_ij = L_im ten_mn R_nj
+  Tensor4_3D ref_TenLRMult( const Tensor4_3D &tleft, const Tensor4_3D &ten,
+      const Tensor4_3D &tright )
+  {
+    Tensor4_3D out;
+    for(int ii=0; ii<9; ++ii)
+    {
+      for(int jj=0; jj<9; ++jj)
+      {
+        out(9*ii+jj) = 0.0;
+        for(int mm=0; mm<9; ++mm)
+          for(int nn=0; nn<9; ++nn)
+            out(9*ii+jj) += tleft(9*ii+mm) * ten(9*mm+nn) * tright(9*nn+jj);
+      }
+    }
+    return out;
+  }
+
+  // Former Tensor4_3D::TenPMult: temp_ij = P_im ten_mn P_jn
+  Tensor4_3D ref_TenPMult( const Tensor4_3D &P, const Tensor4_3D &ten )
+  {
+    return ref_TenLRMult( P, ten, Ten4::transpose(P) );
+  }
+
+  // Voigt mapping of SymmTensor4_3D used by the former kernels
+  constexpr std::array<int,9> map {{ 0, 5, 4, 5, 1, 3, 4, 3, 2 }};
+
+  constexpr std::array<int,36> mapper {{ 0, 1,  2,  3,  4,  5,
+    1, 6,  7,  8,  9,  10,
+    2, 7,  11, 12, 13, 14,
+    3, 8,  12, 15, 16, 17,
+    4, 9,  13, 16, 18, 19,
+    5, 10, 14, 17, 19, 20 }};
+
+  // Former SymmTensor4_3D::TenQMult: QQ : input : QQ
+  SymmTensor4_3D ref_symm_TenQMult( const SymmTensor4_3D &input, const SymmTensor4_3D &QQ )
+  {
+    const auto ten = input.to_std_array();
+
+    std::array<double, 21> temp = {{0.0}}; 
+
+    const int map0 = 6*map[0];
+    const int map1 = 6*map[1];
+    const int map2 = 6*map[2];
+    const int map4 = 6*map[4];
+    const int map5 = 6*map[5];
+    const int map8 = 6*map[8];
+
+    for(int ii=0; ii<9; ++ii)
+    {
+      for(int jj=0; jj<9; ++jj)
+      {
+        const int index = 6*map[ii]+map[jj];
+
+        temp[0]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map0+map[jj]]);
+        temp[1]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
+        temp[2]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[3]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
+        temp[4]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
+        temp[5]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map1+map[jj]]);
+        temp[6]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
+        temp[7]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[8]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
+        temp[9]  += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
+        temp[10] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
+        temp[11] += QQ(mapper[map8+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[12] += QQ(mapper[map5+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[13] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[14] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
+        temp[15] += QQ(mapper[map5+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
+        temp[16] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
+        temp[17] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
+        temp[18] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
+        temp[19] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
+        temp[20] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map1+map[jj]]);
+     }
+    }
+    return SymmTensor4_3D( temp );
+  }
+
+  // Former SymmTensor4_3D::TenPMult: P : input : P^T with P = I - 1/3 invC (x) C
+  SymmTensor4_3D ref_symm_TenPMult( const SymmTensor4_3D &input, const SymmTensor2_3D &C )
+  {
+    const auto ten = input.to_std_array();
+
+    const auto invC  = STen2::inverse(C);
+
+    std::array<double, 21> temp = {{0.0}}; 
+
+    constexpr double pt33 = 1.0 / 3.0; 
+    constexpr double pt11 = 1.0 / 9.0; 
+
+    temp = ten;
+
+    for (int mm = 0; mm < 3; ++mm)
+    {
+      for (int nn = 0; nn < 3; ++nn)
+      {
+        const int index_1 = map[3*mm + nn];
+        // mapper index for IJMN
+        const int map0_Ind1 = 6*map[ 0 ] + index_1; 
+        const int map4_Ind1 = 6*map[ 4 ] + index_1;
+        const int map8_Ind1 = 6*map[ 8 ] + index_1;
+        const int map5_Ind1 = 6*map[ 5 ] + index_1;
+        const int map2_Ind1 = 6*map[ 2 ] + index_1;
+        const int map1_Ind1 = 6*map[ 1 ] + index_1;
+        // mapper index for MNKL
+        const int Ind1_map0 = 6*index_1 + map[ 0 ];
+        const int Ind1_map4 = 6*index_1 + map[ 4 ];
+        const int Ind1_map8 = 6*index_1 + map[ 8 ];
+        const int Ind1_map5 = 6*index_1 + map[ 5 ];
+        const int Ind1_map2 = 6*index_1 + map[ 2 ];
+        const int Ind1_map1 = 6*index_1 + map[ 1 ];
+
+        temp[0] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 0 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map0 ] ];
+
+        temp[1] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 4 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map4 ] ];
+
+        temp[2] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
+
+        temp[3] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
+
+        temp[4] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
+
+        temp[5] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        temp[6] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 4 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map4 ] ];
+
+        temp[7] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
+
+        temp[8] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
+
+        temp[9] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
+
+        temp[10] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        temp[11] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
+
+        temp[12] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
+
+        temp[13] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
+
+        temp[14] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        temp[15] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
+
+        temp[16] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
+
+        temp[17] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        temp[18] -= pt33 * ten[ mapper[ map2_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
+
+        temp[19] -= pt33 * ten[ mapper[ map2_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        temp[20] -= pt33 * ten[ mapper[ map1_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 1 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
+
+        for (int pp = 0; pp < 3; ++pp)
+        {
+          for (int qq = 0; qq < 3; ++qq)
+          {
+            const int index_2 = map[3*pp + qq];
+            // mapper index for MNPQ
+            const int Ind1_Ind2 = 6*index_1 + index_2; 
+
+            temp[0] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 0 ]);
+
+            temp[1] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 4 ]);
+
+            temp[2] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
+
+            temp[3] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
+
+            temp[4] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+
+            temp[5] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+
+            temp[6] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 4 ]);
+
+            temp[7] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
+
+            temp[8] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
+
+            temp[9] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+
+            temp[10] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+
+            temp[11] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
+
+            temp[12] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
+
+            temp[13] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+
+            temp[14] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+
+            temp[15] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
+
+            temp[16] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+
+            temp[17] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+
+            temp[18] += pt11 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+
+            temp[19] += pt11 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+
+            temp[20] += pt11 * invC(map[ 1 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+          }
+        }
+      }
+    }
+    return SymmTensor4_3D( temp );
+  }
+
+  // Former SymmTensor4_3D::pull_back_stiffness
+  SymmTensor4_3D ref_pull_back( const SymmTensor4_3D &input, const Tensor2_3D &invF )
+  {
+    auto ten4 = input.full();
+    ten4.MatMult_1( invF );
+    ten4.MatMult_2( invF );
+    ten4.MatMult_3( invF );
+    ten4.MatMult_4( invF );
+    return STen4::gen_symm_part( ten4 );
+  }
+
+  // Wall time in ns per call of kernel, repeated num times
+  template<typename T> double time_per_call( const int &num, T kernel )
+  {
+    const auto tstart = std::chrono::steady_clock::now();
+    for(int ii=0; ii<num; ++ii) kernel(ii);
+    const auto tend = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>( tend - tstart ).count() / num;
+  }
+
+  void report( const std::string &name, const double &err, const double &t_ref,
+      const double &t_new, const double &flops )
+  {
+    std::cout<<std::setw(24)<<std::left<<name<<std::right
+      <<"  err "<<std::scientific<<std::setprecision(2)<<err
+      <<"  ref "<<std::fixed<<std::setprecision(1)<<std::setw(9)<<t_ref<<" ns"
+      <<"  new "<<std::setw(9)<<t_new<<" ns"
+      <<"  speedup "<<std::setprecision(2)<<std::setw(6)<<t_ref / t_new
+      <<"  "<<std::setw(6)<<flops / t_new<<" GFLOP/s\n";
+  }
+
+  double max_diff( const SymmTensor4_3D &a, const SymmTensor4_3D &b )
+  {
+    double err = 0.0;
+    for(int ii=0; ii<21; ++ii) err = std::max( err, std::abs( a(ii) - b(ii) ) );
+    return err;
+  }
+
+  double max_diff( const Tensor4_3D &a, const Tensor4_3D &b )
+  {
+    double err = 0.0;
+    for(int ii=0; ii<81; ++ii) err = std::max( err, std::abs( a(ii) - b(ii) ) );
+    return err;
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  const int num = argc > 1 ? std::atoi( argv[1] ) : 100000;
+
+  // Inputs of the kernels, cycled through to avoid constant folding
+  constexpr int nset = 64;
+  std::vector<SymmTensor4_3D> AA( nset ), QQ( nset );
+  std::vector<Tensor2_3D> invF( nset );
+  std::vector<SymmTensor2_3D> CC( nset );
+  std::vector<Tensor4_3D> AA4( nset ), PP4( nset );
+  for(int ii=0; ii<nset; ++ii)
+  {
+    AA[ii] = STen4::gen_rand();
+    QQ[ii] = STen4::gen_rand();
+    Tensor2_3D F = Ten2::gen_rand( -0.2, 0.2 );
+    F += Ten2::gen_id();
+    invF[ii] = Ten2::inverse( F );
+    CC[ii] = STen2::gen_right_Cauchy_Green( F );
+    AA4[ii] = AA[ii].full();
+    PP4[ii] = Ten4::gen_P( CC[ii] );
+  }
+
+  double sink = 0.0;
+
+  std::cout<<"Rank-four tensor kernels, "<<num<<" calls each:\n";
+
+  // Pull-back of the elasticity tensor
+  {
+    double err = 0.0;
+    for(int ii=0; ii<nset; ++ii)
+    {
+      auto out = AA[ii];
+      out.pull_back_stiffness( invF[ii] );
+      err = std::max( err, max_diff( out, ref_pull_back( AA[ii], invF[ii] ) ) );
+    }
+
+    const double t_ref = time_per_call( num, [&]( const int &ii ) {
+        sink += ref_pull_back( AA[ii % nset], invF[ii % nset] )(ii % 21); } );
+
+    const double t_new = time_per_call( num, [&]( const int &ii ) {
+        auto out = AA[ii % nset];
+        out.pull_back_stiffness( invF[ii % nset] );
+        sink += out(ii % 21); } );
+
+    report( "pull_back_stiffness", err, t_ref, t_new, 792.0 );
+  }
+
+  // Projection P : AA : P^T with the right Cauchy-Green tensor
+  {
+    double err = 0.0;
+    for(int ii=0; ii<nset; ++ii)
+    {
+      auto out = AA[ii];
+      out.TenPMult( CC[ii] );
+      err = std::max( err, max_diff( out, ref_symm_TenPMult( AA[ii], CC[ii] ) ) );
+    }
+
+    const double t_ref = time_per_call( num, [&]( const int &ii ) {
+        sink += ref_symm_TenPMult( AA[ii % nset], CC[ii % nset] )(ii % 21); } );
+
+    const double t_new = time_per_call( num, [&]( const int &ii ) {
+        auto out = AA[ii % nset];
+        out.TenPMult( CC[ii % nset] );
+        sink += out(ii % 21); } );
+
+    report( "SymmTensor4_3D TenPMult", err, t_ref, t_new, 260.0 );
+  }
+
+  // QQ : AA : QQ
+  {
+    double err = 0.0;
+    for(int ii=0; ii<nset; ++ii)
+    {
+      auto out = AA[ii];
+      out.TenQMult( QQ[ii] );
+      err = std::max( err, max_diff( out, ref_symm_TenQMult( AA[ii], QQ[ii] ) ) );
+    }
+
+    const double t_ref = time_per_call( num, [&]( const int &ii ) {
+        sink += ref_symm_TenQMult( AA[ii % nset], QQ[ii % nset] )(ii % 21); } );
+
+    const double t_new = time_per_call( num, [&]( const int &ii ) {
+        auto out = AA[ii % nset];
+        out.TenQMult( QQ[ii % nset] );
+        sink += out(ii % 21); } );
+
+    report( "SymmTensor4_3D TenQMult", err, t_ref, t_new, 684.0 );
+  }
+
+  // Full rank-four projection
+  {
+    double err = 0.0;
+    for(int ii=0; ii<nset; ++ii)
+    {
+      auto out = AA4[ii];
+      out.TenPMult( PP4[ii] );
+      err = std::max( err, max_diff( out, ref_TenPMult( PP4[ii], AA4[ii] ) ) );
+    }
+
+    const double t_ref = time_per_call( num, [&]( const int &ii ) {
+        sink += ref_TenPMult( PP4[ii % nset], AA4[ii % nset] )(ii % 81); } );
+
+    const double t_new = time_per_call( num, [&]( const int &ii ) {
+        auto out = AA4[ii % nset];
+        out.TenPMult( PP4[ii % nset] );
+        sink += out(ii % 81); } );
+
+    report( "Tensor4_3D TenPMult", err, t_ref, t_new, 2916.0 );
+  }
+
+  // Contraction of the elasticity tensor with the strain variations
+  {
+    const double bb[6] { 0.3, -1.2, 0.7, 0.4, -0.5, 0.9 };
+
+    double err = 0.0;
+    for(int ii=0; ii<nset; ++ii)
+    {
+      double out[6];
+      AA[ii].VoigtVecMult( bb, out );
+      const double EE[6] { bb[0], bb[1], bb[2], 0.5 * bb[3], 0.5 * bb[4], 0.5 * bb[5] };
+      const auto ref = SymmTensor2_3D( EE[0], EE[1], EE[2], EE[3], EE[4], EE[5] ) * AA[ii];
+      for(int jj=0; jj<6; ++jj) err = std::max( err, std::abs( out[jj] - ref(jj) ) );
+    }
+
+    const double t_ref = time_per_call( num, [&]( const int &ii ) {
+        const SymmTensor2_3D EE( bb[0], bb[1], bb[2], 0.5 * bb[3], 0.5 * bb[4], 0.5 * bb[5] );
+        sink += ( EE * AA[ii % nset] )(ii % 6); } );
+
+    const double t_new = time_per_call( num, [&]( const int &ii ) {
+        double out[6];
+        AA[ii % nset].VoigtVecMult( bb, out );
+        sink += out[ii % 6]; } );
+
+    report( "VoigtVecMult", err, t_ref, t_new, 66.0 );
+  }
+
+  std::cout<<"checksum "<<sink<<'\n';
+
+  return EXIT_SUCCESS;
+}
+
+// EOF
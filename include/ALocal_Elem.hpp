@@ -42,6 +42,19 @@ class ALocal_Elem
     // ------------------------------------------------------------------------
     virtual int get_nlocalele( const int &tag_val ) const;
 
+    // ------------------------------------------------------------------------
+    // Return the local index of the ii-th element with tag value tag_val,
+    // 0 <= ii < get_nlocalele(tag_val). The elements of a tag are in
+    // ascending local index, which is a contiguous range if the partition
+    // sorts the elements by tag. This function can only be called when
+    // isTagged = true.
+    // ------------------------------------------------------------------------
+    virtual int get_elem_of_tag( const int &tag_val, const int &ii ) const
+    {
+      ASSERT(isTagged, "Error: get_elem_of_tag function 'isTagged' is false.\n");
+      return tag_elem[ tag_offset[tag_val] + ii ];
+    }
+
     // ------------------------------------------------------------------------
     // Given the global element index, return its location in the vector
     // elem_loc. If it does not belong to this sub-domain, it will return -1
@@ -88,6 +101,16 @@ class ALocal_Elem
     // ------------------------------------------------------------------------
     std::vector<int> elem_tag {};
 
+    // ------------------------------------------------------------------------
+    // The local element indices grouped by tag: the elements with tag value
+    // tt are tag_elem[ tag_offset[tt] ], ..., tag_elem[ tag_offset[tt+1]-1 ].
+    // tag_offset has length max tag + 2, and both are cleared if
+    // isTagged = false.
+    // ------------------------------------------------------------------------
+    std::vector<int> tag_elem {}, tag_offset {};
+
+    void Group_elem_by_tag();
+
     // Disallow default constructor
     ALocal_Elem() = delete;
 };
@@ -8,9 +8,11 @@
 // similar with ALocal_EBC, but it uses the volume elements' info.
 //
 // The volume elements attached to an interface would be from the fixed volume
-// and the rotated volume. We distribute the fixed volume elements to each
-// partition, but store the rotated volume elements' information to every
-// partition h5 file which involves the interface. 
+// and the rotated volume. Both are distributed with the volume partition.
+// Each partition h5 file stores the local elements of the two sides, and
+// the elements of the other side with the same or the neighbouring interval
+// tags as a halo for the search of the opposite points. The elements and
+// the nodes are numbered within this set.
 
 // When calculate the integral on the interface, we go through the fixed elements,
 // use the quadrature points of the fixed face, and search for the opposite points
@@ -139,16 +141,17 @@ class ALocal_Interface
     // stores the local fixed element indices in this part
     std::vector<std::vector<int>> local_fixed_ele;
 
-    // stores the face id of fixed volume element
-    // size: num_itf x num_all_fixed_ele[ii]
+    // stores the face id of fixed volume element, num_part_fixed_ele[ii] is
+    // the number of the local and halo fixed elements in this part
+    // size: num_itf x num_part_fixed_ele[ii]
     std::vector<std::vector<int>> fixed_ele_face_id;
 
     // stores the volume element's IEN array of the fixed "layer"
-    // size: num_itf x (nlocbas x num_all_fixed_ele[ii])
+    // size: num_itf x (nlocbas x num_part_fixed_ele[ii])
     std::vector<std::vector<int>> fixed_lien;
 
     // stores the interval tag of fixed volume element
-    // size: num_itf x num_all_fixed_ele[ii]
+    // size: num_itf x num_part_fixed_ele[ii]
     std::vector<std::vector<int>> fixed_ele_tag;
 
     std::vector<std::vector<std::vector<int>>> tagged_fixed_ele;
@@ -171,16 +174,16 @@ class ALocal_Interface
     // stores the local rotated element indices in this part
     std::vector<std::vector<int>> local_rotated_ele;
 
-    // stores the face id of all the rotated volume element
-    // size: num_itf x num_all_rotated_ele[ii]
+    // stores the face id of the local and halo rotated volume element
+    // size: num_itf x num_part_rotated_ele[ii]
     std::vector<std::vector<int>> rotated_ele_face_id;
 
     // stores the volume element's IEN array of the rotated "layer"
-    // size: num_itf x (nlocbas x num_all_rotated_ele[ii])
+    // size: num_itf x (nlocbas x num_part_rotated_ele[ii])
     std::vector<std::vector<int>> rotated_lien;
 
     // stores the interval tag of rotated volume element
-    // size: num_itf x num_all_rotated_ele[ii]
+    // size: num_itf x num_part_rotated_ele[ii]
     std::vector<std::vector<int>> rotated_ele_tag;
 
     std::vector<std::vector<std::vector<int>>> tagged_rotated_ele;
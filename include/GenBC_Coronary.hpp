@@ -78,6 +78,12 @@ class GenBC_Coronary : public IGenBC
     // Write 0D solutions into a file for restart
     virtual void write_0D_sol( const int &curr_index, const double &curr_time ) const;
 
+    // The state is Q0, Pi0, and prev_0D_sol of face ii, of length
+    // 1 + 2 num_odes. The dPim/dt values are kept from reset_initial_sol.
+    virtual std::vector<double> get_state( const int &ii ) const;
+
+    virtual void set_state( const int &ii, const std::vector<double> &state );
+
   private:
     const int num_odes; // Number of ODEs in the model
 
@@ -88,8 +94,8 @@ class GenBC_Coronary : public IGenBC
     // file to store 0D solutions at each 3D time step
     const std::string lpn_sol_file;
 
-    // Parameters used to define difference quotient for get_m.
-    const double absTol, relTol;
+    // Tolerance used to locate the end time in the Pim waveform period.
+    const double absTol;
 
     // Total number of outlet surfaces
     int num_ebc;
@@ -130,6 +136,14 @@ class GenBC_Coronary : public IGenBC
     // The size of Pi0 is 2 x num_ebc
     std::vector< std::vector<double> > Pi0;
 
+    // Results of the last ODE integration on each face, keyed on the
+    // end-of-step flow rate Q. The integration does not depend on dot_Q,
+    // and an entry is invalidated once the initial values are reset.
+    // cache_sol has size num_ebc x num_odes and holds the end state.
+    mutable std::vector<bool> cache_valid;
+    mutable std::vector<double> cache_Q, cache_P, cache_m;
+    mutable std::vector< std::vector<double> > cache_sol;
+
     // PRIVATE FUNCTIONS:
     // Evaluate the coronary LPM (2 first order ODEs) for the ii-th outlet 
     // face (which is a coronary outlet) and output the ODE derivatives to K.
@@ -139,6 +153,18 @@ class GenBC_Coronary : public IGenBC
     // Evaluate the RCR ODE for the ii-th outlet face and return the result.
     double F_RCR( const int &ii, const double &pi, const double &q ) const;
 
+    // Linearizations of F_coronary and F_RCR w.r.t. (pi, q), applied to
+    // the sensitivities dpi = d pi/dQ and dq = d q/dQ.
+    void dF_coronary( const int &ii, const std::vector<double> &dpi, const double &dq,
+        std::vector<double> &dK ) const;
+
+    double dF_RCR( const int &ii, const double &dpi, const double &dq ) const;
+
+    // Integrate the ODEs on face ii with the end-of-step flow rate in_Q,
+    // together with the derivatives of the discrete solution w.r.t. in_Q,
+    // and store P, m = dP/dQ, and the end state in the cache.
+    void integrate( const int &ii, const double &in_Q ) const;
+
     // Pre-compute dPim/dt at the begining of the ODE integration for the 
     // ii-th outlet face, 0 <= ii < num_ebc
     void get_dPim_dt( const int &ii, const double &time_start, const double &time_end );
@@ -46,6 +46,17 @@ class GenBC_Pressure : public IGenBC
       P0[ii] = get_P(ii, 0.0, 0.0, curr_time);
     }
 
+    virtual std::vector<double> get_state( const int &ii ) const
+    {
+      return { P0[ii] };
+    }
+
+    virtual void set_state( const int &ii, const std::vector<double> &state )
+    {
+      SYS_T::print_fatal_if( state.size() != 1, "Error: GenBC state has wrong size.\n" );
+      P0[ii] = state[0];
+    }
+
   private:
     int num_ebc;
 
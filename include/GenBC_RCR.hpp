@@ -50,14 +50,24 @@ class GenBC_RCR : public IGenBC
       reset_initial_sol( ii, in_Q_0, in_P_0 );
     }
 
+    virtual std::vector<double> get_state( const int &ii ) const
+    {
+      return { Q0[ii], Pi0[ii] };
+    }
+
+    virtual void set_state( const int &ii, const std::vector<double> &state )
+    {
+      SYS_T::print_fatal_if( state.size() != 2, "Error: GenBC_RCR state has wrong size.\n" );
+      Q0[ii]  = state[0];
+      Pi0[ii] = state[1];
+      cache_valid[ii] = false;
+    }
+
   private:
     const int N;
     
     const double h; // delta t = Nh
 
-    // Parameters used to define difference quotient for get_m.
-    const double absTol, relTol;
-
     int num_ebc;
 
     // Vectors storing the Rp, C, and Rd values on each outlet faces
@@ -67,10 +77,23 @@ class GenBC_RCR : public IGenBC
     // Vectors storing the Q0 and Pi0 on each outlet faces
     std::vector<double> Q0, Pi0;
 
+    // Results of the last ODE integration on each face, keyed on the
+    // end-of-step flow rate Q. The integration does not depend on dot_Q,
+    // and an entry is invalidated once the initial values are reset.
+    mutable std::vector<bool> cache_valid;
+    mutable std::vector<double> cache_Q, cache_P, cache_m;
+
+    // F is linear in (pi, q) without offset, so it also maps the
+    // sensitivities (dpi/dQ, dq/dQ) to dK/dQ in integrate.
     double F(const int &ii, const double &pi, const double &q) const
     {
       return -1.0 * pi / (Rd[ii] * C[ii]) + q / C[ii]; 
     }
+
+    // Integrate the ODE on face ii with the end-of-step flow rate in_Q,
+    // together with the derivative of the discrete solution w.r.t. in_Q,
+    // and store P and m = dP/dQ in the cache.
+    void integrate( const int &ii, const double &in_Q ) const;
     
     virtual void reset_initial_sol( const int &ii, const double &in_Q_0,
         const double &in_P_0 );
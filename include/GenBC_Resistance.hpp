@@ -59,6 +59,18 @@ class GenBC_Resistance : public IGenBC
       P0[ii] = in_P_0;
     }
 
+    virtual std::vector<double> get_state( const int &ii ) const
+    {
+      return { Q0[ii], P0[ii] };
+    }
+
+    virtual void set_state( const int &ii, const std::vector<double> &state )
+    {
+      SYS_T::print_fatal_if( state.size() != 2, "Error: GenBC state has wrong size.\n" );
+      Q0[ii] = state[0];
+      P0[ii] = state[1];
+    }
+
   private:
     int num_ebc; // number of elemental boundary faces
     
@@ -40,6 +40,142 @@ namespace HDF5_T
 
     return output;
   }
+
+  // --------------------------------------------------------------------------
+  // ! read_intVector_slice: read the entries [start, start + num) of the int
+  //   vector dataname in the root group of filename as a hyperslab. length
+  //   returns the full length of the vector.
+  // --------------------------------------------------------------------------
+  inline std::vector<int> read_intVector_slice( const std::string &filename,
+      const std::string &dataname, const int &start, const int &num,
+      int &length )
+  {
+    hid_t file_id = H5Fopen( filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+    SYS_T::print_fatal_if( file_id < 0, "Error: HDF5_T::read_intVector_slice cannot open %s.\n", filename.c_str() );
+
+    hid_t dset = H5Dopen( file_id, dataname.c_str(), H5P_DEFAULT );
+    hid_t fspace = H5Dget_space( dset );
+
+    hsize_t dims[1];
+    H5Sget_simple_extent_dims( fspace, dims, NULL );
+    length = static_cast<int>( dims[0] );
+
+    SYS_T::print_fatal_if( start < 0 || num < 0 || start + num > length,
+        "Error: HDF5_T::read_intVector_slice [%d, %d) is out of the range of %s/%s.\n",
+        start, start + num, filename.c_str(), dataname.c_str() );
+
+    hsize_t offset[1] = { static_cast<hsize_t>(start) };
+    hsize_t count[1]  = { static_cast<hsize_t>(num) };
+
+    std::vector<int> output( num, 0 );
+
+    hid_t mspace = H5Screate_simple( 1, count, NULL );
+    H5Sselect_hyperslab( fspace, H5S_SELECT_SET, offset, NULL, count, NULL );
+    if( num == 0 ) { H5Sselect_none( fspace ); H5Sselect_none( mspace ); }
+
+    const herr_t status = H5Dread( dset, H5T_NATIVE_INT, mspace, fspace,
+        H5P_DEFAULT, output.data() );
+    SYS_T::print_fatal_if( status < 0, "Error: HDF5_T::read_intVector_slice failed to read %s/%s.\n", filename.c_str(), dataname.c_str() );
+
+    H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+    H5Fclose( file_id );
+
+    return output;
+  }
+
+  // --------------------------------------------------------------------------
+  // ! read_field_rows: read the rows [row_start, row_start + num_row) of the
+  //   field datasets in groupname, written by PDNSolution_HDF5, and
+  //   interleave them node by node in the creation order of the fields. The
+  //   output has length num_row x dof, and dof is the sum of the field
+  //   columns. Filtered datasets are decoded by the library.
+  // --------------------------------------------------------------------------
+  inline std::vector<double> read_field_rows( const std::string &filename,
+      const std::string &groupname, const int &row_start, const int &num_row,
+      int &dof )
+  {
+    hid_t file_id = H5Fopen( filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+    SYS_T::print_fatal_if( file_id < 0, "Error: HDF5_T::read_field_rows cannot open %s.\n", filename.c_str() );
+
+    hid_t group_id = H5Gopen( file_id, groupname.c_str(), H5P_DEFAULT );
+
+    H5G_info_t group_info;
+    H5Gget_info( group_id, &group_info );
+
+    const int num_field = static_cast<int>( group_info.nlinks );
+
+    std::vector<std::string> field_name( num_field );
+    std::vector<int> field_dof( num_field, 0 );
+    dof = 0;
+    for(int ff=0; ff<num_field; ++ff)
+    {
+      const ssize_t len = H5Lget_name_by_idx( group_id, ".", H5_INDEX_CRT_ORDER,
+          H5_ITER_INC, ff, NULL, 0, H5P_DEFAULT );
+
+      SYS_T::print_fatal_if( len < 0, "Error: HDF5_T::read_field_rows %s/%s has no field creation order.\n", filename.c_str(), groupname.c_str() );
+
+      std::vector<char> name( len + 1, '\0' );
+      H5Lget_name_by_idx( group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, ff,
+          &name[0], len + 1, H5P_DEFAULT );
+      field_name[ff] = std::string( &name[0] );
+
+      hid_t dset = H5Dopen( group_id, field_name[ff].c_str(), H5P_DEFAULT );
+      hid_t fspace = H5Dget_space( dset );
+      hsize_t dims[2];
+      H5Sget_simple_extent_dims( fspace, dims, NULL );
+      H5Sclose( fspace ); H5Dclose( dset );
+
+      field_dof[ff] = static_cast<int>( dims[1] );
+      dof += field_dof[ff];
+    }
+
+    std::vector<double> output( num_row * dof, 0.0 ), buffer;
+
+    int offset = 0;
+    for(int ff=0; ff<num_field && num_row > 0; ++ff)
+    {
+      const int fdof = field_dof[ff];
+
+      hsize_t start[2] = { static_cast<hsize_t>(row_start), 0 };
+      hsize_t count[2] = { static_cast<hsize_t>(num_row), static_cast<hsize_t>(fdof) };
+
+      buffer.resize( num_row * fdof );
+
+      hid_t dset = H5Dopen( group_id, field_name[ff].c_str(), H5P_DEFAULT );
+      hid_t fspace = H5Dget_space( dset );
+      hid_t mspace = H5Screate_simple( 2, count, NULL );
+      H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, NULL, count, NULL );
+
+      const herr_t status = H5Dread( dset, H5T_NATIVE_DOUBLE, mspace, fspace,
+          H5P_DEFAULT, buffer.data() );
+      SYS_T::print_fatal_if( status < 0, "Error: HDF5_T::read_field_rows failed to read %s/%s.\n", groupname.c_str(), field_name[ff].c_str() );
+
+      H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+
+      for(int nn=0; nn<num_row; ++nn)
+        for(int cc=0; cc<fdof; ++cc)
+          output[nn*dof + offset + cc] = buffer[nn*fdof + cc];
+
+      offset += fdof;
+    }
+
+    H5Gclose( group_id ); H5Fclose( file_id );
+
+    return output;
+  }
+
+  // --------------------------------------------------------------------------
+  // ! is_field_file: solution files named *.h5 are read by read_field_rows
+  //   from the group sol, others are PETSc binary files.
+  // --------------------------------------------------------------------------
+  inline bool is_field_file( const std::string &filename )
+  {
+    const std::string suffix = ".h5";
+    return filename.size() > suffix.size() &&
+      filename.compare( filename.size() - suffix.size(), suffix.size(), suffix ) == 0;
+  }
 }
 
 #endif
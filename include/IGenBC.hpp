@@ -33,8 +33,8 @@ class IGenBC
 
     // --------------------------------------------------------------
     // Get the dP/dQ for surface ii
-    // for implicit BC's, this value is defined via a difference quotient
-    // that is, (get_P(Q+epsilon) - get_P(Q)) / epsilon 
+    // for implicit BC's, this value is the derivative of the discrete
+    // ODE integrator with respect to the end-of-step flow rate Q
     // for simple models, e.g. resistance type bc, this value is just
     // the resistance value on this bc.
     // --------------------------------------------------------------
@@ -69,6 +69,28 @@ class IGenBC
     // --------------------------------------------------------------
     virtual double get_P0( const int &ii ) const = 0;
 
+    // --------------------------------------------------------------
+    // Evaluate P, m := dP/dQ, and n := dP/d(dot_Q) on all faces in one
+    // call. dot_Q and Q have length num_ebc; P, m, and n are resized to
+    // num_ebc. Models integrating an ODE should override this to obtain
+    // P and its derivatives from a single integration per face; the
+    // default falls back to the per-face get_P, get_m, and get_n.
+    // --------------------------------------------------------------
+    virtual void get_P_m_n( const std::vector<double> &dot_Q,
+        const std::vector<double> &Q, const double &time,
+        std::vector<double> &P, std::vector<double> &m,
+        std::vector<double> &n ) const
+    {
+      const int nebc = get_num_ebc();
+      P.resize( nebc ); m.resize( nebc ); n.resize( nebc );
+      for(int ii=0; ii<nebc; ++ii)
+      {
+        P[ii] = get_P( ii, dot_Q[ii], Q[ii], time );
+        m[ii] = get_m( ii, dot_Q[ii], Q[ii] );
+        n[ii] = get_n( ii, dot_Q[ii], Q[ii] );
+      }
+    }
+
     // --------------------------------------------------------------
     // Record solution values as initial conditions for the next time step
     // para ii : the outlet face id, ranging from 0 to num_ebc - 1
@@ -93,6 +115,23 @@ class IGenBC
     // --------------------------------------------------------------
     virtual void write_0D_sol( const int &curr_index, const double &curr_time ) const
     {}
+
+    // --------------------------------------------------------------
+    // Get and set the internal state of face ii, i.e., the initial
+    // values of the next ODE integration, for checkpointing. The state
+    // is restored after reset_initial_sol in a restart, so that the
+    // next step continues exactly. Models without a state return an
+    // empty vector.
+    // --------------------------------------------------------------
+    virtual std::vector<double> get_state( const int &ii ) const
+    {
+      return {};
+    }
+
+    virtual void set_state( const int &ii, const std::vector<double> &state )
+    {
+      SYS_T::print_fatal_if( !state.empty(), "Error: IGenBC::set_state is not implemented.\n" );
+    }
 };
 
 #endif
@@ -23,6 +23,25 @@ class IMaterialModel_ich
     virtual SymmTensor4_3D get_PK_Stiffness( const Tensor2_3D &F,
        Tensor2_3D &P_ich, SymmTensor2_3D &S_ich ) const = 0;
 
+    // Fused evaluation of the stresses and the elasticity tensor into the
+    // caller's storage. A model overrides it to share the invariants, the
+    // exponentials, and the deviatoric parts among the three outputs.
+    virtual void eval_PK_Stiffness( const Tensor2_3D &F, Tensor2_3D &P_ich,
+       SymmTensor2_3D &S_ich, SymmTensor4_3D &CC_ich ) const
+    {
+      CC_ich = get_PK_Stiffness(F, P_ich, S_ich);
+    }
+
+    // eval_PK_Stiffness at num deformation gradients, e.g., all quadrature
+    // points of an element, with the outputs of length num
+    virtual void eval_PK_Stiffness_batch( const int &num,
+       const Tensor2_3D * const &F, Tensor2_3D * const &P_ich,
+       SymmTensor2_3D * const &S_ich, SymmTensor4_3D * const &CC_ich ) const
+    {
+      for(int ii=0; ii<num; ++ii)
+        eval_PK_Stiffness( F[ii], P_ich[ii], S_ich[ii], CC_ich[ii] );
+    }
+
     // P_ich := F S_ich
     virtual Tensor2_3D get_PK_1st( const Tensor2_3D &F ) const
     {
@@ -166,6 +166,15 @@ class IPGAssem
         const double &dt )
     {SYS_T::commPrint("Warning: Assem_residual() is not implemented. \n");}
 
+    // PGAssem_Mesh : the residual is linear in sol_b, and it is evaluated by
+    // a cached operator as G = K_b sol_b + G(sol_a, 0).
+    virtual void Assem_residual_linear(
+        const PDNSolution * const &sol_a,
+        const PDNSolution * const &sol_b,
+        const double &curr_time,
+        const double &dt )
+    {SYS_T::commPrint("Warning: Assem_residual_linear() is not implemented. \n");}
+
     virtual void Assem_residual(
         const PDNSolution * const &sol_a,
         const PDNSolution * const &sol_b,
@@ -325,11 +334,40 @@ class IPGAssem
       return 0.0;
     }
 
-    // Update wall prestress at all surface quadrature points
-    virtual void Update_Wall_Prestress(
+    // Assem_surface_outlet_data
+    // Performs the surface integrals of the flow rate of dot_sol, the
+    // flow rate of sol, and the averaged pressure of sol on all outlet
+    // faces in one pass. The values of all faces are collected from
+    // multiple CPUs by a single MPI_Allreduce. On return, the vectors
+    // have length num_ebc.
+    virtual void Assem_surface_outlet_data(
+        const PDNSolution * const &dot_sol,
+        const PDNSolution * const &sol,
+        std::vector<double> &dot_flrate,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const
+    {SYS_T::print_fatal("Error: Assem_surface_outlet_data is not implemented.\n");}
+
+    // Assem_surface_inlet_data
+    // Performs the surface integrals of the flow rate and the averaged
+    // pressure of sol on all inlet faces with a single MPI_Allreduce.
+    // On return, the vectors have length get_num_nbc() of infbc_part.
+    virtual void Assem_surface_inlet_data(
+        const PDNSolution * const &sol,
+        const ALocal_InflowBC * const &infbc_part,
+        std::vector<double> &flrate,
+        std::vector<double> &ave_pres ) const
+    {SYS_T::print_fatal("Error: Assem_surface_inlet_data is not implemented.\n");}
+
+    // Update wall prestress at all surface quadrature points, and return the
+    // relative l_inf norm of the prestress increment
+    virtual double Update_Wall_Prestress(
         const PDNSolution * const &disp,
         const PDNSolution * const &pres ) const
-    {SYS_T::commPrint("Warning: Update_Wall_Prestress() is not implemented.\n");}
+    {
+      SYS_T::commPrint("Warning: Update_Wall_Prestress() is not implemented.\n");
+      return 0.0;
+    }
 
     virtual void write_prestress_hdf5() const
     {SYS_T::commPrint("Warning: write_prestress_hdf5() is not implemented.\n");}
@@ -83,6 +83,13 @@ class IPLocAssem
 
     virtual int get_snLocBas() const = 0;
 
+    // ------------------------------------------------------------------------
+    // Return the number of volume quadrature points
+    // ------------------------------------------------------------------------
+    virtual int get_nqpv() const
+    {SYS_T::commPrint("Warning: IPLocAssem::get_nqpv is not implemented. \n");
+      return 0;}
+
     // ------------------------------------------------------------------------
     // ! Get the number of ebc functions implemented inside this 
     //   local assembly routine
@@ -149,6 +156,35 @@ class IPLocAssem
         const double * const &eleCtrlPts_z )
     {SYS_T::commPrint("Warning: this Assem_Tangent_Residual(...) is not implemented. \n");}
 
+    // ------------------------------------------------------------------------
+    // ! Assembly for an element moving rigidly from its reference position.
+    //   ref_elementv holds the basis built with the reference coordinates
+    //   eleCtrlPts, which is reused in place of the buildBasis call.
+    // ------------------------------------------------------------------------
+    virtual void Assem_Residual_Rigid(
+        const double &time, const double &dt,
+        const double * const &vec_a,
+        const double * const &vec_b,
+        const double * const &mvelo,
+        const double * const &mdisp,
+        const FEAElement * const &ref_elementv,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z )
+    {SYS_T::commPrint("Warning: this Assem_Residual_Rigid(...) is not implemented. \n");}
+
+    virtual void Assem_Tangent_Residual_Rigid(
+        const double &time, const double &dt,
+        const double * const &vec_a,
+        const double * const &vec_b,
+        const double * const &mvelo,
+        const double * const &mdisp,
+        const FEAElement * const &ref_elementv,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z )
+    {SYS_T::commPrint("Warning: this Assem_Tangent_Residual_Rigid(...) is not implemented. \n");}
+
     virtual void Assem_Tangent_Residual(
         const double &time, const double &dt,
         const double * const &vec_a,
@@ -62,6 +62,19 @@ class IVisDataPrep
       SYS_T::print_fatal("Warning: get_pointArray is not implemented.\n");
     }
 
+    // -------------------------------------------------------------------
+    // ! input gives the solution file and a PostVectScatter, which keeps
+    //   the node reordering of the postprocessing partition across
+    //   calls, so that the mapping files are not read for every file.
+    // -------------------------------------------------------------------
+    virtual void get_pointArray(
+        const std::string &solution_file_name,
+        const PostVectScatter * const &scatter,
+        double ** &pointArrays ) const
+    {
+      SYS_T::print_fatal("Warning: get_pointArray is not implemented.\n");
+    }
+
     // -------------------------------------------------------------------
     // ! input gives a list of solution file names to read.
     //   This is used for problems where we store the solutions separately.
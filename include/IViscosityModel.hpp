@@ -9,6 +9,7 @@
 // Authors: Xinhai Yue, Yujie Sun
 // Date: Feb. 10 2025
 // ============================================================================
+#include "Sys_Tools.hpp"
 #include "SymmTensor2_3D.hpp"
 
 class IViscosityModel
@@ -33,6 +34,21 @@ class IViscosityModel
     virtual double get_dmu_dI2( const SymmTensor2_3D &strain_rate ) const = 0;
 
     virtual double get_dmu_dI3( const SymmTensor2_3D &strain_rate ) const = 0;
+
+    // ------------------------------------------------------------------------
+    // ! Evaluate mu and dmu_dI2 at num points, e.g. all quadrature points of
+    //   an element, in one call. The arrays have length num.
+    // ------------------------------------------------------------------------
+    virtual void eval_mu_batch( const int &num,
+        const SymmTensor2_3D * const &strain_rate,
+        double * const &mu, double * const &dmu_dI2 ) const
+    {
+      for(int ii=0; ii<num; ++ii)
+      {
+        mu[ii]      = get_mu( strain_rate[ii] );
+        dmu_dI2[ii] = get_dmu_dI2( strain_rate[ii] );
+      }
+    }
 };
 
 #endif
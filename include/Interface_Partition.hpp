@@ -4,6 +4,15 @@
 // Interface_Partition.hpp
 // 
 // The partition for several interface-pairs.
+//
+// Each partition keeps its local fixed and rotated elements, and a halo of
+// the elements on the other side with the same or the neighbouring interval
+// tags, in which the opposite points of the local elements are searched.
+// The tags are set by the initial position along the axis or the radius,
+// which the rotation does not change, so the halo holds the opposite
+// elements for any rotor position. The kept elements and their nodes are
+// renumbered, and a partition stores the interval bands touched by its own
+// elements instead of the whole interface.
 // 
 // Author: Xuanming Huag
 // Date: Jun 24 2024
@@ -38,6 +47,14 @@ class Interface_Partition
     virtual std::vector<std::vector<int>> get_rotated_node_loc_pos() const
     {return rotated_node_loc_pos;}
 
+    // the kept nodes of each interface-pair as indices of the nodes of the
+    // whole interface, i.e., of the vectors above
+    virtual std::vector<std::vector<int>> get_fixed_itf_node() const
+    {return fixed_itf_node;}
+
+    virtual std::vector<std::vector<int>> get_rotated_itf_node() const
+    {return rotated_itf_node;}
+
     virtual int get_fixed_nlocalele(const int &ii) const
     {return fixed_nlocalele[ii];}
 
@@ -74,11 +91,15 @@ class Interface_Partition
     // stores the fixed layer nodes' coordinates
     std::vector<std::vector<double>> fixed_pt_xyz;
 
-    // stores the fixed layer nodes' volume partition tag & local position
+    // stores the fixed layer nodes' volume partition tag & local position,
+    // for all the nodes of the interface
     std::vector<std::vector<int>> fixed_node_vol_part_tag;
 
     std::vector<std::vector<int>> fixed_node_loc_pos;
 
+    // stores the kept fixed layer nodes' indices in the whole interface
+    std::vector<std::vector<int>> fixed_itf_node;
+
     // stores the interval tag of each element of the fixed interface
     std::vector<std::vector<int>> fixed_interval_tag;
 
@@ -108,11 +129,15 @@ class Interface_Partition
     // stores the rotated layer nodes' coordinates
     std::vector<std::vector<double>> rotated_pt_xyz;
 
-    // stores the rotated layer nodes' volume partition tag & local position
+    // stores the rotated layer nodes' volume partition tag & local position,
+    // for all the nodes of the interface
     std::vector<std::vector<int>> rotated_node_vol_part_tag;
 
     std::vector<std::vector<int>> rotated_node_loc_pos;
 
+    // stores the kept rotated layer nodes' indices in the whole interface
+    std::vector<std::vector<int>> rotated_itf_node;
+
     // stores the interval tag of each element of the rotated interface
     std::vector<std::vector<int>> rotated_interval_tag;
 
@@ -120,6 +145,17 @@ class Interface_Partition
     std::vector<std::vector<std::vector<int>>> tagged_rotated_ele;
 
     std::vector<std::vector<int>> num_tagged_rotated_ele;
+
+    // Keep the elements in keep and the nodes of them in the element and
+    // node arrays of one side, with the elements and the nodes renumbered
+    // in the order of keep and of the node indices. itf_node returns the
+    // kept nodes, and the function returns the new index of each element,
+    // -1 for the dropped ones.
+    std::vector<int> Compact( const std::vector<int> &keep,
+        std::vector<int> &face_id, std::vector<int> &lien,
+        std::vector<int> &interval_tag, std::vector<int> &global_node,
+        std::vector<int> &LID, std::vector<double> &pt_xyz,
+        std::vector<int> &itf_node ) const;
 };
 
 #endif
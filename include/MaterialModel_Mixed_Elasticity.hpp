@@ -33,6 +33,15 @@ class MaterialModel_Mixed_Elasticity
         SymmTensor2_3D &S_ich ) const
     {return imodel->get_PK_Stiffness(F, P_ich, S_ich);}
 
+    void eval_PK_Stiffness( const Tensor2_3D &F, Tensor2_3D &P_ich,
+        SymmTensor2_3D &S_ich, SymmTensor4_3D &CC_ich ) const
+    {imodel->eval_PK_Stiffness(F, P_ich, S_ich, CC_ich);}
+
+    void eval_PK_Stiffness_batch( const int &num, const Tensor2_3D * const &F,
+        Tensor2_3D * const &P_ich, SymmTensor2_3D * const &S_ich,
+        SymmTensor4_3D * const &CC_ich ) const
+    {imodel->eval_PK_Stiffness_batch(num, F, P_ich, S_ich, CC_ich);}
+
     // P_iso := F S_iso
     Tensor2_3D get_PK_1st( const Tensor2_3D &F ) const
     {return imodel->get_PK_1st(F);}
@@ -80,6 +80,14 @@ class MaterialModel_ich_GOH06 : public IMaterialModel_ich
 
     virtual SymmTensor4_3D get_PK_Stiffness( const Tensor2_3D &F,
         Tensor2_3D &P_ich, SymmTensor2_3D &S_ich ) const
+    {
+      SymmTensor4_3D PKstiff;
+      eval_PK_Stiffness( F, P_ich, S_ich, PKstiff );
+      return PKstiff;
+    }
+
+    virtual void eval_PK_Stiffness( const Tensor2_3D &F, Tensor2_3D &P_ich,
+        SymmTensor2_3D &S_ich, SymmTensor4_3D &PKstiff ) const
     {
       constexpr double pt67 = 2.0 / 3.0;
       const auto CC = STen2::gen_right_Cauchy_Green(F);
@@ -87,45 +95,45 @@ class MaterialModel_ich_GOH06 : public IMaterialModel_ich
       const auto invCC = STen2::inverse(CC);
       const double detFm0d67 = std::pow(F.det(), -pt67);
 
-      const auto S_iso = mu * detFm0d67 * STen2::gen_DEV_part(STen2::gen_id(), CC );
-
       const double I4 = CC.VecMatVec(a1, a1);
       const double I6 = CC.VecMatVec(a2, a2);
 
       const double fE1 = detFm0d67 * (fkd*I1 + (1.0 -3.0*fkd)*I4) - 1.0;
       const double fE2 = detFm0d67 * (fkd*I1 + (1.0 -3.0*fkd)*I6) - 1.0;
 
-      const double dfpsi1_dfE1 = fk1 * fE1 * std::exp( fk2 * fE1 * fE1);
-      const double dfpsi2_dfE2 = fk1 * fE2 * std::exp( fk2 * fE2 * fE2);
+      // The exponentials are shared by the 1st and 2nd derivatives
+      const double exp1 = std::exp( fk2 * fE1 * fE1 );
+      const double exp2 = std::exp( fk2 * fE2 * fE2 );
+
+      const double dfpsi1_dfE1 = fk1 * fE1 * exp1;
+      const double dfpsi2_dfE2 = fk1 * fE2 * exp2;
+
+      const double d2fpsi1_dfE1 = fk1 * (1.0 + 2.0*fk2*fE1*fE1) * exp1;
+      const double d2fpsi2_dfE2 = fk1 * (1.0 + 2.0*fk2*fE2*fE2) * exp2;
 
       const auto H_f1 = fkd * STen2::gen_id() + (1 - 3*fkd) * STen2::gen_dyad(a1);
       const auto H_f2 = fkd * STen2::gen_id() + (1 - 3*fkd) * STen2::gen_dyad(a2);
 
-      const auto S_fi1 = 2.0 * detFm0d67 * dfpsi1_dfE1 * STen2::gen_DEV_part(H_f1, CC );
-      const auto S_fi2 = 2.0 * detFm0d67 * dfpsi2_dfE2 * STen2::gen_DEV_part(H_f2, CC );
+      const auto DEV_f1 = STen2::gen_DEV_part(H_f1, CC );
+      const auto DEV_f2 = STen2::gen_DEV_part(H_f2, CC );
 
-      S_ich = S_iso + S_fi1 + S_fi2;
+      S_ich = mu * detFm0d67 * STen2::gen_DEV_part(STen2::gen_id(), CC )
+        + 2.0 * detFm0d67 * dfpsi1_dfE1 * DEV_f1
+        + 2.0 * detFm0d67 * dfpsi2_dfE2 * DEV_f2;
 
       P_ich = F * S_ich;
 
-      auto PKstiff = pt67 * detFm0d67 * mu * I1 * STen4::gen_Ptilde( invCC );
-
-      const double d2fpsi1_dfE1 = fk1 * (1.0 + 2.0*fk2*fE1*fE1) * std::exp(fk2*fE1*fE1);
-      const double d2fpsi2_dfE2 = fk1 * (1.0 + 2.0*fk2*fE2*fE2) * std::exp(fk2*fE2*fE2);
-
       const double val1 = 2.0 * pt67 * detFm0d67 * dfpsi1_dfE1 * (fkd * I1 + (1.0-3.0*fkd)*I4);
       const double val2 = 2.0 * pt67 * detFm0d67 * dfpsi2_dfE2 * (fkd * I1 + (1.0-3.0*fkd)*I6);
 
-      PKstiff += (val1 + val2) * STen4::gen_Ptilde( invCC );
+      PKstiff = (pt67 * detFm0d67 * mu * I1 + val1 + val2) * STen4::gen_Ptilde( invCC );
 
       const double val = 4.0 * detFm0d67 * detFm0d67;
 
-      PKstiff.add_OutProduct(val * d2fpsi1_dfE1, STen2::gen_DEV_part(H_f1, CC));
-      PKstiff.add_OutProduct(val * d2fpsi2_dfE2, STen2::gen_DEV_part(H_f2, CC));
+      PKstiff.add_OutProduct(val * d2fpsi1_dfE1, DEV_f1);
+      PKstiff.add_OutProduct(val * d2fpsi2_dfE2, DEV_f2);
 
       PKstiff.add_SymmOutProduct(-pt67, invCC, S_ich);
-
-      return PKstiff;
     }
 
     virtual double get_energy( const Tensor2_3D &F ) const
@@ -80,11 +80,20 @@ class MaterialModel_ich_GOH14 : public IMaterialModel_ich
 
     virtual SymmTensor4_3D get_PK_Stiffness( const Tensor2_3D &F,
        Tensor2_3D &P_ich, SymmTensor2_3D &S_ich ) const
+    {
+      SymmTensor4_3D CC_ich;
+      eval_PK_Stiffness( F, P_ich, S_ich, CC_ich );
+      return CC_ich;
+    }
+
+    virtual void eval_PK_Stiffness( const Tensor2_3D &F, Tensor2_3D &P_ich,
+       SymmTensor2_3D &S_ich, SymmTensor4_3D &CC_ich ) const
     {
       constexpr double pt67 = 2.0 / 3.0;
 
       const auto C = STen2::gen_right_Cauchy_Green( F );
-      
+      const auto invC = STen2::inverse( C );
+
       const double val = mu * std::pow( F.det(), -pt67 );
 
       const double I1 = C.tr();
@@ -94,8 +103,15 @@ class MaterialModel_ich_GOH14 : public IMaterialModel_ich
       const double fE1 = fkd * I1 + ( 1.0 - 3.0 * fkd ) * I4 - 1.0;
       const double fE2 = fkd * I1 + ( 1.0 - 3.0 * fkd ) * I6 - 1.0;
 
-      const double dfpsi1_dfE1 = fk1 * fE1 * std::exp( fk2 * fE1 * fE1 );
-      const double dfpsi2_dfE2 = fk1 * fE2 * std::exp( fk2 * fE2 * fE2 );
+      // The exponentials are shared by the 1st and 2nd derivatives
+      const double exp1 = std::exp( fk2 * fE1 * fE1 );
+      const double exp2 = std::exp( fk2 * fE2 * fE2 );
+
+      const double dfpsi1_dfE1 = fk1 * fE1 * exp1;
+      const double dfpsi2_dfE2 = fk1 * fE2 * exp2;
+
+      const double d2fpsi1_dfE1 = fk1 * ( 1.0 + 2.0 * fk2 * fE1 * fE1 ) * exp1;
+      const double d2fpsi2_dfE2 = fk1 * ( 1.0 + 2.0 * fk2 * fE2 * fE2 ) * exp2;
 
       const auto H_f1 = fkd * STen2::gen_id() + ( 1.0 - 3.0 * fkd ) * STen2::gen_dyad( dir_a[0] );
       const auto H_f2 = fkd * STen2::gen_id() + ( 1.0 - 3.0 * fkd ) * STen2::gen_dyad( dir_a[1] );
@@ -107,18 +123,13 @@ class MaterialModel_ich_GOH14 : public IMaterialModel_ich
       // First PK stress
       P_ich = F * S_ich;
 
-      const double d2fpsi1_dfE1 = fk1 * ( 1.0 + 2.0 * fk2 * fE1 * fE1 ) * std::exp( fk2 * fE1 * fE1 );
-      const double d2fpsi2_dfE2 = fk1 * ( 1.0 + 2.0 * fk2 * fE2 * fE2 ) * std::exp( fk2 * fE2 * fE2 );
-
       // Elasticity tensor
-      auto CC_ich = pt67 * val * I1 * STen4::gen_Ptilde( STen2::inverse(C) );
+      CC_ich = pt67 * val * I1 * STen4::gen_Ptilde( invC );
 
-      CC_ich.add_SymmOutProduct( -pt67, STen2::inverse(C), S_iso );
+      CC_ich.add_SymmOutProduct( -pt67, invC, S_iso );
 
       CC_ich.add_OutProduct( 4.0 * d2fpsi1_dfE1, H_f1 );
       CC_ich.add_OutProduct( 4.0 * d2fpsi2_dfE2, H_f2 );
-
-      return CC_ich;
     }
 
     virtual double get_energy( const Tensor2_3D &F ) const
@@ -29,6 +29,14 @@ class MaterialModel_ich_NeoHookean : public IMaterialModel_ich
 
     virtual SymmTensor4_3D get_PK_Stiffness( const Tensor2_3D &F,
        Tensor2_3D &P_ich, SymmTensor2_3D &S_ich ) const
+    {
+      SymmTensor4_3D out;
+      eval_PK_Stiffness( F, P_ich, S_ich, out );
+      return out;
+    }
+
+    virtual void eval_PK_Stiffness( const Tensor2_3D &F, Tensor2_3D &P_ich,
+       SymmTensor2_3D &S_ich, SymmTensor4_3D &out ) const
     {
       constexpr double pt67 = 2.0 / 3.0;
       const auto CC = STen2::gen_right_Cauchy_Green(F);
@@ -41,11 +49,9 @@ class MaterialModel_ich_NeoHookean : public IMaterialModel_ich
      
       // Elasticity tensor 
       const auto invCC = STen2::inverse(CC);
-      auto out = pt67 * val * CC.tr() * STen4::gen_Ptilde( invCC );
+      out = pt67 * val * CC.tr() * STen4::gen_Ptilde( invCC );
       
       out.add_SymmOutProduct(-pt67, invCC, S_ich);
-
-      return out;
     }
 
     virtual double get_energy( const Tensor2_3D &F ) const
@@ -0,0 +1,142 @@
+#ifndef PDNSOLUTION_HDF5_HPP
+#define PDNSOLUTION_HDF5_HPP
+// ============================================================================
+// PDNSolution_HDF5.hpp
+//
+// HDF5 container of PDNSolution vectors. One file holds one or more
+// solutions at a time instant, each in its own group, with the layout
+//
+//   /time, /index               : the time and the time step index
+//   /old_2_new                  : length nFunc, the analysis (new) node
+//                                 index of each node in the natural (old)
+//                                 ordering of the mesh
+//   /<group>/<field>            : nFunc x field_dof doubles in the analysis
+//                                 node ordering, one dataset per field
+//
+// The fields partition the dof of the solution in order, e.g. pressure (1)
+// and velocity (3) for the NS solution. Since every rank owns a contiguous
+// range of the analysis nodes, it writes and reads its rows as a single
+// hyperslab. The field datasets are chunked along the nodes and can be
+// compressed by the filters
+//   scale-offset : lossy, keeps lossy_digits decimal digits, i.e., the
+//                  absolute error is at most 0.5 x 10^(-lossy_digits). The
+//                  digits are recorded in /lossy_digits, and such files are
+//                  meant for visualization, not for restarts;
+//   shuffle      : lossless byte shuffle that groups the bytes of equal
+//                  significance before the compressor;
+//   deflate      : lossless gzip compression, or a registered filter plugin
+//                  given by its HDF5 filter id, e.g. 32015 for zstd and 32001
+//                  for blosc, found through HDF5_PLUGIN_PATH.
+// The filters are decoded by the HDF5 library, so readers need no change.
+// The fields are created in the order of the dof, with the link creation
+// order tracked, so that a reader can interleave them without knowing the
+// field names, see HDF5_T::read_field_rows.
+//
+// With a parallel HDF5 library the file is written collectively by MPI-IO.
+// Otherwise the ranks write their rows one after another.
+//
+// A reader that needs a subset of the nodes in the natural ordering maps
+// them by /old_2_new and reads only those rows, see Read_nodes.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "hdf5.h"
+#include "PDNSolution.hpp"
+
+class PDNSolution_HDF5
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! in_field_name and in_field_dof give the name and the number of
+    //   components of each field. The old_2_new mapping is read from the
+    //   node mapping file generated by the preprocessor.
+    //   in_chunk_nodes is the number of nodes per chunk, and
+    //   in_deflate_level in [0, 9] is the compression level with 0 meaning
+    //   no compression. in_filter_id > 0 selects a filter plugin instead of
+    //   deflate, in_is_shuffle turns on the byte shuffle, and
+    //   in_lossy_digits > 0 turns on the lossy scale-offset filter.
+    // ------------------------------------------------------------------------
+    PDNSolution_HDF5( const std::vector<std::string> &in_field_name,
+        const std::vector<int> &in_field_dof,
+        const std::string &node_mapping_file = "node_mapping.h5",
+        const int &in_chunk_nodes = 65536,
+        const int &in_deflate_level = 0,
+        const bool &in_is_shuffle = false,
+        const int &in_lossy_digits = 0,
+        const int &in_filter_id = 0 );
+
+    ~PDNSolution_HDF5() = default;
+
+    // ------------------------------------------------------------------------
+    // ! Write sols[ii] into the group group_name[ii] of file_name. This is
+    //   collective, and all solutions should have the layout of the dof.
+    // ------------------------------------------------------------------------
+    void Write( const std::string &file_name,
+        const std::vector<std::string> &group_name,
+        const std::vector<const PDNSolution *> &sols,
+        const double &time, const int &index ) const;
+
+    // ------------------------------------------------------------------------
+    // ! Read the owned entries of sol from the group group_name of
+    //   file_name and update the ghost values. This is collective.
+    // ------------------------------------------------------------------------
+    void Read( const std::string &file_name, const std::string &group_name,
+        PDNSolution * const &sol ) const;
+
+    // ------------------------------------------------------------------------
+    // ! Read the field values of the nodes given in the natural ordering.
+    //   The output has length nodes.size() x field_dof with the components
+    //   of a node stored contiguously. It can be called by a single rank.
+    // ------------------------------------------------------------------------
+    static std::vector<double> Read_nodes( const std::string &file_name,
+        const std::string &group_name, const std::string &field_name,
+        const std::vector<int> &nodes );
+
+    // ------------------------------------------------------------------------
+    // ! Return the decimal digits kept by the lossy filter in file_name, or
+    //   0 if the file is lossless.
+    // ------------------------------------------------------------------------
+    static int get_lossy_digits( const std::string &file_name );
+
+    void print_info() const;
+
+  private:
+    const std::vector<std::string> field_name;
+
+    const std::vector<int> field_dof;
+
+    const int dof, chunk_nodes, deflate_level;
+
+    const bool is_shuffle;
+
+    const int lossy_digits, filter_id;
+
+    // old_2_new mapping of all nodes, its length is nFunc
+    const std::vector<int> old_2_new;
+
+    const int nFunc;
+
+    // Create the file with the time, index, and the empty field datasets
+    // of all groups
+    hid_t Create_file( const std::string &file_name, const hid_t &fapl,
+        const std::vector<std::string> &group_name,
+        const double &time, const int &index ) const;
+
+    // Write the rows [node_start, node_start + num_node) of old_2_new and of
+    // the fields of the solutions into the file
+    void Write_rows( const hid_t &file_id, const hid_t &dxpl,
+        const std::vector<std::string> &group_name,
+        const std::vector<const PDNSolution *> &sols,
+        const int &node_start, const int &num_node ) const;
+
+    // Print the compression ratio and the throughput of a written file
+    void Report( const std::string &file_name,
+        const std::vector<std::string> &group_name,
+        const double &write_time ) const;
+
+    // Obtain the owned node range of sol
+    void get_node_range( const PDNSolution * const &sol, int &node_start,
+        int &num_node ) const;
+};
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef PDNSOLUTION_HISTORY_HPP
+#define PDNSOLUTION_HISTORY_HPP
+// ============================================================================
+// PDNSolution_History.hpp
+//
+// A fixed-capacity ring buffer of PDNSolution snapshots together with the
+// time instants they belong to. It is used by the time solvers to build
+// extrapolation-type predictors from the previously converged solutions.
+//
+// The snapshots are addressed by their lag: lag 0 is the most recently
+// pushed one, lag 1 the one before it, etc. Once the buffer is full, a
+// new push overwrites the oldest snapshot without allocating new vectors.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "PDNSolution.hpp"
+
+class PDNSolution_History
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! Allocate in_capacity snapshots with the same layout as sample. The
+    //   values of sample are NOT stored; the history is empty on return.
+    // ------------------------------------------------------------------------
+    PDNSolution_History( const PDNSolution * const &sample,
+        const int &in_capacity );
+
+    ~PDNSolution_History() = default;
+
+    // ------------------------------------------------------------------------
+    // ! Store a copy of sol with time stamp time as the lag-0 snapshot
+    // ------------------------------------------------------------------------
+    void Push( const PDNSolution * const &sol, const double &time );
+
+    // ------------------------------------------------------------------------
+    // ! Discard all stored snapshots (the memory is kept)
+    // ------------------------------------------------------------------------
+    void Clear() { head = -1; num_stored = 0; }
+
+    int get_capacity() const { return capacity; }
+
+    int get_size() const { return num_stored; }
+
+    // ------------------------------------------------------------------------
+    // ! Access the snapshot and its time with 0 <= lag < get_size()
+    // ------------------------------------------------------------------------
+    const PDNSolution * get_sol( const int &lag ) const
+    { return snapshot[ get_slot(lag) ].get(); }
+
+    double get_time( const int &lag ) const
+    { return snap_time[ get_slot(lag) ]; }
+
+    void print_info() const;
+
+  private:
+    const int capacity;
+
+    // slot of the lag-0 snapshot and the number of valid snapshots
+    int head, num_stored;
+
+    std::vector< std::unique_ptr<PDNSolution> > snapshot;
+
+    std::vector<double> snap_time;
+
+    int get_slot( const int &lag ) const
+    {
+      ASSERT( lag >= 0 && lag < num_stored, "Error: PDNSolution_History lag %d is out of range [0, %d).\n", lag, num_stored );
+      return (head - lag + capacity) % capacity;
+    }
+};
+
+#endif
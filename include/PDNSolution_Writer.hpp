@@ -0,0 +1,78 @@
+#ifndef PDNSOLUTION_WRITER_HPP
+#define PDNSOLUTION_WRITER_HPP
+// ============================================================================
+// PDNSolution_Writer.hpp
+//
+// Asynchronous writer of PDNSolution vectors in the PETSc binary format,
+// i.e., the files can be read by PDNSolution::ReadBinary and the existing
+// postprocessing tools as if they were written by PDNSolution::WriteBinary.
+//
+// Write copies the owned entries of the vector into one of num_buffer
+// staging buffers, opens the file with MPI-IO, and starts a nonblocking
+// collective write (MPI_File_iwrite_at_all) of each rank's block at the
+// offset of its ownership range; rank 0 also writes the header. The MPI
+// library thus takes care of the consistency of the shared file, also on
+// NFS. All calls are made from the calling thread, so no MPI thread support
+// is needed. How much of the write overlaps the computation depends on the
+// asynchronous progress of the MPI library; Write tests the requests in
+// flight to drive it.
+//
+// If all staging buffers are in flight, Write completes and closes the
+// oldest file first. Write, Flush, and the destructor are collective, and
+// every rank has to write the same files in the same order.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include <deque>
+#include "PDNSolution.hpp"
+
+class PDNSolution_Writer
+{
+  public:
+    PDNSolution_Writer( const int &in_num_buffer = 2 );
+
+    // Complete the pending files
+    ~PDNSolution_Writer();
+
+    // ------------------------------------------------------------------------
+    // ! Stage the values of sol and start writing them into file_name
+    // ------------------------------------------------------------------------
+    void Write( const PDNSolution * const &sol, const std::string &file_name );
+
+    // ------------------------------------------------------------------------
+    // ! Wait for all staged files to be complete on disk
+    // ------------------------------------------------------------------------
+    void Flush();
+
+    void print_info() const;
+
+  private:
+    struct Snapshot
+    {
+      std::string file_name;
+
+      // the bytes of this rank in the file, starting at offset
+      MPI_Offset offset;
+      std::vector<char> data;
+
+      MPI_File fh;
+      MPI_Request request;
+    };
+
+    const int num_buffer;
+
+    const PetscMPIInt rank;
+
+    // idle holds the staging buffers available to Write; pending holds the
+    // ones in flight in the order of Write calls
+    std::vector< std::unique_ptr<Snapshot> > idle;
+    std::deque< std::unique_ptr<Snapshot> > pending;
+
+    // ------------------------------------------------------------------------
+    // ! Wait for the oldest pending write, close its file, and return its
+    //   buffer to idle. Collective.
+    // ------------------------------------------------------------------------
+    void Complete_oldest();
+};
+
+#endif
@@ -9,6 +9,10 @@
 //         which is an integer array with the length equaling to the number of 
 //         local elements.
 //
+//         The local elements are sorted by the physical tag, so that the
+//         fluid (tag 0) and the solid (tag 1) elements occupy two contiguous
+//         ranges of the local element indices.
+//
 // Date Created: July 27 2017
 // ============================================================================
 #include "Part_FEM.hpp"
@@ -0,0 +1,78 @@
+#ifndef POSTVECTSCATTER_HPP
+#define POSTVECTSCATTER_HPP
+// ============================================================================
+// PostVectScatter.hpp
+// ----------------------------------------------------------------------------
+// This class reads solution vectors written by the analysis code and hands
+// each postprocessing rank the entries of its local and ghost nodes. It is
+// the distributed counterpart of the reading done in PostVectSolution.
+//
+// The composition of the postprocessor's new_2_old and the analysis code's
+// old_2_new maps is evaluated once in the constructor without holding the
+// full maps on any rank. Every rank reads a slice of both maps, i.e., a
+// range of the node indices, as an HDF5 hyperslab. The old_2_new slices
+// form a parallel vector, which is scattered by the new_2_old slices to
+// the composed map distributed over the postprocessing node indices. Each
+// rank then gathers the entries of its local and ghost nodes, and the
+// composed map is stored in a VecScatter from the parallel solution vector
+// to a sequential vector of length nlocghonode x dof. The memory per rank
+// is thus O(nFunc / size + nlocghonode).
+//
+// Each call of Read then loads the PETSc binary file collectively, i.e.,
+// every rank receives only its own slice, and scatters the needed entries.
+// The mapping files are not read again, so one object should be reused for
+// all time steps.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "APart_Node.hpp"
+#include "HDF5_Tools.hpp"
+#include "petscvec.h"
+
+class PostVectScatter
+{
+  public:
+    // ------------------------------------------------------------------------
+    // Constructor:
+    //   \para analysis_node_mapping_file: the old_2_new mapping from the
+    //                                     analysis run;
+    //   \para post_node_mapping_file: the new_2_old mapping from the
+    //                                 postprocessing partition;
+    //   \para aNode_ptr: the node partition from post_part files;
+    //   \para in_nfunc: the number of nodes;
+    //   \para input_dof: the degree of freedom of the solution vector.
+    // This is collective.
+    // ------------------------------------------------------------------------
+    PostVectScatter( const std::string &analysis_node_mapping_file,
+        const std::string &post_node_mapping_file,
+        const APart_Node * const &aNode_ptr,
+        const int &in_nfunc, const int &input_dof );
+
+    ~PostVectScatter();
+
+    int get_dof() const {return dof_per_node;}
+
+    int get_solsize() const {return loc_sol_size;}
+
+    // ------------------------------------------------------------------------
+    // Read the PETSc binary file solution_file_name collectively and copy
+    // the entries of the local and ghost nodes into loc_solution, which
+    // should have length get_solsize(). A file named *.h5 is read from the
+    // group sol of a PDNSolution_HDF5 file, each rank reading its rows.
+    // ------------------------------------------------------------------------
+    void Read( const std::string &solution_file_name,
+        double * const &loc_solution ) const;
+
+  private:
+    const int dof_per_node; // dof of the solution vector
+    const int loc_sol_size; // nlocghonode x dof
+    const int vec_size;     // nFunc x dof
+
+    // glo_sol holds the parallel solution vector, loc_sol the entries of
+    // the local and ghost nodes in the postprocessing numbering
+    Vec glo_sol, loc_sol;
+
+    VecScatter scatter;
+};
+
+#endif
@@ -17,12 +17,16 @@
 // 2. rearrange the numbering of the vector based on postproce code's node partition;
 // 3. extract local vector for each processor in postprocessing.
 //
+// Alternatively, the solution can be obtained from a PostVectScatter, which
+// loads the vector in parallel and sends each processor only its entries.
+//
+// A solution file named *.h5 is read from the group sol of a file written by
+// PDNSolution_HDF5, which may be compressed, instead of the PETSc binary.
+//
 // Author: Ju Liu
 // Date: Dec 10 2013
 // ============================================================================
-#include "APart_Node.hpp"
-#include "HDF5_Tools.hpp"
-#include "petscvec.h"
+#include "PostVectScatter.hpp"
 
 class PostVectSolution
 {
@@ -46,6 +50,16 @@ class PostVectSolution
        const APart_Node * const &aNode_ptr,
        const int &in_nfunc, const int &input_dof );
 
+    // ------------------------------------------------------------------------
+    // Constructor with the reordering precomputed in scatter:
+    //   \para solution_file_name: the name of PETSc binary file that
+    //                             records the solution vector;
+    //   \para scatter: the reader built for the postprocessing partition.
+    // This is collective.
+    // ------------------------------------------------------------------------
+    PostVectSolution( const std::string &solution_file_name,
+       const PostVectScatter * const &scatter );
+
     // ------------------------------------------------------------------------
     // Destructor
     // ------------------------------------------------------------------------
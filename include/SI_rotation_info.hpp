@@ -1,7 +1,7 @@
 #ifndef SI_ROTATION_INFO_HPP
 #define SI_ROTATION_INFO_HPP
 
-#include "Vector_3.hpp"
+#include "Tensor2_3D.hpp"
 
 class SI_rotation_info
 {
@@ -42,6 +42,28 @@ class SI_rotation_info
       
       return theta;
     }
+
+    // ------------------------------------------------------------------------
+    // Rotation matrix at time for the rotation around the unit rotation
+    // vector (a, b, c), by Rodrigues's Formula with the rotation angle theta
+    // [ cos(theta) + a*a(1-cos(theta)),    a*b(1-cos(theta)) - c*sin(theta), b*sin(theta) + a*c(1-cos(theta))  ]
+    // [ c*sin(theta) + a*b(1-cos(theta)),  cos(theta) + b*b(1-cos(theta)),   -a*sin(theta) + b*c(1-cos(theta)) ]
+    // [ -b*sin(theta) + a*c(1-cos(theta)), a*sin(theta) + b*c(1-cos(theta)), cos(theta) + c*c(1-cos(theta))    ]
+    // The current point of x is point_rotated + R (x - point_rotated).
+    // ------------------------------------------------------------------------
+    Tensor2_3D get_rotation_matrix(const double &time) const
+    {
+      const double aa = direction_rotated.x();
+      const double bb = direction_rotated.y();
+      const double cc = direction_rotated.z();
+
+      const double theta = get_rotated_theta(time);
+      const double cos_t = std::cos(theta), sin_t = std::sin(theta);
+
+      return Tensor2_3D( cos_t + aa*aa*(1-cos_t), aa*bb*(1-cos_t) - cc*sin_t, bb*sin_t + aa*cc*(1-cos_t),
+          cc*sin_t + aa*bb*(1-cos_t), cos_t + bb*bb*(1-cos_t), -aa*sin_t + bb*cc*(1-cos_t),
+          -bb*sin_t + aa*cc*(1-cos_t), aa*sin_t + bb*cc*(1-cos_t), cos_t + cc*cc*(1-cos_t) );
+    }
     
   private:
     // Info of rotation axis
@@ -15,12 +15,21 @@
 
 namespace SI_T
 {
+  // The solution, mesh velocity, and mesh displacement of the interface
+  // nodes needed by this rank. The solution and the mesh velocity are read
+  // on every Newton iteration, so only the nodes referenced by the local
+  // interface elements and their opposite elements are brought from their
+  // owners through a PetscSF, which communicates with the neighbouring ranks
+  // only. The plan is set after every interface search by set_comm_plan. The
+  // mesh displacement of the local and halo rotated nodes stored in this
+  // part is needed by the search itself, and is brought once per time step
+  // through a second PetscSF set in the constructor.
   class SI_solution
   {
     public:
       SI_solution(const std::string &fileBaseName, const int &cpu_rank);
 
-      ~SI_solution() = default;
+      ~SI_solution();
 
       // Return the local ien array and the local solution array of a fixed layer element
       void get_fixed_local(const ALocal_Interface * const &itf,
@@ -31,8 +40,9 @@ namespace SI_T
         {
           local_ien[nn] = itf->get_fixed_lien(ii, ee * nLocBas + nn);
 
+          const int slot = fixed_node_slot[ii][local_ien[nn]];
           for(int dd = 0; dd < dof_sol; ++dd)
-            local_sol[dof_sol * nn + dd] = fixed_node_sol[ii][dof_sol * local_ien[nn] + dd];
+            local_sol[dof_sol * nn + dd] = leaf_sol[dof_sol * slot + dd];
         }
       }
 
@@ -57,17 +67,26 @@ namespace SI_T
       {
         for(int nn = 0; nn < nLocBas; ++nn)
         {
+          const int slot = rotated_node_slot[ii][local_ien[nn]];
           for(int dd = 0; dd < dof_sol; ++dd)
           {
-            local_sol[dof_sol * nn + dd] = rotated_node_sol[ii][dof_sol * local_ien[nn] + dd];
+            local_sol[dof_sol * nn + dd] = leaf_sol[dof_sol * slot + dd];
           }
           for(int dd = 0; dd < 3; ++dd)
           {
-            local_mvleo[3 * nn + dd] = rotated_node_mvelo[ii][3 * local_ien[nn] + dd];
+            local_mvleo[3 * nn + dd] = leaf_mvelo[3 * slot + dd];
           }
         }
       }
 
+      // ------------------------------------------------------------------------
+      // ! Set the communication plan for the interface nodes listed in
+      //   fixed_node and rotated_node of each interface. The nodal values are
+      //   zero until the next update_node_sol / update_node_mvelo.
+      // ------------------------------------------------------------------------
+      void set_comm_plan(const std::vector<std::vector<int>> &fixed_node,
+          const std::vector<std::vector<int>> &rotated_node);
+
       void update_node_sol(const PDNSolution * const &sol);
 
       void update_node_mvelo(const PDNSolution * const &mvelo);
@@ -76,23 +95,12 @@ namespace SI_T
 
       void zero_node_sol()
       {
-        for(int ii = 0; ii < VEC_T::get_size(num_fixed_node); ++ii)
-        {
-          for(int jj = 0; jj < dof_sol * num_fixed_node[ii]; ++jj)
-            fixed_node_sol[ii][jj] = 0.0;
-
-          for(int jj = 0; jj < dof_sol * num_rotated_node[ii]; ++jj)
-            rotated_node_sol[ii][jj] = 0.0;
-        }
+        std::fill(leaf_sol.begin(), leaf_sol.end(), 0.0);
       }
 
       void Zero_node_mvelo()
       {
-        for(int ii = 0; ii < VEC_T::get_size(num_fixed_node); ++ii)
-        {
-          for(int jj = 0; jj < 3 * num_rotated_node[ii]; ++jj)
-            rotated_node_mvelo[ii][jj] = 0.0;
-        }
+        std::fill(leaf_mvelo.begin(), leaf_mvelo.end(), 0.0);
       }
 
       void Zero_node_disp()
@@ -108,14 +116,14 @@ namespace SI_T
       const int cpu_rank;
       int nLocBas, dof_sol;
 
+      // the number of local and ghost nodes of this partition, i.e., the
+      // roots of the communication plan
+      int nlocghonode;
+
       // the number of the nodes from the fixed volume elements
       // size: num_itf
       std::vector<int> num_fixed_node;
 
-      // stores the pressure and velocity info of the nodes from the fixed volume elements
-      // size: num_itf x (4 x num_fixed_node[ii])
-      std::vector<std::vector<double>> fixed_node_sol;
-    
       // stores the partition tag of the nodes from the rotated volume elements
       // size: num_itf x num_fixed_node[ii]
       std::vector<std::vector<int>> fixed_node_part_tag;
@@ -124,18 +132,15 @@ namespace SI_T
       // size: num_itf x num_fixed_node[ii]
       std::vector<std::vector<int>> fixed_node_loc_pos;
 
+      // the position of the nodes from the fixed volume elements in the leaf
+      // arrays, -1 if the node is not needed by this rank
+      // size: num_itf x num_fixed_node[ii]
+      std::vector<std::vector<int>> fixed_node_slot;
+
       // the number of the nodes from the rotated volume elements
       // size: num_itf
       std::vector<int> num_rotated_node;
 
-      // stores the pressure and velocity info of the nodes from the rotated volume elements
-      // size: num_itf x (4 x num_rotated_node[ii])
-      std::vector<std::vector<double>> rotated_node_sol;
-
-      // stores the mesh velocity info of the nodes from the rotated volume elements
-      // size: num_itf x (3 x num_rotated_node[ii])    
-      std::vector<std::vector<double>> rotated_node_mvelo;    
-
       // stores the mesh displacement info of the nodes from the rotated volume elements
       // size: num_itf x (3 x num_rotated_node[ii])    
       std::vector<std::vector<double>> rotated_node_mdisp;      
@@ -147,6 +152,72 @@ namespace SI_T
       // stores the local position in the partition of the nodes from the rotated volume elements
       // size: num_itf x num_rotated_node[ii]
       std::vector<std::vector<int>> rotated_node_loc_pos;
+
+      // the position of the nodes from the rotated volume elements in the
+      // leaf arrays, -1 if the node is not needed by this rank
+      // size: num_itf x num_rotated_node[ii]
+      std::vector<std::vector<int>> rotated_node_slot;
+
+      // the communication plan from the owners to the needed nodes
+      PetscSF node_sf;
+
+      // the communication plan from the owners to all the rotated nodes
+      // stored in this part
+      PetscSF mdisp_sf;
+
+      // stores the pressure and velocity info, and the mesh velocity of the
+      // needed nodes
+      // size: dof_sol x num_leaf and 3 x num_leaf
+      std::vector<double> leaf_sol, leaf_mvelo;
+
+      // Bring the nodal values with dof entries from the local array of
+      // vec into leaf through sf
+      void bcast_node_value(const PetscSF &sf, const PDNSolution * const &vec,
+          const int &dof, std::vector<double> &leaf) const;
+  };
+
+  // Bounding volume hierarchy over the faces of one side of an interface.
+  // A face is given by its element index and its axis-aligned box, stored
+  // as (xmin, ymin, zmin, xmax, ymax, zmax). The tree is built once by
+  // median splits of the box centers, and refitted bottom-up in
+  // O(num_face) when the faces move, e.g. after a rotation.
+  class SI_face_tree
+  {
+    public:
+      SI_face_tree() = default;
+
+      ~SI_face_tree() = default;
+
+      void build(const std::vector<int> &in_ele, const std::vector<double> &in_box);
+
+      // Update the boxes of the faces and of the tree nodes, the faces
+      // should be given in the same order as in build
+      void refit(const std::vector<double> &in_box);
+
+      // Return the elements whose box contains pt, nearest box center first
+      std::vector<int> query(const Vector_3 &pt) const;
+
+      bool is_built() const {return !node_left.empty();}
+
+    private:
+      // the maximum number of faces in a leaf
+      static constexpr int leaf_size = 4;
+
+      // element index and box of each face
+      std::vector<int> ele;
+      std::vector<double> box;
+
+      // face indices grouped by the leaves
+      std::vector<int> order;
+
+      // box, children, and face range [begin, end) of each tree node, the
+      // children are -1 for a leaf and always stored after their parent
+      std::vector<double> node_box;
+      std::vector<int> node_left, node_right, node_begin, node_end;
+
+      int build_node(const int &begin, const int &end);
+
+      void set_node_box(const int &node);
   };
 
   class SI_quad_point
@@ -172,6 +243,22 @@ namespace SI_T
           const ALocal_Interface * const &itf_part,
           const SI_solution * const &SI_sol );
 
+      // ----------------------------------------------------------------------
+      // Set the communication plan of SI_sol for the nodes of the local
+      // interface elements and of the opposite elements found in the last
+      // search. This should be called after search_all_opposite_point.
+      // ----------------------------------------------------------------------
+      void set_comm_plan( const ALocal_Interface * const &itf_part,
+          SI_solution * const &SI_sol ) const;
+
+      // ----------------------------------------------------------------------
+      // Search the element on the other side of the interface that contains
+      // the projection of the point. rotated_ee / fixed_ee is the match of
+      // the previous search on input, -1 if there is none, and is tried
+      // first. Then the elements whose box in the face tree contains the
+      // point are tried, and the elements with the same or the neighbouring
+      // tag are the last resort.
+      // ----------------------------------------------------------------------
       void search_opposite_rotated_point(
           const Vector_3 &fixed_pt,
           const ALocal_Interface * const &itf_part,
@@ -191,6 +278,15 @@ namespace SI_T
     private:
       const int nqp_sur;
 
+      // Face trees of the fixed and the rotated elements of each interface.
+      // The fixed trees are built once, and the rotated trees are refitted
+      // in every search with the current mesh displacement.
+      std::vector<SI_face_tree> fixed_tree, rotated_tree;
+
+      // Ratio of the face box size added to each side of the box, which
+      // covers the gap between the two discretized sides of an interface
+      const double box_enlarge = 0.25;
+
       // For the interface integral
       const std::unique_ptr<FEAElement> anchor_elementv;
 
@@ -219,6 +315,40 @@ namespace SI_T
       std::vector<std::vector<int>> rotated_qp_curr_fixed_ee;
       std::vector<std::vector<double>> rotated_qp_curr_fixed_xi;
       std::vector<std::vector<double>> rotated_qp_curr_fixed_eta;
+
+      // Build or refit the face trees
+      void update_face_tree(const ALocal_Interface * const &itf_part,
+          const SI_solution * const &SI_sol);
+
+      // All elements of a side of an interface, collected from the tags
+      std::vector<int> get_all_fixed_ele(const ALocal_Interface * const &itf_part,
+          const int &itf_id) const;
+
+      std::vector<int> get_all_rotated_ele(const ALocal_Interface * const &itf_part,
+          const int &itf_id) const;
+
+      // Enlarged boxes of the interface faces of the elements
+      std::vector<double> get_fixed_box(const ALocal_Interface * const &itf_part,
+          const int &itf_id, const std::vector<int> &eles) const;
+
+      std::vector<double> get_rotated_box(const ALocal_Interface * const &itf_part,
+          const SI_solution * const &SI_sol, const int &itf_id,
+          const std::vector<int> &eles) const;
+
+      std::vector<double> get_face_box(const int &face_id,
+          const std::vector<double> &volctrl_x, const std::vector<double> &volctrl_y,
+          const std::vector<double> &volctrl_z) const;
+
+      // Project the point onto the interface face of an element, the result
+      // is stored in free_quad
+      bool project_to_fixed_ele(const Vector_3 &pt,
+          const ALocal_Interface * const &itf_part, const int &itf_id,
+          const int &ee);
+
+      bool project_to_rotated_ele(const Vector_3 &pt,
+          const ALocal_Interface * const &itf_part,
+          const SI_solution * const &SI_sol, const int &itf_id,
+          const int &ee);
   };
 
   void get_currPts( const double * const &ept_x,
@@ -194,6 +194,17 @@ class SymmTensor4_3D
     // ------------------------------------------------------------------------
     void pull_back_stiffness( const Tensor2_3D &invF );
 
+    // ------------------------------------------------------------------------
+    // Multiply a vector in the Voigt notation from the left,
+    //                out_J = vec_I ten_IJ,
+    // with 0 <= I, J < 6 following the diagram above. The last three entries
+    // of vec are the shear components in the engineering form, i.e.,
+    // vec_3 = A_12 + A_21 for a 2nd-order tensor A, so that out_J = A_kl ten_klJ
+    // for an A without symmetry. This is used to contract the elasticity
+    // tensor with the gradients of the basis functions in the tangent matrix.
+    // ------------------------------------------------------------------------
+    void VoigtVecMult( const double * const &vec, double * const &out ) const;
+
     // ------------------------------------------------------------------------
     // transform the natural indices of forth-order symmetric tensor to Voigt 
     // notation, minor symmetry requires ij / ji: 3x3 -> 6, kl / lk: 3x3 -> 6,
@@ -217,6 +228,19 @@ class SymmTensor4_3D
       3, 8,  12, 15, 16, 17,
       4, 9,  13, 16, 18, 19,
       5, 10, 14, 17, 19, 20 }};
+
+    // ------------------------------------------------------------------------
+    // The 6 x 6 matrix of ten in the Voigt notation, stored row by row
+    // ------------------------------------------------------------------------
+    std::array<double,36> Voigt_mat() const;
+
+    // ------------------------------------------------------------------------
+    // Set ten to TT mat TT^T, with the 6 x 6 matrices TT and mat stored row
+    // by row. The products run over contiguous rows so that the compiler can
+    // vectorize them.
+    // ------------------------------------------------------------------------
+    void set_congruence( const std::array<double,36> &TT,
+        const std::array<double,36> &mat );
 };
 
 SymmTensor4_3D operator*( const double &val, const SymmTensor4_3D &input );
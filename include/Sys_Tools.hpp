@@ -12,6 +12,7 @@
 #include <string>
 #include <ctime>
 #include <memory>
+#include <vector>
 #include <sys/stat.h>
 #include "petsc.h"
 #ifdef USE_OPENMP
@@ -615,6 +616,221 @@ namespace SYS_T
 #endif
   };
 
+  // ================================================================
+  // Performance instrumentation
+  // The solver stages are enumerated in Perf_Event and registered once
+  // as PETSc log events under the class "PERIGEE", so that they appear
+  // in -log_view. A Perf_Scope object opens an event at construction
+  // and closes it at destruction. The wall time of each event is also
+  // accumulated in Perf_Registry, which provides
+  //   (1) a summary of the cumulative time with min/max/avg over the
+  //       ranks, which shows the load imbalance of each stage, and
+  //   (2) an optional per-time-step trace in CSV format, enabled by
+  //       set_trace_file, with the max and avg over the ranks.
+  // Events may be nested, and the recorded times are inclusive. An event
+  // entered again before it ends, e.g. a linear solve inside a
+  // preconditioner, is timed only by its outermost call.
+  // ================================================================
+  enum Perf_Event : int
+  {
+    PERF_ASSEM_KG = 0,    // global tangent & residual assembly
+    PERF_ASSEM_G,         // global residual assembly
+    PERF_ASSEM_VOL,       // volumetric element loop
+    PERF_ASSEM_FLUID,     // fluid element range of the volumetric loop in FSI
+    PERF_ASSEM_SOLID,     // solid element range of the volumetric loop in FSI
+    PERF_NATBC_G,         // natural bc on the outlets
+    PERF_BACKFLOW_KG,     // backflow stabilization
+    PERF_BACKFLOW_G,      // backflow stabilization, residual only
+    PERF_NATBC_RESIS_KG,  // resistance-type bc on the outlets
+    PERF_NATBC_RESIS_G,   // resistance-type bc on the outlets, residual only
+    PERF_WEAK_ESSBC_KG,   // weakly enforced no-slip bc
+    PERF_WEAK_ESSBC_G,    // weakly enforced no-slip bc, residual only
+    PERF_INTERFACE_KG,    // sliding interface integrals
+    PERF_SURFACE_INT,     // surface flow rate & pressure integrals
+    PERF_GENBC,           // reduced (0D) model evaluation
+    PERF_LIN_SOLVE,       // linear solves (PLinear_Solver_PETSc)
+    PERF_MESH_MOTION,     // mesh motion assembly & solve in FSI
+    PERF_PC_A_SOLVE,      // A block solve in the Schur complement preconditioner
+    PERF_PC_S_SOLVE,      // Schur complement solve in the preconditioner
+    PERF_SOL_UPDATE,      // solution update after the linear solve
+    PERF_GHOST_UPDATE,    // ghost value scatter of solution vectors
+    PERF_FILE_WRITE,      // solution file output
+    PERF_NUM_EVENTS
+  };
+
+  inline const char * get_perf_event_name( const int &ev )
+  {
+    static const char * const names[PERF_NUM_EVENTS] = { "assem_KG",
+      "assem_G", "assem_vol", "assem_fluid", "assem_solid", "NatBC_G",
+      "BackFlow_KG", "BackFlow_G", "NatBC_Resis_KG", "NatBC_Resis_G",
+      "Weak_EssBC_KG", "Weak_EssBC_G", "Interface_KG", "surface_int", "GenBC", "lin_solve",
+      "mesh_motion", "A_solve", "S_solve", "sol_update", "ghost_update", "file_write" };
+
+    return names[ev];
+  }
+
+  class Perf_Registry
+  {
+    public:
+      static Perf_Registry & instance()
+      {
+        static Perf_Registry reg;
+        return reg;
+      }
+
+      void Begin( const Perf_Event &ev )
+      {
+        if( !is_registered ) Register();
+#ifdef PETSC_USE_LOG
+        PetscLogEventBegin(event[ev], 0,0,0,0);
+#endif
+        if( depth[ev]++ == 0 ) start_sec[ev] = MPI_Wtime();
+      }
+
+      void End( const Perf_Event &ev )
+      {
+#ifdef PETSC_USE_LOG
+        PetscLogEventEnd(event[ev], 0,0,0,0);
+#endif
+        // only the outermost call of a recursively entered event is timed
+        if( --depth[ev] > 0 ) return;
+
+        const double elapsed = MPI_Wtime() - start_sec[ev];
+        step_sec[ev]  += elapsed;
+        total_sec[ev] += elapsed;
+        num_calls[ev] += 1;
+      }
+
+      // ----------------------------------------------------------------
+      // The trace file is written by rank 0 and is truncated here.
+      // ----------------------------------------------------------------
+      void set_trace_file( const std::string &fname )
+      {
+        trace_file = fname;
+
+        if( trace_file.empty() || get_MPI_rank() != 0 ) return;
+
+        std::ofstream ofile( trace_file.c_str(), std::ofstream::out | std::ofstream::trunc );
+        ofile<<"time_index";
+        for(int ii=0; ii<PERF_NUM_EVENTS; ++ii)
+          ofile<<','<<get_perf_event_name(ii)<<"_max,"<<get_perf_event_name(ii)<<"_avg";
+        ofile<<'\n';
+        ofile.close();
+      }
+
+      // ----------------------------------------------------------------
+      // Append the times of the current step to the trace file and reset
+      // the step counters. It is collective and does nothing if the trace
+      // is not enabled.
+      // ----------------------------------------------------------------
+      void Record_step( const int &time_index )
+      {
+        if( trace_file.empty() ) return;
+
+        std::vector<double> step_max( PERF_NUM_EVENTS, 0.0 ), step_sum( PERF_NUM_EVENTS, 0.0 );
+
+        MPI_Reduce(step_sec, &step_max[0], PERF_NUM_EVENTS, MPI_DOUBLE, MPI_MAX, 0, PETSC_COMM_WORLD);
+        MPI_Reduce(step_sec, &step_sum[0], PERF_NUM_EVENTS, MPI_DOUBLE, MPI_SUM, 0, PETSC_COMM_WORLD);
+
+        if( get_MPI_rank() == 0 )
+        {
+          const double size = static_cast<double>( get_MPI_size() );
+
+          std::ofstream ofile( trace_file.c_str(), std::ofstream::out | std::ofstream::app );
+          ofile<<time_index;
+          for(int ii=0; ii<PERF_NUM_EVENTS; ++ii)
+            ofile<<','<<step_max[ii]<<','<<step_sum[ii] / size;
+          ofile<<'\n';
+          ofile.close();
+        }
+
+        for(int ii=0; ii<PERF_NUM_EVENTS; ++ii) step_sec[ii] = 0.0;
+      }
+
+      // ----------------------------------------------------------------
+      // Print the cumulative time of each event called at least once, with
+      // min/max/avg over the ranks and the imbalance ratio max/avg. It is
+      // collective.
+      // ----------------------------------------------------------------
+      void print_summary() const
+      {
+        double t_min[PERF_NUM_EVENTS], t_max[PERF_NUM_EVENTS], t_sum[PERF_NUM_EVENTS];
+        int n_max[PERF_NUM_EVENTS];
+
+        MPI_Allreduce(total_sec, t_min, PERF_NUM_EVENTS, MPI_DOUBLE, MPI_MIN, PETSC_COMM_WORLD);
+        MPI_Allreduce(total_sec, t_max, PERF_NUM_EVENTS, MPI_DOUBLE, MPI_MAX, PETSC_COMM_WORLD);
+        MPI_Allreduce(total_sec, t_sum, PERF_NUM_EVENTS, MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+        MPI_Allreduce(num_calls, n_max, PERF_NUM_EVENTS, MPI_INT, MPI_MAX, PETSC_COMM_WORLD);
+
+        const double size = static_cast<double>( get_MPI_size() );
+
+        commPrint("----------------------------------------------------------- \n");
+        commPrint("Performance summary over %d rank(s), time in seconds:\n", get_MPI_size());
+        commPrint("  %-16s %10s %12s %12s %12s %8s \n", "event", "calls", "min", "max", "avg", "max/avg");
+        for(int ii=0; ii<PERF_NUM_EVENTS; ++ii)
+        {
+          if( n_max[ii] == 0 ) continue;
+
+          const double t_avg = t_sum[ii] / size;
+          commPrint("  %-16s %10d %12.4e %12.4e %12.4e %8.3f \n", get_perf_event_name(ii),
+              n_max[ii], t_min[ii], t_max[ii], t_avg, t_avg > 0.0 ? t_max[ii] / t_avg : 1.0);
+        }
+        commPrint("----------------------------------------------------------- \n");
+      }
+
+    private:
+      bool is_registered;
+      std::string trace_file;
+      double start_sec[PERF_NUM_EVENTS], step_sec[PERF_NUM_EVENTS], total_sec[PERF_NUM_EVENTS];
+      int num_calls[PERF_NUM_EVENTS], depth[PERF_NUM_EVENTS];
+#ifdef PETSC_USE_LOG
+      PetscLogEvent event[PERF_NUM_EVENTS];
+#endif
+
+      Perf_Registry() : is_registered(false), trace_file("")
+      {
+        for(int ii=0; ii<PERF_NUM_EVENTS; ++ii)
+        {
+          start_sec[ii] = 0.0; step_sec[ii] = 0.0; total_sec[ii] = 0.0;
+          num_calls[ii] = 0; depth[ii] = 0;
+        }
+      }
+
+      Perf_Registry( const Perf_Registry & ) = delete;
+      Perf_Registry & operator=( const Perf_Registry & ) = delete;
+
+      void Register()
+      {
+#ifdef PETSC_USE_LOG
+        PetscClassId classid;
+        PetscClassIdRegister("PERIGEE", &classid);
+        for(int ii=0; ii<PERF_NUM_EVENTS; ++ii)
+          PetscLogEventRegister(get_perf_event_name(ii), classid, &event[ii]);
+#endif
+        is_registered = true;
+      }
+  };
+
+  class Perf_Scope
+  {
+    public:
+      explicit Perf_Scope( const Perf_Event &in_ev ) : ev( in_ev )
+      { Perf_Registry::instance().Begin( ev ); }
+
+      ~Perf_Scope() { Perf_Registry::instance().End( ev ); }
+
+      Perf_Scope( const Perf_Scope & ) = delete;
+      Perf_Scope & operator=( const Perf_Scope & ) = delete;
+
+    private:
+      const Perf_Event ev;
+  };
+
+  // Open and close an event for a code segment that is not a full scope
+  inline void Perf_Begin( const Perf_Event &ev ) { Perf_Registry::instance().Begin( ev ); }
+
+  inline void Perf_End( const Perf_Event &ev ) { Perf_Registry::instance().End( ev ); }
+
   // Print ASCII art text for the code
   inline void print_perigee_art()
   {
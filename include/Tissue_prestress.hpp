@@ -3,9 +3,21 @@
 // ============================================================================
 // Tissue_prestress.hpp
 //
-// This class stores the values of the pre-stresses at quadrature points. 
+// This class stores the values of the pre-stresses at quadrature points.
 // Pre-stress contains 6 components for the symmetric stress tensor.
 //
+// The values of all solid elements are stored in one flat array, element by
+// element, and an element's values are accessed by a pointer without copy.
+//
+// The prestress of all ranks is written into one file <ps_fName>.h5, with
+// the dataset prestress of size (number of solid quadrature points) x 6 and
+// the dataset rank_offset giving the first row of each rank. Each rank
+// writes and reads its own rows as a hyperslab, collectively if HDF5 is
+// built with MPI-IO. The prestress dataset can be stored in single
+// precision for off-line storage, and it is converted back to double
+// precision when it is read. The former files with one file per rank are
+// still read if <ps_fName>.h5 does not exist.
+//
 // Date: Oct. 10 2017
 // Author: Ju Liu
 // ============================================================================
@@ -17,15 +29,17 @@ class Tissue_prestress
   public:
     Tissue_prestress( const ALocal_Elem * const &locelem, const int &in_nqp_tet,
        const int &in_cpu_rank, const bool &load_from_file,
-       const std::string &in_ps_fName = "prestress" );
+       const std::string &in_ps_fName = "prestress",
+       const bool &in_is_single_precision = false );
 
     virtual ~Tissue_prestress() = default;
 
     // ------------------------------------------------------------------------
     // Input: ee the element index
-    // Output: the vector holding 6 components of the prestress at all quad pts
+    // Output: the pointer to the 6 components of the prestress at all quad
+    //         pts, with length 6 x nqp, or nullptr for a fluid element
     // ------------------------------------------------------------------------
-    virtual std::vector<double> get_prestress( const int &ee ) const;
+    virtual const double * get_prestress( const int &ee ) const;
 
     virtual std::array<double,6> get_prestress( const int &ee, const int &qua ) const;
 
@@ -48,7 +62,12 @@ class Tissue_prestress
         const double * const &in_esval );
 
     // ------------------------------------------------------------------------
-    // record the prestress values to a h5 file as a row data
+    // The max absolute value of the local prestress components
+    // ------------------------------------------------------------------------
+    virtual double get_norm_inf() const;
+
+    // ------------------------------------------------------------------------
+    // record the prestress values to the h5 file. This is collective.
     // ------------------------------------------------------------------------
     virtual void write_prestress_hdf5() const;
 
@@ -59,27 +78,45 @@ class Tissue_prestress
     // The rank or id of the subdomain
     // ------------------------------------------------------------------------
     const int cpu_rank;
-    
+
     // ------------------------------------------------------------------------
-    // The number of local element and the number of volumetric quadrature
-    // points
+    // The number of local element, the number of volumetric quadrature
+    // points, and the number of local solid elements
     // ------------------------------------------------------------------------
     const int nlocalele, nqp;
 
+    int nlocalele_s;
+
     // ------------------------------------------------------------------------
-    // The file name for storing the prestress values.
+    // The file base name for storing the prestress values.
     // ------------------------------------------------------------------------
     const std::string ps_fileBaseName;
 
     // ------------------------------------------------------------------------
-    // qua_prestress[ee][6*ii+jj] stores the ee-th element's pre-stress 
-    // jj-th component in Voigt notation at the ii-th quadrature point.
-    // 0 <= ee < nlocalele, 0 <= ii < nqp, 0 <= jj < 6 if the element is a solid
-    // element; otherwise, qua_prestress[ee] is cleared for a fluid element.
-    // 
-    // Size is nlocalele x (nqp x 6)
+    // If true, the prestress is written in single precision.
+    // ------------------------------------------------------------------------
+    const bool is_single_precision;
+
+    // ------------------------------------------------------------------------
+    // solid_index[ee] is the index of the ee-th element among the local solid
+    // elements, or -1 for a fluid element. Size is nlocalele.
+    // ------------------------------------------------------------------------
+    std::vector<int> solid_index;
+
+    // ------------------------------------------------------------------------
+    // qua_prestress[ 6*nqp*solid_index[ee] + 6*ii + jj ] stores the ee-th
+    // element's pre-stress jj-th component in Voigt notation at the ii-th
+    // quadrature point, 0 <= ii < nqp, 0 <= jj < 6.
+    //
+    // Size is nlocalele_s x nqp x 6
+    // ------------------------------------------------------------------------
+    std::vector<double> qua_prestress;
+
+    // ------------------------------------------------------------------------
+    // Read qua_prestress from <ps_fileBaseName>.h5, or from the file of this
+    // rank in the former format.
     // ------------------------------------------------------------------------
-    std::vector< std::vector<double> > qua_prestress;
+    void read_prestress_hdf5();
 };
 
 #endif
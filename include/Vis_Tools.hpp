@@ -192,6 +192,7 @@ namespace VIS_T
   // ================================================================
   // The 3rd set of tools contain
   //    --- read_epart     ===> Read epart.h5
+  //    --- get_sol_name   ===> Name of the solution file to be read
   // ================================================================
   // --------------------------------------------------------------
   // ! read_epart: read the element partition file, usually named as
@@ -205,6 +206,16 @@ namespace VIS_T
   //                    usage.
   // --------------------------------------------------------------
   std::vector<int> read_epart( const std::string &epart_file, const int &esize );
+
+  // --------------------------------------------------------------
+  // ! get_sol_name: the name of the solution file of the time index
+  //   time, i.e., sol_bname + (900000000 + time) + sol_suffix. With an
+  //   empty sol_suffix, the HDF5 snapshot of the same name with the
+  //   suffix .h5 is returned if the PETSc binary file does not exist,
+  //   e.g. if only the snapshots are kept after the run.
+  // --------------------------------------------------------------
+  std::string get_sol_name( const std::string &sol_bname, const int &time,
+      const std::string &sol_suffix = "" );
 }
 
 #endif
@@ -6,6 +6,13 @@
 // Interface for Carreau non-Newtonian model
 // Ref. Cho and Kensey, Biorheology, 28:241-262, 1991
 //
+// Optionally, the term pow_base^((n_pli-1)/2) with pow_base >= 1 is evaluated
+// from a table instead of std::pow. With pow_base = m x 2^e, m in [0.5, 1),
+// the factor 2^(e(n_pli-1)/2) is tabulated for each exponent e and m^((n_pli
+// -1)/2) is a piecewise cubic Hermite interpolant on a uniform grid of m. The
+// relative error is of the order 1e-12 for shear-thinning indices 0 < n_pli
+// < 1, and std::pow is used for pow_base >= 2^63.
+//
 // Auther: Xinhai Yue
 // Email: seavegetableyxh@outlook.com
 // ============================================================================
@@ -15,8 +22,13 @@ class ViscosityModel_Carreau final : public IViscosityModel
 {
   public:
     ViscosityModel_Carreau( const double &in_mu_inf, const double &in_mu_0,
-        const double &in_lambda, const double &in_n_pli ) : mu_inf( in_mu_inf ),
-    mu_0( in_mu_0 ), lambda( in_lambda ), n_pli( in_n_pli ) {};
+        const double &in_lambda, const double &in_n_pli,
+        const bool &in_is_tabulated = false ) : mu_inf( in_mu_inf ),
+    mu_0( in_mu_0 ), lambda( in_lambda ), n_pli( in_n_pli ),
+    is_tabulated( in_is_tabulated )
+    {
+      if( is_tabulated ) build_table();
+    }
 
     ~ViscosityModel_Carreau() override = default;
 
@@ -27,6 +39,8 @@ class ViscosityModel_Carreau final : public IViscosityModel
       SYS_T::commPrint("\t  Zero Shear Viscosity     mu_0    = %e \n", mu_0);
       SYS_T::commPrint("\t  Time Constant            lambda  = %e \n", lambda);
       SYS_T::commPrint("\t  Power Law Index          n_pli   = %e \n", n_pli);
+      if( is_tabulated )
+        SYS_T::commPrint("\t  The power term is tabulated with %d cubic intervals. \n", num_interval);
     }
 
     std::string get_model_name() const override {return "Carreau";}
@@ -53,6 +67,24 @@ class ViscosityModel_Carreau final : public IViscosityModel
     double get_dmu_dI3( const SymmTensor2_3D &strain_rate ) const override
     {return 0.0;}
 
+    // mu and dmu_dI2 share one power term, taken from the table if requested
+    void eval_mu_batch( const int &num, const SymmTensor2_3D * const &strain_rate,
+        double * const &mu, double * const &dmu_dI2 ) const override
+    {
+      const double lambda2 = lambda * lambda;
+      const double dmu = mu_0 - mu_inf;
+
+      for(int ii=0; ii<num; ++ii)
+      {
+        const double pow_base = 1.0 + lambda2 * 2.0 * strain_rate[ii].MatContraction();
+        const double pow_val = is_tabulated ? get_pow_table( pow_base )
+          : std::pow( pow_base, (n_pli - 1.0) * 0.5 );
+
+        mu[ii] = mu_inf + dmu * pow_val;
+        dmu_dI2[ii] = dmu * ( n_pli - 1.0 ) * lambda2 * pow_val / pow_base;
+      }
+    }
+
   private:
     // ----------------------------------------------------------------------------
     // mu_inf : viscosity as shear rate tends to infinity
@@ -62,6 +94,57 @@ class ViscosityModel_Carreau final : public IViscosityModel
     //          shear rate
     // ----------------------------------------------------------------------------
     const double mu_inf, mu_0, lambda, n_pli;
+
+    // ----------------------------------------------------------------------------
+    // Table of pow_base^((n_pli-1)/2). The interval ii of the mantissa has the
+    // coefficients mant_coef[4*ii+jj] of s^jj, with s in [0, 1) the local
+    // coordinate; exp_val[e] = 2^(e(n_pli-1)/2) for the exponent 1 <= e < num_exp.
+    // ----------------------------------------------------------------------------
+    const bool is_tabulated;
+
+    static constexpr int num_interval = 256;
+
+    static constexpr int num_exp = 64;
+
+    std::vector<double> mant_coef {}, exp_val {};
+
+    void build_table()
+    {
+      const double aa = (n_pli - 1.0) * 0.5;
+      const double hh = 0.5 / num_interval;
+
+      mant_coef.resize( 4 * num_interval );
+      for(int ii=0; ii<num_interval; ++ii)
+      {
+        const double m0 = 0.5 + ii * hh, m1 = m0 + hh;
+        const double f0 = std::pow( m0, aa ), f1 = std::pow( m1, aa );
+        const double d0 = hh * aa * f0 / m0, d1 = hh * aa * f1 / m1;
+
+        mant_coef[4*ii]   = f0;
+        mant_coef[4*ii+1] = d0;
+        mant_coef[4*ii+2] = 3.0 * ( f1 - f0 ) - 2.0 * d0 - d1;
+        mant_coef[4*ii+3] = 2.0 * ( f0 - f1 ) + d0 + d1;
+      }
+
+      exp_val.resize( num_exp );
+      for(int ee=0; ee<num_exp; ++ee) exp_val[ee] = std::pow( 2.0, aa * ee );
+    }
+
+    // pow_base^((n_pli-1)/2) for pow_base >= 1
+    double get_pow_table( const double &pow_base ) const
+    {
+      int ee;
+      const double mant = std::frexp( pow_base, &ee );
+
+      if( ee >= num_exp ) return std::pow( pow_base, (n_pli - 1.0) * 0.5 );
+
+      const double tt = ( mant - 0.5 ) * ( 2.0 * num_interval );
+      const int ii = static_cast<int>( tt );
+      const double ss = tt - ii;
+      const double * const cc = &mant_coef[4*ii];
+
+      return exp_val[ee] * ( cc[0] + ss * ( cc[1] + ss * ( cc[2] + ss * cc[3] ) ) );
+    }
     
     ViscosityModel_Carreau() = delete;
 };
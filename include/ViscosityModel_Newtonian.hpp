@@ -35,6 +35,16 @@ class ViscosityModel_Newtonian final : public IViscosityModel
     double get_dmu_dI3( const SymmTensor2_3D &strain_rate ) const override
     {return 0.0;}
 
+    void eval_mu_batch( const int &num, const SymmTensor2_3D * const &strain_rate,
+        double * const &out_mu, double * const &dmu_dI2 ) const override
+    {
+      for(int ii=0; ii<num; ++ii)
+      {
+        out_mu[ii]  = mu;
+        dmu_dI2[ii] = 0.0;
+      }
+    }
+
   private:
     // ------------------------------------------------------------------------
     // mu : viscosity
@@ -64,6 +64,28 @@ class ViscosityModel_Power_Law final : public IViscosityModel
       return 0.0;
     }
 
+    // mu and dmu_dI2 share one pow
+    void eval_mu_batch( const int &num, const SymmTensor2_3D * const &strain_rate,
+        double * const &mu, double * const &dmu_dI2 ) const override
+    {
+      for(int ii=0; ii<num; ++ii)
+      {
+        const double pow_base = 2.0 * strain_rate[ii].MatContraction();
+        const double temp_mu  = m_cons * std::pow( pow_base, (n_pli - 1.0)*0.5 );
+
+        if( temp_mu <= mu_min || temp_mu > mu_max )
+        {
+          mu[ii] = (temp_mu <= mu_min) ? mu_min : mu_max;
+          dmu_dI2[ii] = 0.0;
+        }
+        else
+        {
+          mu[ii] = temp_mu;
+          dmu_dI2[ii] = ( n_pli - 1.0 ) * temp_mu / pow_base;
+        }
+      }
+    }
+
   private:
     // ------------------------------------------------------------------------
     // m_cons : consistency ( Pa * s ^ n ) when n = 1, it is the same as viscosity
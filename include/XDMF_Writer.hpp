@@ -0,0 +1,153 @@
+#ifndef XDMF_WRITER_HPP
+#define XDMF_WRITER_HPP
+// ============================================================================
+// XDMF_Writer.hpp
+//
+// Time-series writer of the nodal visualization data in HDF5 files indexed
+// by an XDMF file, which can be opened by ParaView or VisIt.
+//
+// Each rank owns the file <bname>_p<rank>.h5. The mesh of the rank, i.e.,
+//   /geometry/xyz                : num_node x 3 nodal coordinates
+//   /geometry/ien                : ncell x nLocBas local node indices
+//   /geometry/Analysis_Partition : ncell analysis partition of the cells
+//   /geometry/PostProcess_ID     : ncell rank of the cells (size > 1)
+// is written once in the constructor. Each call of write_step appends the
+// group /step_<900000000 + time index> with the time and one num_node x
+// comp dataset per array. Rank 0 then indexes the step in <bname>.xmf,
+// a temporal collection of the spatial collections of the rank's grids, in
+// which all steps refer to the same geometry datasets. The index is written
+// completely for the first step of the writer, including the steps kept for
+// restart, and for a step written again. Otherwise the new step is appended
+// in front of the closing tags, so the cost of a step does not grow with
+// the number of steps.
+//
+// This writer requires the visualization sampling points to be the nodes
+// of the element, as is the case for the quadrature rules generated by
+// QuadPtsFactory::createVisQuadrature for Tet4/Tet10/Hex8/Hex27, and the
+// point arrays of IVisDataPrep to be the arrays visualized. The element
+// node ordering of PERIGEE coincides with that of VTK and XDMF. Surface
+// meshes of Tri3/Tri6/Quad4/Quad9 cells can be given by their arrays.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "ALocal_Elem.hpp"
+#include "ALocal_IEN.hpp"
+#include "FEANode.hpp"
+#include "IVisDataPrep.hpp"
+#include "FEType.hpp"
+#include "HDF5_Writer.hpp"
+
+class XDMF_Writer
+{
+  public:
+    // ------------------------------------------------------------------------
+    // ! Write the geometry of the rank into <in_bname>_p<rank>.h5.
+    //   \para in_nlocghonode: the number of local and ghost nodes;
+    //   \para epart_map: the analysis partition of all elements. If it is
+    //                    empty, the cells are tagged by the rank, which is
+    //                    the case for output written by the analysis code;
+    //   \para isRestart: if true, the steps in an existing file are kept and
+    //                    indexed, otherwise the file is replaced.
+    //   This is collective.
+    // ------------------------------------------------------------------------
+    XDMF_Writer( const std::string &in_bname,
+        const FEANode * const &fnode_ptr,
+        const ALocal_IEN * const &lien_ptr,
+        const ALocal_Elem * const &lelem_ptr,
+        const FEType &in_elemType,
+        const int &in_nlocghonode,
+        const std::vector<int> &epart_map,
+        const bool &isRestart = false );
+
+    // ------------------------------------------------------------------------
+    // ! Write a mesh given by the arrays of the rank: xyz of length 3 x
+    //   num_node, ien of length ncell x in_nlocbas in the node ordering of
+    //   VTK, and cell_tag of length ncell written as Analysis_Partition, or
+    //   empty for the rank. This is collective.
+    // ------------------------------------------------------------------------
+    XDMF_Writer( const std::string &in_bname,
+        const FEType &in_elemType, const int &in_nlocbas,
+        const std::vector<double> &xyz, const std::vector<int> &ien,
+        const std::vector<int> &cell_tag, const bool &isRestart = false );
+
+    ~XDMF_Writer();
+
+    // ------------------------------------------------------------------------
+    // ! Append the point arrays of the time step time_index at sol_time, and
+    //   update the XDMF index. pointArrays[ii] has length num_node x
+    //   vdata_ptr->get_arraySizes(ii). This is collective.
+    // ------------------------------------------------------------------------
+    void write_step( const int &time_index, const double &sol_time,
+        const IVisDataPrep * const &vdata_ptr,
+        const double * const * const &pointArrays );
+
+    // ------------------------------------------------------------------------
+    // ! Append the arrays named in_array_name with in_array_comp components,
+    //   for data not prepared by an IVisDataPrep. This is collective.
+    // ------------------------------------------------------------------------
+    void write_step( const int &time_index, const double &sol_time,
+        const std::vector<std::string> &in_array_name,
+        const std::vector<int> &in_array_comp,
+        const double * const * const &pointArrays );
+
+    void print_info() const;
+
+  private:
+    const std::string bname;
+
+    const FEType elemType;
+
+    const int nLocBas, num_node, ncell, rank, size;
+
+    hid_t file_id;
+
+    // the number of nodes and cells of every rank, only filled on rank 0
+    std::vector<int> rank_node, rank_cell;
+
+    // the names and times of the written steps, only filled on rank 0
+    std::vector<std::string> step_name;
+    std::vector<double> step_time;
+
+    // the names and numbers of components of the arrays of the last step
+    std::vector<std::string> array_name;
+    std::vector<int> array_comp;
+
+    // whether the index has been written by this object, only used on rank 0
+    bool is_xmf_written;
+
+    void Write_geometry( const std::vector<double> &xyz,
+        const std::vector<int> &ien, const std::vector<int> &cell_tag ) const;
+
+    // Geometry arrays of the local volume mesh
+    static std::vector<double> get_xyz( const FEANode * const &fnode_ptr,
+        const int &nnode );
+
+    static std::vector<int> get_ien( const ALocal_IEN * const &lien_ptr,
+        const ALocal_Elem * const &lelem_ptr );
+
+    static std::vector<int> get_cell_tag( const ALocal_Elem * const &lelem_ptr,
+        const std::vector<int> &epart_map );
+
+    // Collect the steps and the arrays kept in the file for restart
+    void Read_steps();
+
+    // Rewrite <bname>.xmf with all steps on rank 0
+    void Write_xdmf() const;
+
+    // Append the step tt to <bname>.xmf on rank 0. An index that does not
+    // end with the closing tags is rewritten by Write_xdmf.
+    void Append_xdmf( const int &tt ) const;
+
+    // Write the spatial collection of the step tt
+    void Write_grid( std::ostream &xmf, const int &tt ) const;
+
+    // The closing tags of the index
+    static std::string get_xmf_tail();
+
+    // The HDF5 file name of rank rr without the directory
+    std::string get_h5_name( const int &rr ) const;
+
+    static std::string get_step_name( const int &time_index );
+};
+
+#endif
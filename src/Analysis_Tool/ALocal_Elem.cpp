@@ -21,6 +21,8 @@ ALocal_Elem::ALocal_Elem(const std::string &fileBaseName, const int &cpu_rank)
   }
   else
     elem_tag.clear();
+
+  Group_elem_by_tag();
     
   H5Fclose( file_id );
 }
@@ -40,18 +42,41 @@ ALocal_Elem::ALocal_Elem(const HDF5_Reader * const &h5r)
   }
   else
     elem_tag.clear();
+
+  Group_elem_by_tag();
+}
+
+void ALocal_Elem::Group_elem_by_tag()
+{
+  tag_elem.clear(); tag_offset.clear();
+
+  if( !isTagged ) return;
+
+  int max_tag = 0;
+  for(int ee=0; ee<nlocalele; ++ee)
+  {
+    SYS_T::print_fatal_if( elem_tag[ee] < 0, "Error: ALocal_Elem the element tag should be nonnegative.\n");
+    max_tag = std::max( max_tag, elem_tag[ee] );
+  }
+
+  // Counting sort of the local elements by tag
+  tag_offset.assign( max_tag + 2, 0 );
+  for(int ee=0; ee<nlocalele; ++ee) tag_offset[ elem_tag[ee] + 1 ] += 1;
+
+  for(int tt=0; tt<=max_tag; ++tt) tag_offset[tt+1] += tag_offset[tt];
+
+  tag_elem.resize( nlocalele );
+  std::vector<int> pos( tag_offset.begin(), tag_offset.end() - 1 );
+  for(int ee=0; ee<nlocalele; ++ee) tag_elem[ pos[ elem_tag[ee] ]++ ] = ee;
 }
 
 int ALocal_Elem::get_nlocalele( const int &tag_val ) const
 {
   if( isTagged )
   {
-    int counter = 0;
-    for(int ee=0; ee<nlocalele; ++ee)
-    {
-      if( elem_tag[ee] == tag_val) counter += 1;
-    }
-    return counter;
+    if( tag_val < 0 || tag_val + 1 >= VEC_T::get_size( tag_offset ) ) return 0;
+
+    return tag_offset[tag_val + 1] - tag_offset[tag_val];
   }
   else
   {
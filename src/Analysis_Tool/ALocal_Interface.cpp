@@ -53,34 +53,44 @@ ALocal_Interface::ALocal_Interface( const std::string &fileBaseName, const int &
     std::string subgroup_name(groupbase);
     subgroup_name.append( std::to_string(ii) );
 
-    // total info
-    fixed_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_face_id" );
-
-    fixed_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_ien" );
-
-    fixed_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_tag" );
+    // local and halo elements of this part, which may be none
+    num_fixed_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_fixed_node" );
 
     num_tagged_fixed_ele[ii] = h5r -> read_intVector( subgroup_name.c_str(), "num_tagged_fixed_cell" );
 
-    fixed_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "fixed_pt_xyz" );
+    if( h5r -> read_intScalar( subgroup_name.c_str(), "num_fixed_cell" ) > 0 )
+    {
+      fixed_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_face_id" );
 
-    fixed_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_map" );
+      fixed_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_ien" );
 
-    fixed_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "fixed_LID" );
+      fixed_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_tag" );
 
-    rotated_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_face_id" );
+      fixed_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "fixed_pt_xyz" );
 
-    rotated_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_ien" );
+      fixed_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_map" );
+
+      fixed_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "fixed_LID" );
+    }
 
-    rotated_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_tag" );
+    num_rotated_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_rotated_node" );
 
     num_tagged_rotated_ele[ii] = h5r -> read_intVector( subgroup_name.c_str(), "num_tagged_rotated_cell" );
 
-    rotated_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "rotated_pt_xyz" );
+    if( h5r -> read_intScalar( subgroup_name.c_str(), "num_rotated_cell" ) > 0 )
+    {
+      rotated_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_face_id" );
+
+      rotated_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_ien" );
+
+      rotated_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_tag" );
 
-    rotated_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_map" );
+      rotated_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "rotated_pt_xyz" );
 
-    rotated_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "rotated_LID" );
+      rotated_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_map" );
+
+      rotated_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "rotated_LID" );
+    }
 
     std::string subsubgroupbase(subgroup_name);
     subsubgroupbase.append("/tag_");
@@ -181,34 +191,44 @@ ALocal_Interface::ALocal_Interface( const HDF5_Reader * const &h5r )
     std::string subgroup_name(groupbase);
     subgroup_name.append( std::to_string(ii) );
 
-    // total info
-    fixed_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_face_id" );
-
-    fixed_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_ien" );
-
-    fixed_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_tag" );
+    // local and halo elements of this part, which may be none
+    num_fixed_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_fixed_node" );
 
     num_tagged_fixed_ele[ii] = h5r -> read_intVector( subgroup_name.c_str(), "num_tagged_fixed_cell" );
 
-    fixed_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "fixed_pt_xyz" );
+    if( h5r -> read_intScalar( subgroup_name.c_str(), "num_fixed_cell" ) > 0 )
+    {
+      fixed_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_face_id" );
 
-    fixed_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_map" );
+      fixed_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_ien" );
 
-    fixed_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "fixed_LID" );
+      fixed_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_cell_tag" );
 
-    rotated_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_face_id" );
+      fixed_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "fixed_pt_xyz" );
 
-    rotated_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_ien" );
+      fixed_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_map" );
+
+      fixed_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "fixed_LID" );
+    }
 
-    rotated_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_tag" );
+    num_rotated_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_rotated_node" );
 
     num_tagged_rotated_ele[ii] = h5r -> read_intVector( subgroup_name.c_str(), "num_tagged_rotated_cell" );
 
-    rotated_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "rotated_pt_xyz" );
+    if( h5r -> read_intScalar( subgroup_name.c_str(), "num_rotated_cell" ) > 0 )
+    {
+      rotated_ele_face_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_face_id" );
+
+      rotated_lien[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_ien" );
+
+      rotated_ele_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_cell_tag" );
 
-    rotated_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_map" );
+      rotated_pt_xyz[ii] = h5r -> read_doubleVector( subgroup_name.c_str(), "rotated_pt_xyz" );
 
-    rotated_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "rotated_LID" );
+      rotated_node_id[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_map" );
+
+      rotated_LID[ii] = h5r -> read_intVector(  subgroup_name.c_str(), "rotated_LID" );
+    }
 
     std::string subsubgroupbase(subgroup_name);
     subsubgroupbase.append("/tag_");
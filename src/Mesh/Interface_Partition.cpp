@@ -22,6 +22,7 @@ Interface_Partition::Interface_Partition(const IPart * const &part,
 
   fixed_node_vol_part_tag.resize(num_pair);
   fixed_node_loc_pos.resize(num_pair);
+  fixed_itf_node.resize(num_pair);
   
   rotated_nlocalele.resize(num_pair);
   rotated_ele_in_this_part.resize(num_pair);
@@ -36,6 +37,7 @@ Interface_Partition::Interface_Partition(const IPart * const &part,
 
   rotated_node_vol_part_tag.resize(num_pair);
   rotated_node_loc_pos.resize(num_pair);
+  rotated_itf_node.resize(num_pair);
 
   const int dof = 4;
 
@@ -137,18 +139,73 @@ Interface_Partition::Interface_Partition(const IPart * const &part,
     VEC_T::sort_unique_resize(tag);
     int n_tag = VEC_T::get_size(tag);
 
+    num_tag[ii] = n_tag;
+
+    // The opposite points of a local element are searched in the elements
+    // with the same or the neighbouring tags. The tags are set by the
+    // initial axial or radial position, which the rotation does not change,
+    // so these elements are the halo for any rotor position.
+    int max_tag = n_tag - 1;
+    for(const int tt : fixed_interval_tag[ii]) max_tag = std::max(max_tag, tt);
+    for(const int tt : rotated_interval_tag[ii]) max_tag = std::max(max_tag, tt);
+
+    std::vector<bool> fixed_halo_tag(max_tag + 1, false), rotated_halo_tag(max_tag + 1, false);
+
+    for(const int ee : fixed_ele_in_this_part[ii])
+    {
+      const int tt = fixed_interval_tag[ii][ee];
+      for(int kk = std::max(tt - 1, 0); kk <= std::min(tt + 1, max_tag); ++kk)
+        rotated_halo_tag[kk] = true;
+    }
+
+    for(const int ee : rotated_ele_in_this_part[ii])
+    {
+      const int tt = rotated_interval_tag[ii][ee];
+      for(int kk = std::max(tt - 1, 0); kk <= std::min(tt + 1, max_tag); ++kk)
+        fixed_halo_tag[kk] = true;
+    }
+
+    std::vector<int> fixed_keep {}, rotated_keep {};
+    std::vector<bool> is_fixed_local(interfaces[ii].get_num_fixed_ele(), false);
+    std::vector<bool> is_rotated_local(interfaces[ii].get_num_rotated_ele(), false);
+
+    for(const int ee : fixed_ele_in_this_part[ii]) is_fixed_local[ee] = true;
+    for(const int ee : rotated_ele_in_this_part[ii]) is_rotated_local[ee] = true;
+
+    for(int ee=0; ee<interfaces[ii].get_num_fixed_ele(); ++ee)
+    {
+      if(is_fixed_local[ee] || fixed_halo_tag[fixed_interval_tag[ii][ee]])
+        fixed_keep.push_back(ee);
+    }
+
+    for(int ee=0; ee<interfaces[ii].get_num_rotated_ele(); ++ee)
+    {
+      if(is_rotated_local[ee] || rotated_halo_tag[rotated_interval_tag[ii][ee]])
+        rotated_keep.push_back(ee);
+    }
+
+    // Keep only the local and the halo elements in this part
+    const std::vector<int> fixed_old2new = Compact(fixed_keep, fixed_ele_face_id[ii],
+        fixed_lien[ii], fixed_interval_tag[ii], fixed_global_node[ii], fixed_LID[ii],
+        fixed_pt_xyz[ii], fixed_itf_node[ii]);
+
+    const std::vector<int> rotated_old2new = Compact(rotated_keep, rotated_ele_face_id[ii],
+        rotated_lien[ii], rotated_interval_tag[ii], rotated_global_node[ii], rotated_LID[ii],
+        rotated_pt_xyz[ii], rotated_itf_node[ii]);
+
+    for(auto &ee : fixed_ele_in_this_part[ii]) ee = fixed_old2new[ee];
+    for(auto &ee : rotated_ele_in_this_part[ii]) ee = rotated_old2new[ee];
+
     tagged_fixed_ele[ii].resize(n_tag);
     tagged_rotated_ele[ii].resize(n_tag);
 
     num_tagged_fixed_ele[ii].resize(n_tag);
     num_tagged_rotated_ele[ii].resize(n_tag);
 
-    num_tag[ii] = n_tag;
-
     for(int tt=0; tt<n_tag; ++tt)
     {
       tagged_fixed_ele[ii][tt] = std::vector<int> {};
-      for(int ee=0; ee<interfaces[ii].get_num_fixed_ele(); ++ee)
+      for(int ee=0; ee<VEC_T::get_size(fixed_interval_tag[ii]); ++ee)
       {
         if(fixed_interval_tag[ii][ee] == tt)
           tagged_fixed_ele[ii][tt].push_back(ee);
@@ -156,7 +213,7 @@ Interface_Partition::Interface_Partition(const IPart * const &part,
       num_tagged_fixed_ele[ii][tt] = VEC_T::get_size(tagged_fixed_ele[ii][tt]);
 
       tagged_rotated_ele[ii][tt] = std::vector<int> {};
-      for(int ee=0; ee<interfaces[ii].get_num_rotated_ele(); ++ee)
+      for(int ee=0; ee<VEC_T::get_size(rotated_interval_tag[ii]); ++ee)
       {
         if(rotated_interval_tag[ii][ee] == tt)
           tagged_rotated_ele[ii][tt].push_back(ee);
@@ -166,6 +223,68 @@ Interface_Partition::Interface_Partition(const IPart * const &part,
   }
 }
 
+std::vector<int> Interface_Partition::Compact( const std::vector<int> &keep,
+    std::vector<int> &face_id, std::vector<int> &lien, std::vector<int> &interval_tag,
+    std::vector<int> &global_node, std::vector<int> &LID, std::vector<double> &pt_xyz,
+    std::vector<int> &itf_node ) const
+{
+  const int num_ele = VEC_T::get_size(face_id);
+  const int num_node = VEC_T::get_size(global_node);
+  const int nLocBas = num_ele > 0 ? VEC_T::get_size(lien) / num_ele : 0;
+  const int dof = num_node > 0 ? VEC_T::get_size(LID) / num_node : 0;
+
+  // Renumber the kept elements and the nodes referenced by them
+  std::vector<int> ele_old2new(num_ele, -1), node_old2new(num_node, -1);
+  itf_node.clear();
+
+  for(int ee=0; ee<VEC_T::get_size(keep); ++ee)
+  {
+    ele_old2new[keep[ee]] = ee;
+    for(int nn=0; nn<nLocBas; ++nn)
+    {
+      const int node = lien[keep[ee] * nLocBas + nn];
+      if(node_old2new[node] < 0)
+      {
+        node_old2new[node] = 0;
+        itf_node.push_back(node);
+      }
+    }
+  }
+
+  VEC_T::sort_unique_resize(itf_node);
+
+  const int num_keep_node = VEC_T::get_size(itf_node);
+  for(int nn=0; nn<num_keep_node; ++nn) node_old2new[itf_node[nn]] = nn;
+
+  std::vector<int> new_face_id(keep.size()), new_tag(keep.size()), new_lien(keep.size() * nLocBas);
+  for(int ee=0; ee<VEC_T::get_size(keep); ++ee)
+  {
+    new_face_id[ee] = face_id[keep[ee]];
+    new_tag[ee] = interval_tag[keep[ee]];
+    for(int nn=0; nn<nLocBas; ++nn)
+      new_lien[ee * nLocBas + nn] = node_old2new[ lien[keep[ee] * nLocBas + nn] ];
+  }
+
+  std::vector<int> new_global_node(num_keep_node), new_LID(dof * num_keep_node);
+  std::vector<double> new_pt_xyz(3 * num_keep_node);
+  for(int nn=0; nn<num_keep_node; ++nn)
+  {
+    const int old_node = itf_node[nn];
+    new_global_node[nn] = global_node[old_node];
+
+    for(int kk=0; kk<dof; ++kk)
+      new_LID[kk * num_keep_node + nn] = LID[kk * num_node + old_node];
+
+    for(int dd=0; dd<3; ++dd)
+      new_pt_xyz[3 * nn + dd] = pt_xyz[3 * old_node + dd];
+  }
+
+  face_id = new_face_id; interval_tag = new_tag; lien = new_lien;
+  global_node = new_global_node; LID = new_LID; pt_xyz = new_pt_xyz;
+
+  return ele_old2new;
+}
+
 void Interface_Partition::write_hdf5(const std::string &FileName) const
 {
   const std::string fName = SYS_T::gen_partfile_name( FileName, cpu_rank );
@@ -193,8 +312,12 @@ void Interface_Partition::write_hdf5(const std::string &FileName) const
 
     hid_t group_id = H5Gcreate(g_id, subgroup_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
 
+    // The vectors are not written if they are empty, which happens in the
+    // parts away from the interface
     h5w -> write_intScalar( group_id, "num_fixed_node", VEC_T::get_size(fixed_global_node[ii]) );
 
+    h5w -> write_intScalar( group_id, "num_fixed_cell", VEC_T::get_size(fixed_ele_face_id[ii]) );
+
     h5w -> write_intVector( group_id, "fixed_cell_face_id", fixed_ele_face_id[ii] );
 
     h5w -> write_intVector( group_id, "fixed_cell_ien", fixed_lien[ii] );
@@ -213,6 +336,8 @@ void Interface_Partition::write_hdf5(const std::string &FileName) const
 
     h5w -> write_intScalar( group_id, "num_rotated_node", VEC_T::get_size(rotated_global_node[ii]) );
 
+    h5w -> write_intScalar( group_id, "num_rotated_cell", VEC_T::get_size(rotated_ele_face_id[ii]) );
+
     h5w -> write_intVector( group_id, "rotated_cell_face_id", rotated_ele_face_id[ii] );
 
     h5w -> write_intVector( group_id, "rotated_cell_ien", rotated_lien[ii] );
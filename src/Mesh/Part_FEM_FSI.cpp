@@ -22,6 +22,28 @@ Part_FEM_FSI::Part_FEM_FSI( const int &in_nelem,
   elem_phy_tag.resize( nlocalele );
   for(int ii=0; ii<nlocalele; ++ii) elem_phy_tag[ii] = phytag[ elem_loc[ii] ];
 
+  // Reorder the local elements by their tag, so that the elements of each
+  // tag occupy a contiguous range of the local element indices. The sort
+  // is stable, so the elements of one tag keep their relative order.
+  std::vector<int> order( nlocalele, 0 );
+  for(int ii=0; ii<nlocalele; ++ii) order[ii] = ii;
+
+  std::stable_sort( order.begin(), order.end(), [this](const int &a, const int &b)
+      { return elem_phy_tag[a] < elem_phy_tag[b]; } );
+
+  std::vector<int> sorted_elem_loc( nlocalele, 0 ), sorted_phy_tag( nlocalele, 0 );
+  std::vector<int *> sorted_LIEN( nlocalele, nullptr );
+  for(int ii=0; ii<nlocalele; ++ii)
+  {
+    sorted_elem_loc[ii] = elem_loc[ order[ii] ];
+    sorted_phy_tag[ii]  = elem_phy_tag[ order[ii] ];
+    sorted_LIEN[ii]     = LIEN[ order[ii] ];
+  }
+
+  elem_loc = sorted_elem_loc;
+  elem_phy_tag = sorted_phy_tag;
+  for(int ii=0; ii<nlocalele; ++ii) LIEN[ii] = sorted_LIEN[ii];
+
   // Generate the node_loc_fluid/solid
   node_loc_fluid.clear();
   node_loc_solid.clear();
@@ -3,7 +3,7 @@
 namespace SI_T
 {
   SI_solution::SI_solution(const std::string &fileBaseName, const int &in_cpu_rank)
-    : cpu_rank( in_cpu_rank )
+    : cpu_rank( in_cpu_rank ), node_sf( nullptr ), mdisp_sf( nullptr )
   {
     const std::string fName = SYS_T::gen_partfile_name( fileBaseName, cpu_rank );
 
@@ -16,16 +16,17 @@ namespace SI_T
     const int num_itf = h5r -> read_intScalar( gname.c_str(), "num_interface" );
 
     num_fixed_node.assign(num_itf, 0);
-    fixed_node_sol.resize(num_itf);
     fixed_node_part_tag.resize(num_itf);
     fixed_node_loc_pos.resize(num_itf);
+    fixed_node_slot.resize(num_itf);
 
     num_rotated_node.assign(num_itf, 0);
-    rotated_node_sol.resize(num_itf);
-    rotated_node_mvelo.resize(num_itf);
     rotated_node_mdisp.resize(num_itf);
     rotated_node_part_tag.resize(num_itf);
     rotated_node_loc_pos.resize(num_itf);
+    rotated_node_slot.resize(num_itf);
+
+    nlocghonode = h5r -> read_intScalar("Local_Node", "nlocghonode");
 
     const std::string mesh_info("/Global_Mesh_Info");
     nLocBas = h5r -> read_intScalar(mesh_info.c_str(), "nLocBas");
@@ -39,135 +40,165 @@ namespace SI_T
       std::string subgroup_name(groupbase);
       subgroup_name.append( std::to_string(ii) );
       
-      num_fixed_node[ii] = VEC_T::get_size(h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_map" ));
-
-      fixed_node_sol[ii] = std::vector<double> (dof_sol * num_fixed_node[ii], 0.0);
+      num_fixed_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_fixed_node" );
 
-      fixed_node_part_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_part_tag" );
+      fixed_node_slot[ii] = std::vector<int> (num_fixed_node[ii], -1);
 
-      fixed_node_loc_pos[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_loc_pos" );
+      if(num_fixed_node[ii] > 0)
+      {
+        fixed_node_part_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_part_tag" );
 
-      num_rotated_node[ii] = VEC_T::get_size(h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_map" ));
+        fixed_node_loc_pos[ii] = h5r -> read_intVector( subgroup_name.c_str(), "fixed_node_loc_pos" );
+      }
 
-      rotated_node_sol[ii] = std::vector<double> (dof_sol * num_rotated_node[ii], 0.0);
+      num_rotated_node[ii] = h5r -> read_intScalar( subgroup_name.c_str(), "num_rotated_node" );
 
-      rotated_node_mvelo[ii] = std::vector<double> (3 * num_rotated_node[ii], 0.0);
+      rotated_node_slot[ii] = std::vector<int> (num_rotated_node[ii], -1);
 
       rotated_node_mdisp[ii] = std::vector<double> (3 * num_rotated_node[ii], 0.0); 
 
-      rotated_node_part_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_part_tag" );
+      if(num_rotated_node[ii] > 0)
+      {
+        rotated_node_part_tag[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_part_tag" );
 
-      rotated_node_loc_pos[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_loc_pos" );
+        rotated_node_loc_pos[ii] = h5r -> read_intVector( subgroup_name.c_str(), "rotated_node_loc_pos" );
+      }
     }
 
     delete h5r; H5Fclose( file_id );
+
+    // The rotated nodes stored in this part do not change, so the plan of
+    // the mesh displacement is set once
+    std::vector<PetscSFNode> remote {};
+
+    for(int ii=0; ii<num_itf; ++ii)
+    {
+      for(int nn=0; nn<num_rotated_node[ii]; ++nn)
+      {
+        PetscSFNode owner;
+        owner.rank  = rotated_node_part_tag[ii][nn];
+        owner.index = rotated_node_loc_pos[ii][nn];
+        remote.push_back(owner);
+      }
+    }
+
+    PetscSFCreate(PETSC_COMM_WORLD, &mdisp_sf);
+    PetscSFSetGraph(mdisp_sf, nlocghonode, VEC_T::get_size(remote), NULL, PETSC_COPY_VALUES,
+        remote.data(), PETSC_COPY_VALUES);
+    PetscSFSetUp(mdisp_sf);
   }
 
-  void SI_solution::update_node_sol(const PDNSolution * const &sol)
+  SI_solution::~SI_solution()
+  {
+    if(node_sf != nullptr) PetscSFDestroy(&node_sf);
+    if(mdisp_sf != nullptr) PetscSFDestroy(&mdisp_sf);
+  }
+
+  void SI_solution::set_comm_plan(const std::vector<std::vector<int>> &fixed_node,
+    const std::vector<std::vector<int>> &rotated_node)
   {
-    const int nlgn = sol->get_nlgn();
-    double * array = new double [nlgn];
+    const int num_itf = VEC_T::get_size(num_fixed_node);
 
-    sol->GetLocalArray( array );
+    SYS_T::print_fatal_if( VEC_T::get_size(fixed_node) != num_itf || VEC_T::get_size(rotated_node) != num_itf,
+      "Error, SI_solution::set_comm_plan: the node lists do not match the interfaces.\n" );
 
-    zero_node_sol();
+    // The owner and its local position of each needed node
+    std::vector<PetscSFNode> remote {};
+    int num_leaf = 0;
 
-    for(int ii = 0; ii < VEC_T::get_size(num_fixed_node); ++ii)
-    { 
-      std::vector<double> temp_fixed_node_sol = fixed_node_sol[ii];
-      for(int nn = 0; nn < num_fixed_node[ii]; ++nn)
+    for(int ii = 0; ii < num_itf; ++ii)
+    {
+      std::fill(fixed_node_slot[ii].begin(), fixed_node_slot[ii].end(), -1);
+      for(const int nn : fixed_node[ii])
       {
-        // Pick out the solution of nodes in each part
-        if(fixed_node_part_tag[ii][nn] == cpu_rank)
-        {  
-          // Like GetLocal in PGAssem
-          const int loc_pos = fixed_node_loc_pos[ii][nn];
-          for(int dd = 0; dd < dof_sol; ++dd)
-            temp_fixed_node_sol[dof_sol * nn + dd] = array[dof_sol * loc_pos + dd];
-        }
+        if(fixed_node_slot[ii][nn] >= 0) continue;
+
+        fixed_node_slot[ii][nn] = num_leaf++;
+
+        PetscSFNode owner;
+        owner.rank  = fixed_node_part_tag[ii][nn];
+        owner.index = fixed_node_loc_pos[ii][nn];
+        remote.push_back(owner);
       }
 
-      std::vector<double> temp_rotated_node_sol = rotated_node_sol[ii];
-      for(int nn = 0; nn < num_rotated_node[ii]; ++nn)
+      std::fill(rotated_node_slot[ii].begin(), rotated_node_slot[ii].end(), -1);
+      for(const int nn : rotated_node[ii])
       {
-        // Pick out the solution of nodes in each part
-        if(rotated_node_part_tag[ii][nn] == cpu_rank)
-        { 
-          // Like GetLocal in PGAssem
-          const int loc_pos = rotated_node_loc_pos[ii][nn];
-          for(int dd = 0; dd < dof_sol; ++dd)
-            temp_rotated_node_sol[dof_sol * nn + dd] = array[dof_sol * loc_pos + dd];
-        }
-      }
+        if(rotated_node_slot[ii][nn] >= 0) continue;
+
+        rotated_node_slot[ii][nn] = num_leaf++;
 
-      // Summation from each part
-      MPI_Allreduce(&temp_fixed_node_sol[0], &fixed_node_sol[ii][0], dof_sol * num_fixed_node[ii], MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
-      MPI_Allreduce(&temp_rotated_node_sol[0], &rotated_node_sol[ii][0], dof_sol * num_rotated_node[ii], MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
+        PetscSFNode owner;
+        owner.rank  = rotated_node_part_tag[ii][nn];
+        owner.index = rotated_node_loc_pos[ii][nn];
+        remote.push_back(owner);
+      }
     }
 
-    delete [] array; array = nullptr;
+    if(node_sf != nullptr) PetscSFDestroy(&node_sf);
+
+    PetscSFCreate(PETSC_COMM_WORLD, &node_sf);
+    PetscSFSetGraph(node_sf, nlocghonode, num_leaf, NULL, PETSC_COPY_VALUES,
+        remote.data(), PETSC_COPY_VALUES);
+    PetscSFSetUp(node_sf);
+
+    leaf_sol.assign(dof_sol * num_leaf, 0.0);
+    leaf_mvelo.assign(3 * num_leaf, 0.0);
   }
 
-  void SI_solution::update_node_mvelo(const PDNSolution * const &mvelo)
+  void SI_solution::bcast_node_value(const PetscSF &sf, const PDNSolution * const &vec,
+    const int &dof, std::vector<double> &leaf) const
   {
-    const int nlgn = mvelo->get_nlgn();    
-    double * array = new double [nlgn];
+    SYS_T::print_fatal_if( sf == nullptr,
+      "Error, SI_solution: the communication plan is not set.\n" );
 
-    mvelo->GetLocalArray( array );
+    std::vector<double> array( vec->get_nlgn(), 0.0 );
 
-    Zero_node_mvelo();
+    vec->GetLocalArray( &array[0] );
 
-    for(int ii = 0; ii < VEC_T::get_size(num_fixed_node); ++ii)
-    { 
-      std::vector<double> temp_rotated_node_mvelo = rotated_node_mvelo[ii];
-      for(int nn = 0; nn < num_rotated_node[ii]; ++nn)
-      {
-        // Pick out the solution of nodes in each part
-        if(rotated_node_part_tag[ii][nn] == cpu_rank)
-        { 
-          // Like GetLocal in PGAssem
-          const int loc_pos = rotated_node_loc_pos[ii][nn];
-          for(int dd = 0; dd < 3; ++dd)
-            temp_rotated_node_mvelo[3 * nn + dd] = array[3 * loc_pos + dd];
-        }
-      }
+    // One unit holds the dof values of a node
+    MPI_Datatype node_unit;
+    MPI_Type_contiguous(dof, MPI_DOUBLE, &node_unit);
+    MPI_Type_commit(&node_unit);
 
-      // Summation from each part
-      MPI_Allreduce(&temp_rotated_node_mvelo[0], &rotated_node_mvelo[ii][0], 3 * num_rotated_node[ii], MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
-    }
+#if PETSC_VERSION_LT(3,15,0)
+    PetscSFBcastBegin(sf, node_unit, array.data(), leaf.data());
+    PetscSFBcastEnd(sf, node_unit, array.data(), leaf.data());
+#else
+    PetscSFBcastBegin(sf, node_unit, array.data(), leaf.data(), MPI_REPLACE);
+    PetscSFBcastEnd(sf, node_unit, array.data(), leaf.data(), MPI_REPLACE);
+#endif
 
-    delete [] array; array = nullptr;
+    MPI_Type_free(&node_unit);
   }
 
-  void SI_solution::update_node_mdisp(const PDNSolution * const &mdisp)
+  void SI_solution::update_node_sol(const PDNSolution * const &sol)
   {
-    const int nlgn = mdisp->get_nlgn();    
-    double * array = new double [nlgn];
+    bcast_node_value(node_sf, sol, dof_sol, leaf_sol);
+  }
 
-    mdisp->GetLocalArray( array );
+  void SI_solution::update_node_mvelo(const PDNSolution * const &mvelo)
+  {
+    bcast_node_value(node_sf, mvelo, 3, leaf_mvelo);
+  }
 
-    Zero_node_disp();
+  void SI_solution::update_node_mdisp(const PDNSolution * const &mdisp)
+  {
+    int num_leaf = 0;
+    for(int ii = 0; ii < VEC_T::get_size(num_rotated_node); ++ii)
+      num_leaf += num_rotated_node[ii];
 
-    for(int ii = 0; ii < VEC_T::get_size(num_fixed_node); ++ii)
-    { 
-      std::vector<double> temp_rotated_node_mdisp = rotated_node_mdisp[ii];
-      for(int nn = 0; nn < num_rotated_node[ii]; ++nn)
-      {
-        // Pick out the solution of nodes in each part
-        if(rotated_node_part_tag[ii][nn] == cpu_rank)
-        { 
-          // Like GetLocal in PGAssem
-          const int loc_pos = rotated_node_loc_pos[ii][nn];
-          for(int dd = 0; dd < 3; ++dd)
-            temp_rotated_node_mdisp[3 * nn + dd] = array[3 * loc_pos + dd];
-        }
-      }
+    std::vector<double> leaf_mdisp(3 * num_leaf, 0.0);
 
-      // Summation from each part
-      MPI_Allreduce(&temp_rotated_node_mdisp[0], &rotated_node_mdisp[ii][0], 3 * num_rotated_node[ii], MPI_DOUBLE, MPI_SUM, PETSC_COMM_WORLD);
-    }
+    bcast_node_value(mdisp_sf, mdisp, 3, leaf_mdisp);
 
-    delete [] array; array = nullptr; 
+    int offset = 0;
+    for(int ii = 0; ii < VEC_T::get_size(num_rotated_node); ++ii)
+    {
+      std::copy(leaf_mdisp.begin() + 3 * offset,
+          leaf_mdisp.begin() + 3 * (offset + num_rotated_node[ii]), rotated_node_mdisp[ii].begin());
+      offset += num_rotated_node[ii];
+    }
   }
 
   SI_quad_point::SI_quad_point(const ALocal_Interface * const &itf,
@@ -187,6 +218,9 @@ namespace SI_T
     rotated_qp_curr_fixed_xi.resize(itf->get_num_itf());
     rotated_qp_curr_fixed_eta.resize(itf->get_num_itf());
 
+    fixed_tree.resize(itf->get_num_itf());
+    rotated_tree.resize(itf->get_num_itf());
+
     for(int ii = 0; ii < itf->get_num_itf(); ++ii)
     {
       fixed_qp_curr_rotated_ee[ii].assign(itf->get_num_fixed_ele(ii) * nqp_sur, -1);
@@ -242,6 +276,8 @@ namespace SI_T
 
     const int num_itf {itf_part->get_num_itf()};
 
+    update_face_tree(itf_part, SI_sol);
+
     for(int itf_id{0}; itf_id<num_itf; ++itf_id)
     {
       SYS_T::commPrint("itf_id = %d\n", itf_id);
@@ -275,7 +311,10 @@ namespace SI_T
           // SYS_T::commPrint("    point %d:\n", qua);
 
           int ele_tag {itf_part->get_fixed_ele_tag(itf_id, ee)};
-          int rotated_ee {0};
+          // Warm start from the previous match
+          int rotated_ee {-1};
+          double xi {0.0}, eta {0.0};
+          get_curr_rotated(itf_id, ee_index, qua, rotated_ee, xi, eta);
           search_opposite_rotated_point(coor, itf_part, SI_sol, itf_id, ele_tag, rotated_ee);
 
           set_curr_rotated(itf_id, ee_index, qua, rotated_ee, free_quad->get_qp(0, 0), free_quad->get_qp(0, 1));
@@ -319,7 +358,10 @@ namespace SI_T
           // SYS_T::commPrint("    point %d:\n", qua);
 
           int ele_tag {itf_part->get_rotated_ele_tag(itf_id, ee)};
-          int fixed_ee {0};
+          // Warm start from the previous match
+          int fixed_ee {-1};
+          double xi {0.0}, eta {0.0};
+          get_curr_fixed(itf_id, ee_index, qua, fixed_ee, xi, eta);
           search_opposite_fixed_point(coor, itf_part, SI_sol, itf_id, ele_tag, fixed_ee);
 
           set_curr_fixed(itf_id, ee_index, qua, fixed_ee, free_quad->get_qp(0, 0), free_quad->get_qp(0, 1));
@@ -339,6 +381,59 @@ namespace SI_T
     delete [] ctrl_z; ctrl_z = nullptr;
   }
   
+  void SI_quad_point::set_comm_plan( const ALocal_Interface * const &itf_part,
+    SI_solution * const &SI_sol ) const
+  {
+    const int num_itf {itf_part->get_num_itf()};
+    const int nLocBas {itf_part->get_nLocBas()};
+
+    std::vector<std::vector<int>> fixed_node(num_itf), rotated_node(num_itf);
+
+    for(int itf_id{0}; itf_id<num_itf; ++itf_id)
+    {
+      auto add_fixed = [&](const int &ee)
+      {
+        for(int nn{0}; nn<nLocBas; ++nn)
+          fixed_node[itf_id].push_back( itf_part->get_fixed_lien(itf_id, ee * nLocBas + nn) );
+      };
+
+      auto add_rotated = [&](const int &ee)
+      {
+        for(int nn{0}; nn<nLocBas; ++nn)
+          rotated_node[itf_id].push_back( itf_part->get_rotated_lien(itf_id, ee * nLocBas + nn) );
+      };
+
+      // The local fixed elements and the rotated elements opposite to them
+      for(int ee_index{0}; ee_index<itf_part->get_num_fixed_ele(itf_id); ++ee_index)
+      {
+        add_fixed( itf_part->get_fixed_ele(itf_id, ee_index) );
+
+        for(int qua{0}; qua<nqp_sur; ++qua)
+        {
+          const int opposite_ee = fixed_qp_curr_rotated_ee[itf_id][ee_index * nqp_sur + qua];
+          if(opposite_ee >= 0) add_rotated( opposite_ee );
+        }
+      }
+
+      // The local rotated elements and the fixed elements opposite to them
+      for(int ee_index{0}; ee_index<itf_part->get_num_rotated_ele(itf_id); ++ee_index)
+      {
+        add_rotated( itf_part->get_rotated_ele(itf_id, ee_index) );
+
+        for(int qua{0}; qua<nqp_sur; ++qua)
+        {
+          const int opposite_ee = rotated_qp_curr_fixed_ee[itf_id][ee_index * nqp_sur + qua];
+          if(opposite_ee >= 0) add_fixed( opposite_ee );
+        }
+      }
+
+      VEC_T::sort_unique_resize( fixed_node[itf_id] );
+      VEC_T::sort_unique_resize( rotated_node[itf_id] );
+    }
+
+    SI_sol->set_comm_plan(fixed_node, rotated_node);
+  }
+
   void SI_quad_point::search_opposite_rotated_point(
     const Vector_3 &fixed_pt,
     const ALocal_Interface * const &itf_part,
@@ -347,240 +442,406 @@ namespace SI_T
     int &tag,
     int &rotated_ee)
   {
-    const int nLocBas = itf_part->get_nLocBas();
-    bool is_found = false;
+    // Warm start from the previous match
+    const int prev_ee = rotated_ee;
+    if(prev_ee >= 0 && project_to_rotated_ele(fixed_pt, itf_part, SI_sol, itf_id, prev_ee))
+      return;
 
-    double * inictrl_x = new double [nLocBas];
-    double * inictrl_y = new double [nLocBas];
-    double * inictrl_z = new double [nLocBas];
-
-    double * volctrl_x = new double [nLocBas];
-    double * volctrl_y = new double [nLocBas];
-    double * volctrl_z = new double [nLocBas];
-
-    int * rotated_local_ien = new int [nLocBas];
-    double * rotated_local_disp = new double [nLocBas * 3];
-
-    int rotated_face_id = -1;
-    int rotated_tag = tag;
-    int num_rotated_ele = itf_part->get_num_tagged_rotated_ele(itf_id, rotated_tag);
-    // SYS_T::commPrint("    num_rotated_ele:%d\n", num_rotated_ele);
-
-    for(int ee_index{0}; ee_index<num_rotated_ele; ++ee_index)
+    // Candidates from the face tree
+    for(const int ee : rotated_tree[itf_id].query(fixed_pt))
     {
-      const int ee = itf_part->get_tagged_rotated_ele(itf_id, rotated_tag, ee_index);
-      itf_part->get_rotated_ele_ctrlPts(itf_id, ee, inictrl_x, inictrl_y, inictrl_z);
-      SI_sol->get_rotated_mdisp(itf_part, itf_id, ee, rotated_local_ien, rotated_local_disp);
-      SI_T::get_currPts(inictrl_x, inictrl_y, inictrl_z, rotated_local_disp, nLocBas, volctrl_x, volctrl_y, volctrl_z);
-      
-      rotated_face_id = itf_part->get_rotated_face_id(itf_id, ee);
-
-      const auto facectrl = opposite_elementv->get_face_ctrlPts(rotated_face_id,
-        volctrl_x, volctrl_y, volctrl_z);
-
-      free_quad->reset();
-      is_found = FE_T::search_closest_point(fixed_pt, elements.get(),
-        facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
-
-      if(is_found)
+      if(ee != prev_ee && project_to_rotated_ele(fixed_pt, itf_part, SI_sol, itf_id, ee))
       {
         rotated_ee = ee;
-        // SYS_T::commPrint("  found in rotated_ee = %d.\n\n", rotated_ee);
-        break;
+        return;
       }
     }
 
-    // Second try
-    if(is_found == false && tag != 0)
+    // Fall back on the elements with the same and the neighbouring tags
+    for(const int rotated_tag : {tag, tag - 1, tag + 1})
     {
-      rotated_tag = tag - 1;
+      if(rotated_tag < 0 || rotated_tag >= itf_part->get_num_tag(itf_id)) continue;
 
-      num_rotated_ele = itf_part->get_num_tagged_rotated_ele(itf_id, rotated_tag);
-      // SYS_T::commPrint("    num_rotated_ele:%d\n", num_rotated_ele);
+      const int num_rotated_ele = itf_part->get_num_tagged_rotated_ele(itf_id, rotated_tag);
 
       for(int ee_index{0}; ee_index<num_rotated_ele; ++ee_index)
       {
         const int ee = itf_part->get_tagged_rotated_ele(itf_id, rotated_tag, ee_index);
-        itf_part->get_rotated_ele_ctrlPts(itf_id, ee, inictrl_x, inictrl_y, inictrl_z);
-        SI_sol->get_rotated_mdisp(itf_part, itf_id, ee, rotated_local_ien, rotated_local_disp);
-        SI_T::get_currPts(inictrl_x, inictrl_y, inictrl_z, rotated_local_disp, nLocBas, volctrl_x, volctrl_y, volctrl_z);
-        
-        rotated_face_id = itf_part->get_rotated_face_id(itf_id, ee);
-
-        const auto facectrl = opposite_elementv->get_face_ctrlPts(rotated_face_id,
-          volctrl_x, volctrl_y, volctrl_z);
 
-        free_quad->reset();
-        is_found = FE_T::search_closest_point(fixed_pt, elements.get(),
-          facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
-
-        if(is_found)
+        if(project_to_rotated_ele(fixed_pt, itf_part, SI_sol, itf_id, ee))
         {
           rotated_ee = ee;
-          // SYS_T::commPrint("  found in rotated_ee = %d.\n\n", rotated_ee);
-          break;
+          return;
         }
       }
     }
 
-    // Third try
-    if(is_found == false && tag != itf_part->get_num_tag(itf_id) - 1)
-    {
-      rotated_tag = tag + 1;
+    SYS_T::print_fatal("Error, SI_quad_point::search_opposite_point: cannot find opposite rotated point.\n");
+  }
 
-      num_rotated_ele = itf_part->get_num_tagged_rotated_ele(itf_id, rotated_tag);
-      // SYS_T::commPrint("    num_rotated_ele:%d\n", num_rotated_ele);
+  void SI_quad_point::search_opposite_fixed_point(
+    const Vector_3 &rotated_pt,
+    const ALocal_Interface * const &itf_part,
+    const SI_solution * const &SI_sol,
+    const int &itf_id,
+    int &tag,
+    int &fixed_ee )
+  {
+    // Warm start from the previous match
+    const int prev_ee = fixed_ee;
+    if(prev_ee >= 0 && project_to_fixed_ele(rotated_pt, itf_part, itf_id, prev_ee))
+      return;
 
-      for(int ee_index{0}; ee_index<num_rotated_ele; ++ee_index)
+    // Candidates from the face tree
+    for(const int ee : fixed_tree[itf_id].query(rotated_pt))
+    {
+      if(ee != prev_ee && project_to_fixed_ele(rotated_pt, itf_part, itf_id, ee))
       {
-        const int ee = itf_part->get_tagged_rotated_ele(itf_id, rotated_tag, ee_index);
-        itf_part->get_rotated_ele_ctrlPts(itf_id, ee, inictrl_x, inictrl_y, inictrl_z);
-        SI_sol->get_rotated_mdisp(itf_part, itf_id, ee, rotated_local_ien, rotated_local_disp);
-        SI_T::get_currPts(inictrl_x, inictrl_y, inictrl_z, rotated_local_disp, nLocBas, volctrl_x, volctrl_y, volctrl_z);
-        
-        rotated_face_id = itf_part->get_rotated_face_id(itf_id, ee);
+        fixed_ee = ee;
+        return;
+      }
+    }
+
+    // Fall back on the elements with the same and the neighbouring tags
+    for(const int fixed_tag : {tag, tag - 1, tag + 1})
+    {
+      if(fixed_tag < 0 || fixed_tag >= itf_part->get_num_tag(itf_id)) continue;
 
-        const auto facectrl = opposite_elementv->get_face_ctrlPts(rotated_face_id,
-          volctrl_x, volctrl_y, volctrl_z);
+      const int num_fixed_ele = itf_part->get_num_tagged_fixed_ele(itf_id, fixed_tag);
 
-        free_quad->reset();
-        is_found = FE_T::search_closest_point(fixed_pt, elements.get(),
-          facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
+      for(int ee_index{0}; ee_index<num_fixed_ele; ++ee_index)
+      {
+        const int ee = itf_part->get_tagged_fixed_ele(itf_id, fixed_tag, ee_index);
 
-        if(is_found)
+        if(project_to_fixed_ele(rotated_pt, itf_part, itf_id, ee))
         {
-          rotated_ee = ee;
-          // SYS_T::commPrint("  found in rotated_ee = %d.\n\n", rotated_ee);
-          break;
+          fixed_ee = ee;
+          return;
         }
       }
     }
 
-    delete [] inictrl_x; inictrl_x = nullptr;
-    delete [] inictrl_y; inictrl_y = nullptr;
-    delete [] inictrl_z; inictrl_z = nullptr;
+    SYS_T::print_fatal("Error, SI_quad_point::search_opposite_point: cannot find opposite fixed point.\n");
+  }
+
+  bool SI_quad_point::project_to_fixed_ele(const Vector_3 &pt,
+    const ALocal_Interface * const &itf_part, const int &itf_id, const int &ee)
+  {
+    const int nLocBas = itf_part->get_nLocBas();
 
-    delete [] volctrl_x; volctrl_x = nullptr;
-    delete [] volctrl_y; volctrl_y = nullptr;
-    delete [] volctrl_z; volctrl_z = nullptr;
+    std::vector<double> volctrl_x(nLocBas), volctrl_y(nLocBas), volctrl_z(nLocBas);
 
-    delete [] rotated_local_ien; rotated_local_ien = nullptr;
-    delete [] rotated_local_disp; rotated_local_disp = nullptr;
+    itf_part->get_fixed_ele_ctrlPts(itf_id, ee, &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
 
-    SYS_T::print_fatal_if(is_found == false,
-      "Error, SI_quad_point::search_opposite_point: cannot find opposite rotated point.\n");
+    const auto facectrl = opposite_elementv->get_face_ctrlPts(
+      itf_part->get_fixed_face_id(itf_id, ee), &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
 
-    // tag = rotated_tag;
+    free_quad->reset();
+    return FE_T::search_closest_point(pt, elements.get(),
+      facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
   }
 
-  void SI_quad_point::search_opposite_fixed_point(
-    const Vector_3 &rotated_pt,
-    const ALocal_Interface * const &itf_part,
-    const SI_solution * const &SI_sol,
-    const int &itf_id,
-    int &tag,
-    int &fixed_ee )
+  bool SI_quad_point::project_to_rotated_ele(const Vector_3 &pt,
+    const ALocal_Interface * const &itf_part, const SI_solution * const &SI_sol,
+    const int &itf_id, const int &ee)
   {
     const int nLocBas = itf_part->get_nLocBas();
-    bool is_found = false;
 
-    double * volctrl_x = new double [nLocBas];
-    double * volctrl_y = new double [nLocBas];
-    double * volctrl_z = new double [nLocBas];
+    std::vector<double> inictrl_x(nLocBas), inictrl_y(nLocBas), inictrl_z(nLocBas);
+    std::vector<double> volctrl_x(nLocBas), volctrl_y(nLocBas), volctrl_z(nLocBas);
+    std::vector<int> rotated_local_ien(nLocBas);
+    std::vector<double> rotated_local_disp(nLocBas * 3);
 
-    int * fixed_local_ien = new int [nLocBas];
+    itf_part->get_rotated_ele_ctrlPts(itf_id, ee, &inictrl_x[0], &inictrl_y[0], &inictrl_z[0]);
+    SI_sol->get_rotated_mdisp(itf_part, itf_id, ee, &rotated_local_ien[0], &rotated_local_disp[0]);
+    SI_T::get_currPts(&inictrl_x[0], &inictrl_y[0], &inictrl_z[0], &rotated_local_disp[0],
+      nLocBas, &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
 
-    int fixed_face_id = -1;
-    int fixed_tag = tag;
-    int num_fixed_ele = itf_part->get_num_tagged_fixed_ele(itf_id, fixed_tag);
+    const auto facectrl = opposite_elementv->get_face_ctrlPts(
+      itf_part->get_rotated_face_id(itf_id, ee), &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
 
-    for(int ee_index{0}; ee_index<num_fixed_ele; ++ee_index)
+    free_quad->reset();
+    return FE_T::search_closest_point(pt, elements.get(),
+      facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
+  }
+
+  void SI_quad_point::update_face_tree(const ALocal_Interface * const &itf_part,
+    const SI_solution * const &SI_sol)
+  {
+    for(int itf_id{0}; itf_id<itf_part->get_num_itf(); ++itf_id)
     {
-      const int ee = itf_part->get_tagged_fixed_ele(itf_id, fixed_tag, ee_index);
-      itf_part->get_fixed_ele_ctrlPts(itf_id, ee, volctrl_x, volctrl_y, volctrl_z);
-      
-      fixed_face_id = itf_part->get_fixed_face_id(itf_id, ee);
+      // The fixed side does not move
+      if( !fixed_tree[itf_id].is_built() )
+      {
+        const std::vector<int> eles = get_all_fixed_ele(itf_part, itf_id);
+        fixed_tree[itf_id].build(eles, get_fixed_box(itf_part, itf_id, eles));
+      }
+
+      const std::vector<int> eles = get_all_rotated_ele(itf_part, itf_id);
+      const std::vector<double> boxes = get_rotated_box(itf_part, SI_sol, itf_id, eles);
+
+      if( !rotated_tree[itf_id].is_built() )
+        rotated_tree[itf_id].build(eles, boxes);
+      else
+        rotated_tree[itf_id].refit(boxes);
+    }
+  }
+
+  std::vector<int> SI_quad_point::get_all_fixed_ele(
+    const ALocal_Interface * const &itf_part, const int &itf_id) const
+  {
+    std::vector<int> eles {};
+    for(int tag{0}; tag<itf_part->get_num_tag(itf_id); ++tag)
+    {
+      for(int ee_index{0}; ee_index<itf_part->get_num_tagged_fixed_ele(itf_id, tag); ++ee_index)
+        eles.push_back( itf_part->get_tagged_fixed_ele(itf_id, tag, ee_index) );
+    }
+
+    VEC_T::sort_unique_resize( eles );
+    return eles;
+  }
+
+  std::vector<int> SI_quad_point::get_all_rotated_ele(
+    const ALocal_Interface * const &itf_part, const int &itf_id) const
+  {
+    std::vector<int> eles {};
+    for(int tag{0}; tag<itf_part->get_num_tag(itf_id); ++tag)
+    {
+      for(int ee_index{0}; ee_index<itf_part->get_num_tagged_rotated_ele(itf_id, tag); ++ee_index)
+        eles.push_back( itf_part->get_tagged_rotated_ele(itf_id, tag, ee_index) );
+    }
+
+    VEC_T::sort_unique_resize( eles );
+    return eles;
+  }
+
+  std::vector<double> SI_quad_point::get_face_box(const int &face_id,
+    const std::vector<double> &volctrl_x, const std::vector<double> &volctrl_y,
+    const std::vector<double> &volctrl_z) const
+  {
+    const auto facectrl = opposite_elementv->get_face_ctrlPts(face_id,
+      &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
+
+    std::vector<double> face_box(6, 0.0);
+    double size = 0.0;
+    for(int dd{0}; dd<3; ++dd)
+    {
+      const auto range = std::minmax_element(facectrl[dd].begin(), facectrl[dd].end());
+      face_box[dd]     = *range.first;
+      face_box[dd + 3] = *range.second;
+      size = std::max(size, face_box[dd + 3] - face_box[dd]);
+    }
+
+    for(int dd{0}; dd<3; ++dd)
+    {
+      face_box[dd]     -= box_enlarge * size;
+      face_box[dd + 3] += box_enlarge * size;
+    }
+
+    return face_box;
+  }
+
+  std::vector<double> SI_quad_point::get_fixed_box(
+    const ALocal_Interface * const &itf_part, const int &itf_id,
+    const std::vector<int> &eles) const
+  {
+    const int nLocBas = itf_part->get_nLocBas();
+    std::vector<double> volctrl_x(nLocBas), volctrl_y(nLocBas), volctrl_z(nLocBas);
+
+    std::vector<double> boxes {};
+    boxes.reserve( 6 * eles.size() );
+
+    for(const int ee : eles)
+    {
+      itf_part->get_fixed_ele_ctrlPts(itf_id, ee, &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
+
+      VEC_T::insert_end( boxes, get_face_box(itf_part->get_fixed_face_id(itf_id, ee),
+            volctrl_x, volctrl_y, volctrl_z) );
+    }
+
+    return boxes;
+  }
+
+  std::vector<double> SI_quad_point::get_rotated_box(
+    const ALocal_Interface * const &itf_part, const SI_solution * const &SI_sol,
+    const int &itf_id, const std::vector<int> &eles) const
+  {
+    const int nLocBas = itf_part->get_nLocBas();
+    std::vector<double> inictrl_x(nLocBas), inictrl_y(nLocBas), inictrl_z(nLocBas);
+    std::vector<double> volctrl_x(nLocBas), volctrl_y(nLocBas), volctrl_z(nLocBas);
+    std::vector<int> rotated_local_ien(nLocBas);
+    std::vector<double> rotated_local_disp(nLocBas * 3);
+
+    std::vector<double> boxes {};
+    boxes.reserve( 6 * eles.size() );
+
+    for(const int ee : eles)
+    {
+      itf_part->get_rotated_ele_ctrlPts(itf_id, ee, &inictrl_x[0], &inictrl_y[0], &inictrl_z[0]);
+      SI_sol->get_rotated_mdisp(itf_part, itf_id, ee, &rotated_local_ien[0], &rotated_local_disp[0]);
+      SI_T::get_currPts(&inictrl_x[0], &inictrl_y[0], &inictrl_z[0], &rotated_local_disp[0],
+        nLocBas, &volctrl_x[0], &volctrl_y[0], &volctrl_z[0]);
+
+      VEC_T::insert_end( boxes, get_face_box(itf_part->get_rotated_face_id(itf_id, ee),
+            volctrl_x, volctrl_y, volctrl_z) );
+    }
+
+    return boxes;
+  }
+
+  void SI_face_tree::build(const std::vector<int> &in_ele, const std::vector<double> &in_box)
+  {
+    SYS_T::print_fatal_if( in_box.size() != 6 * in_ele.size(),
+      "Error, SI_face_tree::build: the boxes do not match the elements.\n" );
+
+    ele = in_ele;
+    box = in_box;
 
-      const auto facectrl = opposite_elementv->get_face_ctrlPts(fixed_face_id,
-        volctrl_x, volctrl_y, volctrl_z);
+    const int num_face = VEC_T::get_size(ele);
 
-      free_quad->reset();
-      is_found = FE_T::search_closest_point(rotated_pt, elements.get(),
-        facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
+    order.resize(num_face);
+    for(int ii{0}; ii<num_face; ++ii) order[ii] = ii;
 
-      if(is_found)
+    node_box.clear(); node_left.clear(); node_right.clear();
+    node_begin.clear(); node_end.clear();
+
+    if(num_face > 0) build_node(0, num_face);
+  }
+
+  int SI_face_tree::build_node(const int &begin, const int &end)
+  {
+    const int node = VEC_T::get_size(node_left);
+
+    node_box.insert(node_box.end(), 6, 0.0);
+    node_left.push_back(-1);
+    node_right.push_back(-1);
+    node_begin.push_back(begin);
+    node_end.push_back(end);
+
+    set_node_box(node);
+
+    if(end - begin > leaf_size)
+    {
+      // Split at the median of the box centers along the longest side
+      int axis = 0;
+      double length = -1.0;
+      for(int dd{0}; dd<3; ++dd)
       {
-        fixed_ee = ee;
-        break;
+        const double len = node_box[6*node + dd + 3] - node_box[6*node + dd];
+        if(len > length) { length = len; axis = dd; }
       }
+
+      const int mid = (begin + end) / 2;
+      std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end,
+        [this, axis](const int &a, const int &b)
+        { return box[6*a + axis] + box[6*a + axis + 3] < box[6*b + axis] + box[6*b + axis + 3]; });
+
+      const int left = build_node(begin, mid);
+      const int right = build_node(mid, end);
+      node_left[node] = left;
+      node_right[node] = right;
     }
 
-    // Second try
-    if(is_found == false && tag != 0)
-    {
-      fixed_tag = tag - 1;
+    return node;
+  }
 
-      num_fixed_ele = itf_part->get_num_tagged_fixed_ele(itf_id, fixed_tag);
+  void SI_face_tree::set_node_box(const int &node)
+  {
+    double * const nbox = &node_box[6*node];
+    for(int dd{0}; dd<3; ++dd)
+    {
+      nbox[dd]     = std::numeric_limits<double>::max();
+      nbox[dd + 3] = std::numeric_limits<double>::lowest();
+    }
 
-      for(int ee_index{0}; ee_index<num_fixed_ele; ++ee_index)
+    for(int ii{node_begin[node]}; ii<node_end[node]; ++ii)
+    {
+      const double * const fbox = &box[6*order[ii]];
+      for(int dd{0}; dd<3; ++dd)
       {
-        const int ee = itf_part->get_tagged_fixed_ele(itf_id, fixed_tag, ee_index);
-        itf_part->get_fixed_ele_ctrlPts(itf_id, ee, volctrl_x, volctrl_y, volctrl_z);
-        
-        fixed_face_id = itf_part->get_fixed_face_id(itf_id, ee);
+        nbox[dd]     = std::min(nbox[dd], fbox[dd]);
+        nbox[dd + 3] = std::max(nbox[dd + 3], fbox[dd + 3]);
+      }
+    }
+  }
 
-        const auto facectrl = opposite_elementv->get_face_ctrlPts(fixed_face_id,
-          volctrl_x, volctrl_y, volctrl_z);
+  void SI_face_tree::refit(const std::vector<double> &in_box)
+  {
+    SYS_T::print_fatal_if( in_box.size() != box.size(),
+      "Error, SI_face_tree::refit: the number of boxes has changed.\n" );
 
-        free_quad->reset();
-        is_found = FE_T::search_closest_point(rotated_pt, elements.get(),
-          facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
+    box = in_box;
 
-        if(is_found)
+    // The children are stored after their parent
+    for(int node = VEC_T::get_size(node_left) - 1; node >= 0; --node)
+    {
+      if(node_left[node] < 0) set_node_box(node);
+      else
+      {
+        const double * const lbox = &node_box[6*node_left[node]];
+        const double * const rbox = &node_box[6*node_right[node]];
+        for(int dd{0}; dd<3; ++dd)
         {
-          fixed_ee = ee;
-          break;
+          node_box[6*node + dd]     = std::min(lbox[dd], rbox[dd]);
+          node_box[6*node + dd + 3] = std::max(lbox[dd + 3], rbox[dd + 3]);
         }
       }
     }
+  }
 
-    // Third try
-    if(is_found == false && tag != itf_part->get_num_tag(itf_id) - 1)
+  std::vector<int> SI_face_tree::query(const Vector_3 &pt) const
+  {
+    const double xyz[3] {pt.x(), pt.y(), pt.z()};
+
+    auto contains = [&xyz](const double * const bb)
     {
-      fixed_tag = tag + 1;
+      return xyz[0] >= bb[0] && xyz[0] <= bb[3] && xyz[1] >= bb[1]
+        && xyz[1] <= bb[4] && xyz[2] >= bb[2] && xyz[2] <= bb[5];
+    };
 
-      num_fixed_ele = itf_part->get_num_tagged_fixed_ele(itf_id, fixed_tag);
+    // Pairs of the squared distance to the box center and the face
+    std::vector<std::pair<double, int>> found {};
 
-      for(int ee_index{0}; ee_index<num_fixed_ele; ++ee_index)
-      {
-        const int ee = itf_part->get_tagged_fixed_ele(itf_id, fixed_tag, ee_index);
-        itf_part->get_fixed_ele_ctrlPts(itf_id, ee, volctrl_x, volctrl_y, volctrl_z);
-        
-        fixed_face_id = itf_part->get_fixed_face_id(itf_id, ee);
+    std::vector<int> stack {};
+    if( is_built() ) stack.push_back(0);
 
-        const auto facectrl = opposite_elementv->get_face_ctrlPts(fixed_face_id,
-          volctrl_x, volctrl_y, volctrl_z);
+    while( !stack.empty() )
+    {
+      const int node = stack.back();
+      stack.pop_back();
 
-        free_quad->reset();
-        is_found = FE_T::search_closest_point(rotated_pt, elements.get(),
-          facectrl[0].data(), facectrl[1].data(), facectrl[2].data(), free_quad.get());
+      if( !contains(&node_box[6*node]) ) continue;
 
-        if(is_found)
+      if(node_left[node] >= 0)
+      {
+        stack.push_back(node_left[node]);
+        stack.push_back(node_right[node]);
+      }
+      else
+      {
+        for(int ii{node_begin[node]}; ii<node_end[node]; ++ii)
         {
-          fixed_ee = ee;
-          break;
+          const double * const fbox = &box[6*order[ii]];
+          if( contains(fbox) )
+          {
+            double dist = 0.0;
+            for(int dd{0}; dd<3; ++dd)
+            {
+              const double diff = xyz[dd] - 0.5 * (fbox[dd] + fbox[dd + 3]);
+              dist += diff * diff;
+            }
+            found.push_back( std::make_pair(dist, order[ii]) );
+          }
         }
       }
     }
 
-    delete [] volctrl_x; volctrl_x = nullptr;
-    delete [] volctrl_y; volctrl_y = nullptr;
-    delete [] volctrl_z; volctrl_z = nullptr;
+    std::sort(found.begin(), found.end());
 
-    delete [] fixed_local_ien; fixed_local_ien = nullptr;
+    std::vector<int> output( found.size() );
+    for(std::size_t ii=0; ii<found.size(); ++ii) output[ii] = ele[found[ii].second];
 
-    SYS_T::print_fatal_if(is_found == false,
-      "Error, SI_quad_point::search_opposite_point: cannot find opposite fixed point.\n");
+    return output;
   }
 
   void get_currPts( const double * const &ept_x,
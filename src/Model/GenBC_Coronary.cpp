@@ -4,7 +4,7 @@ GenBC_Coronary::GenBC_Coronary( const std::string &lpn_filename,
     const int &in_N, const double &dt3d, const int &in_index,
     const std::string &in_lpn_sol_file )
 : num_odes(2), N( in_N ), h( dt3d/static_cast<double>(N) ),
-  lpn_sol_file( in_lpn_sol_file ), absTol( 1.0e-8 ), relTol( 1.0e-5 )
+  lpn_sol_file( in_lpn_sol_file ), absTol( 1.0e-8 )
 {
   // Now read the lpn input file for num_ebc and coronary model
   // parameters (Ra, Ca, Ra_micro, Cim, Rv, Pd and Pim)
@@ -54,10 +54,16 @@ GenBC_Coronary::GenBC_Coronary( const std::string &lpn_filename,
     dPimdt_k1.resize( num_ebc );
     dPimdt_k2.resize( num_ebc );
     dPimdt_k3.resize( num_ebc );
+    cache_valid.assign( num_ebc, false );
+    cache_Q.resize( num_ebc );
+    cache_P.resize( num_ebc );
+    cache_m.resize( num_ebc );
+    cache_sol.resize( num_ebc );
 
     for( int ii =0; ii<num_ebc; ++ii )
     {
       prev_0D_sol[ii].resize( num_odes );
+      cache_sol[ii].resize( num_odes );
       restart_0D_sol[ii].resize( num_odes );
       Pi0[ii].resize( num_odes );
 
@@ -230,21 +236,25 @@ void GenBC_Coronary::write_0D_sol( const int &curr_index, const double &curr_tim
 
 double GenBC_Coronary::get_m( const int &ii, const double &in_dot_Q, const double &in_Q ) const
 {
-  double diff = std::abs(in_Q) * relTol;
+  if( !cache_valid[ii] || cache_Q[ii] != in_Q ) integrate( ii, in_Q );
 
-  if( diff < absTol ) diff = absTol;
-
-  const double left  = get_P(ii, in_dot_Q, in_Q + 0.5 * diff);
-  const double right = get_P(ii, in_dot_Q, in_Q - 0.5 * diff);
-
-  return (left - right) / diff;
+  return cache_m[ii];
 }
 
 double GenBC_Coronary::get_P( const int &ii, const double &in_dot_Q,
     const double &in_Q, const double &time ) const
 {
-  double output_P = 0.0;
+  if( !cache_valid[ii] || cache_Q[ii] != in_Q ) integrate( ii, in_Q );
+
+  // Make a copy of the ODE solutions.
+  // prev_0D_sol will reset initial values Pi0 for future time integration (t=n+1-> t=n+2)
+  for(int jj=0; jj<num_odes; ++jj) prev_0D_sol[ii][jj] = cache_sol[ii][jj];
+
+  return cache_P[ii];
+}
 
+void GenBC_Coronary::integrate( const int &ii, const double &in_Q ) const
+{
   const double fac13 = 1.0 / 3.0;
   const double fac23 = 2.0 / 3.0;
   const double fac18 = 1.0 / 8.0;
@@ -256,6 +266,9 @@ double GenBC_Coronary::get_P( const int &ii, const double &in_dot_Q,
     // Each RCR face is governed by an ODE only.
     double pi_m = Pi0[ii][0]; // Pi_m
 
+    // dpi_m := d Pi_m / d in_Q, which vanishes initially as Pi0 is fixed
+    double dpi_m = 0.0;
+
     // in_Q gives Q_N = Q_n+1, and Q0[ii] gives Q_0 = Q_n.
     // do Runge-Kutta 4 with the 3/8 rule
     for(int mm=0; mm<N; ++mm)
@@ -264,20 +277,30 @@ double GenBC_Coronary::get_P( const int &ii, const double &in_dot_Q,
 
       const double Q_mp1 = Q0[ii] + static_cast<double>(mm+1) * ( in_Q - Q0[ii] ) / static_cast<double>(N);
 
+      // d Q_m / d in_Q and d Q_m+1 / d in_Q
+      const double dQ_m   = static_cast<double>(mm) / static_cast<double>(N);
+      const double dQ_mp1 = static_cast<double>(mm+1) / static_cast<double>(N);
+
       const double K1 = F_RCR(ii, pi_m, Q_m);
+      const double dK1 = dF_RCR(ii, dpi_m, dQ_m);
 
       const double K2 = F_RCR(ii, pi_m + fac13 * K1 * h, fac23 * Q_m + fac13 * Q_mp1);
+      const double dK2 = dF_RCR(ii, dpi_m + fac13 * dK1 * h, fac23 * dQ_m + fac13 * dQ_mp1);
 
       const double K3 = F_RCR(ii, pi_m - fac13 * K1 * h + K2 * h, fac13 * Q_m + fac23 * Q_mp1);
+      const double dK3 = dF_RCR(ii, dpi_m - fac13 * dK1 * h + dK2 * h, fac13 * dQ_m + fac23 * dQ_mp1);
 
       const double K4 = F_RCR(ii, pi_m + K1 * h - K2 * h + K3 * h, Q_mp1);
+      const double dK4 = dF_RCR(ii, dpi_m + dK1 * h - dK2 * h + dK3 * h, dQ_mp1);
 
       pi_m = pi_m + fac18 * K1 * h + fac38 * K2 * h + fac38 * K3 * h + fac18 * K4 * h;
+      dpi_m = dpi_m + fac18 * dK1 * h + fac38 * dK2 * h + fac38 * dK3 * h + fac18 * dK4 * h;
     }
 
-    prev_0D_sol[ii][0] = pi_m;
+    cache_sol[ii][0] = pi_m;
 
-    output_P =  pi_m + Ra[ii] * in_Q ;
+    cache_P[ii] = pi_m + Ra[ii] * in_Q;
+    cache_m[ii] = dpi_m + Ra[ii];
   }
   else
   {
@@ -286,12 +309,15 @@ double GenBC_Coronary::get_P( const int &ii, const double &in_dot_Q,
     // initial pressures at Ca and Cim
     std::vector<double> pi_m  = Pi0[ii];
 
-    // auxiliary variables for RK4
-    std::vector<double> K1(num_odes, 0.0);
-    std::vector<double> K2(num_odes, 0.0);
-    std::vector<double> K3(num_odes, 0.0);
-    std::vector<double> K4(num_odes, 0.0);
-    std::vector<double> pi_tmp(num_odes, 0.0);
+    // sensitivities d pi_m / d in_Q
+    std::vector<double> dpi_m(num_odes, 0.0);
+
+    // auxiliary variables for RK4 and their sensitivities
+    std::vector<double> K1(num_odes, 0.0), dK1(num_odes, 0.0);
+    std::vector<double> K2(num_odes, 0.0), dK2(num_odes, 0.0);
+    std::vector<double> K3(num_odes, 0.0), dK3(num_odes, 0.0);
+    std::vector<double> K4(num_odes, 0.0), dK4(num_odes, 0.0);
+    std::vector<double> pi_tmp(num_odes, 0.0), dpi_tmp(num_odes, 0.0);
 
     // in_Q gives Q_N = Q_n+1, and Q0[ii] gives Q_0 = Q_n
     // do Runge-Kutta 4 with the 3/8 rule
@@ -301,34 +327,55 @@ double GenBC_Coronary::get_P( const int &ii, const double &in_dot_Q,
 
       const double Q_mp1 = Q0[ii] + static_cast<double>(mm+1) * ( in_Q - Q0[ii] ) / static_cast<double>(N);
 
+      // d Q_m / d in_Q and d Q_m+1 / d in_Q
+      const double dQ_m   = static_cast<double>(mm) / static_cast<double>(N);
+      const double dQ_mp1 = static_cast<double>(mm+1) / static_cast<double>(N);
+
       F_coronary(ii, pi_m, Q_m, dPimdt_k1[ii][mm], K1);
+      dF_coronary(ii, dpi_m, dQ_m, dK1);
 
       for(int jj=0; jj<num_odes; ++jj)
+      {
         pi_tmp[jj] = pi_m[jj] + fac13 * K1[jj] * h;
+        dpi_tmp[jj] = dpi_m[jj] + fac13 * dK1[jj] * h;
+      }
 
       F_coronary(ii, pi_tmp, fac23 * Q_m + fac13 * Q_mp1, dPimdt_k2[ii][mm], K2);
+      dF_coronary(ii, dpi_tmp, fac23 * dQ_m + fac13 * dQ_mp1, dK2);
 
       for(int jj=0; jj<num_odes; ++jj)
+      {
         pi_tmp[jj] = pi_m[jj] - fac13*K1[jj] * h + K2[jj] * h;
+        dpi_tmp[jj] = dpi_m[jj] - fac13*dK1[jj] * h + dK2[jj] * h;
+      }
 
       F_coronary(ii, pi_tmp, fac13 * Q_m + fac23 * Q_mp1, dPimdt_k3[ii][mm], K3);
+      dF_coronary(ii, dpi_tmp, fac13 * dQ_m + fac23 * dQ_mp1, dK3);
 
       for(int jj=0; jj<num_odes; ++jj)
+      {
         pi_tmp[jj] = pi_m[jj] + K1[jj] * h - K2[jj] * h + K3[jj] * h;
+        dpi_tmp[jj] = dpi_m[jj] + dK1[jj] * h - dK2[jj] * h + dK3[jj] * h;
+      }
 
       F_coronary(ii, pi_tmp, Q_mp1, dPimdt_k1[ii][mm+1], K4);
+      dF_coronary(ii, dpi_tmp, dQ_mp1, dK4);
 
       for(int jj=0; jj<num_odes; ++jj)
+      {
         pi_m[jj] = pi_m[jj] + fac18 * K1[jj] * h + fac38 * K2[jj] * h + fac38 * K3[jj] * h + fac18 * K4[jj] * h;
+        dpi_m[jj] = dpi_m[jj] + fac18 * dK1[jj] * h + fac38 * dK2[jj] * h + fac38 * dK3[jj] * h + fac18 * dK4[jj] * h;
+      }
     }
 
-    // Make a copy of the ODE solutions.
-    // prev_0D_sol will reset initial values Pi0 for future time integration (t=n+1-> t=n+2)
-    for(int jj=0; jj<num_odes; ++jj) prev_0D_sol[ii][jj]=pi_m[jj];
+    for(int jj=0; jj<num_odes; ++jj) cache_sol[ii][jj] = pi_m[jj];
 
-    output_P = pi_m[0] + Ra[ii] * in_Q;
+    cache_P[ii] = pi_m[0] + Ra[ii] * in_Q;
+    cache_m[ii] = dpi_m[0] + Ra[ii];
   }
-  return output_P;
+
+  cache_valid[ii] = true;
+  cache_Q[ii] = in_Q;
 }
 
 double GenBC_Coronary::get_P0( const int &ii ) const
@@ -351,6 +398,31 @@ void GenBC_Coronary::reset_initial_sol( const int &ii, const double &in_Q_0,
 
   // Precalculate dPimdt values needed for integrating coronary ODEs.
   if( num_Pim_data[ii]>0 ) get_dPim_dt(ii, curr_time, curr_time + N * h);
+
+  cache_valid[ii] = false;
+}
+
+std::vector<double> GenBC_Coronary::get_state( const int &ii ) const
+{
+  std::vector<double> state { Q0[ii] };
+  state.insert( state.end(), Pi0[ii].begin(), Pi0[ii].end() );
+  state.insert( state.end(), prev_0D_sol[ii].begin(), prev_0D_sol[ii].end() );
+  return state;
+}
+
+void GenBC_Coronary::set_state( const int &ii, const std::vector<double> &state )
+{
+  SYS_T::print_fatal_if( static_cast<int>( state.size() ) != 1 + 2 * num_odes,
+      "Error: GenBC_Coronary state has wrong size.\n" );
+
+  Q0[ii] = state[0];
+  for( int jj=0; jj<num_odes; ++jj )
+  {
+    Pi0[ii][jj] = state[1 + jj];
+    prev_0D_sol[ii][jj] = state[1 + num_odes + jj];
+  }
+
+  cache_valid[ii] = false;
 }
 
 void GenBC_Coronary::F_coronary( const int &ii, const std::vector<double> &pi, const double &q,
@@ -368,6 +440,19 @@ double GenBC_Coronary::F_RCR( const int &ii, const double &pi, const double &q )
   return (q-(pi-Pd[ii])/Ra_micro[ii])/Ca[ii];
 }
 
+void GenBC_Coronary::dF_coronary( const int &ii, const std::vector<double> &dpi,
+    const double &dq, std::vector<double> &dK ) const
+{
+  // Pd and dPim/dt do not depend on Q and drop out of the linearization.
+  dK[0] = (dq-(dpi[0]-dpi[1])/Ra_micro[ii])/Ca[ii];
+  dK[1] = ((dpi[0]-dpi[1])/Ra_micro[ii]-dpi[1]/Rv[ii])/Cim[ii];
+}
+
+double GenBC_Coronary::dF_RCR( const int &ii, const double &dpi, const double &dq ) const
+{
+  return (dq-dpi/Ra_micro[ii])/Ca[ii];
+}
+
 void GenBC_Coronary::get_dPim_dt( const int &ii, const double &time_start, const double &time_end )
 {
   double tend_mod = fmod( time_end, Time_data[ii][num_Pim_data[ii]-1] );
@@ -2,8 +2,7 @@
 
 GenBC_RCR::GenBC_RCR( const std::string &lpn_filename, const int &in_N,
     const double &dt3d )
-: N( in_N ), h( dt3d/static_cast<double>(N) ),
-  absTol( 1.0e-8 ), relTol( 1.0e-5 )
+: N( in_N ), h( dt3d/static_cast<double>(N) )
 {
   // Now read the lpn files for num_ebc, Rd, C, and Rp
   SYS_T::file_check( lpn_filename ); // make sure the file is on the disk
@@ -37,6 +36,8 @@ GenBC_RCR::GenBC_RCR( const std::string &lpn_filename, const int &in_N,
     Rd.resize( num_ebc ); C.resize( num_ebc ); 
     Rp.resize( num_ebc ); Pd.resize( num_ebc );
     Q0.resize( num_ebc ); Pi0.resize( num_ebc );
+    cache_valid.assign( num_ebc, false );
+    cache_Q.resize( num_ebc ); cache_P.resize( num_ebc ); cache_m.resize( num_ebc );
   }
   else SYS_T::print_fatal("Error: the outflow model in %s does not match GenBC_Resistance.\n", lpn_filename.c_str());
 
@@ -97,19 +98,22 @@ void GenBC_RCR::print_info() const
 double GenBC_RCR::get_m( const int &ii, const double &in_dot_Q,
    const double &in_Q ) const
 {
-  double diff = std::abs(in_Q) * relTol;
+  if( !cache_valid[ii] || cache_Q[ii] != in_Q ) integrate( ii, in_Q );
 
-  if( diff < absTol ) diff = absTol;  
-
-  const double left  = get_P(ii, in_dot_Q, in_Q + 0.5 * diff);
-  const double right = get_P(ii, in_dot_Q, in_Q - 0.5 * diff);
-
-  return (left - right) / diff;
+  return cache_m[ii];
 }
 
 
 double GenBC_RCR::get_P( const int &ii, const double &in_dot_Q,
    const double &in_Q, const double &time ) const
+{
+  if( !cache_valid[ii] || cache_Q[ii] != in_Q ) integrate( ii, in_Q );
+
+  return cache_P[ii];
+}
+
+
+void GenBC_RCR::integrate( const int &ii, const double &in_Q ) const
 {
   const double fac13 = 1.0 / 3.0;
   const double fac23 = 2.0 / 3.0;
@@ -117,7 +121,10 @@ double GenBC_RCR::get_P( const int &ii, const double &in_dot_Q,
   const double fac38 = 3.0 / 8.0;
 
   double pi_m = Pi0[ii]; // Pi_m
-  
+
+  // dpi_m := d Pi_m / d in_Q, which vanishes initially as Pi0 is fixed
+  double dpi_m = 0.0;
+
   // in_Q gives Q_N = Q_n+1, and Q0[ii] gives Q_0 = Q_n
   for(int mm=0; mm<N; ++mm)
   {
@@ -125,18 +132,30 @@ double GenBC_RCR::get_P( const int &ii, const double &in_dot_Q,
     
     const double Q_mp1 = Q0[ii] + static_cast<double>(mm+1) * ( in_Q - Q0[ii] ) / static_cast<double>(N);
 
+    // d Q_m / d in_Q and d Q_m+1 / d in_Q
+    const double dQ_m   = static_cast<double>(mm) / static_cast<double>(N);
+    const double dQ_mp1 = static_cast<double>(mm+1) / static_cast<double>(N);
+
     const double K1 = F(ii, pi_m, Q_m );
+    const double dK1 = F(ii, dpi_m, dQ_m );
 
     const double K2 = F(ii, pi_m + fac13 * K1 * h, fac23 * Q_m + fac13 * Q_mp1 );
+    const double dK2 = F(ii, dpi_m + fac13 * dK1 * h, fac23 * dQ_m + fac13 * dQ_mp1 );
 
     const double K3 = F(ii, pi_m - fac13 * K1 * h + K2 * h, fac13 * Q_m + fac23 * Q_mp1);
+    const double dK3 = F(ii, dpi_m - fac13 * dK1 * h + dK2 * h, fac13 * dQ_m + fac23 * dQ_mp1);
   
     const double K4 = F(ii, pi_m + K1 * h - K2 * h + K3 * h, Q_mp1);
+    const double dK4 = F(ii, dpi_m + dK1 * h - dK2 * h + dK3 * h, dQ_mp1);
 
     pi_m = pi_m + fac18 * K1 * h + fac38 * K2 * h + fac38 * K3 * h + fac18 * K4 * h; 
+    dpi_m = dpi_m + fac18 * dK1 * h + fac38 * dK2 * h + fac38 * dK3 * h + fac18 * dK4 * h; 
   }
 
-  return pi_m + Rp[ii] * in_Q + Pd[ii];
+  cache_valid[ii] = true;
+  cache_Q[ii] = in_Q;
+  cache_P[ii] = pi_m + Rp[ii] * in_Q + Pd[ii];
+  cache_m[ii] = dpi_m + Rp[ii];
 }
 
 
@@ -146,6 +165,8 @@ void GenBC_RCR::reset_initial_sol( const int &ii, const double &in_Q_0,
   Q0[ii]  = in_Q_0;
 
   Pi0[ii] = in_P_0 - in_Q_0 * Rp[ii] - Pd[ii];
+
+  cache_valid[ii] = false;
 }
 
 // EOF
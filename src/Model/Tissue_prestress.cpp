@@ -1,95 +1,130 @@
 #include "Tissue_prestress.hpp"
 
-Tissue_prestress::Tissue_prestress( 
-    const ALocal_Elem * const &locelem, const int &in_nqp_tet, 
+namespace
+{
+  // Create the prestress file with the datasets rank_offset, nqp, and
+  // prestress of size num_row x 6 in the file type ftype
+  hid_t create_prestress_file( const std::string &fName, const hid_t &fapl,
+      const int &num_row, const hid_t &ftype )
+  {
+    hid_t file_id = H5Fcreate(fName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+
+    SYS_T::print_fatal_if( file_id < 0, "Error: Tissue_prestress cannot create %s.\n", fName.c_str() );
+
+    const int size = SYS_T::get_MPI_size();
+
+    hsize_t dims_offset[1] = { static_cast<hsize_t>(size + 1) };
+    hid_t space = H5Screate_simple( 1, dims_offset, NULL );
+    hid_t dset = H5Dcreate( file_id, "rank_offset", H5T_NATIVE_INT, space,
+        H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    H5Dclose( dset ); H5Sclose( space );
+
+    space = H5Screate( H5S_SCALAR );
+    dset = H5Dcreate( file_id, "nqp", H5T_NATIVE_INT, space,
+        H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    H5Dclose( dset ); H5Sclose( space );
+
+    hsize_t dims[2] = { static_cast<hsize_t>(num_row), 6 };
+    space = H5Screate_simple( 2, dims, NULL );
+    dset = H5Dcreate( file_id, "prestress", ftype, space,
+        H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+    H5Dclose( dset ); H5Sclose( space );
+
+    return file_id;
+  }
+
+  // Write the rows [row_start, row_start + num_row) of prestress, and the
+  // small datasets if is_header is true
+  void write_prestress_rows( const hid_t &file_id, const hid_t &dxpl,
+      const bool &is_header, const std::vector<int> &rank_offset, const int &nqp,
+      const int &row_start, const int &num_row, const std::vector<double> &data )
+  {
+    hid_t dset = H5Dopen( file_id, "rank_offset", H5P_DEFAULT );
+    hid_t fspace = H5Dget_space( dset );
+    if( !is_header ) H5Sselect_none( fspace );
+    H5Dwrite( dset, H5T_NATIVE_INT, fspace, fspace, dxpl, rank_offset.data() );
+    H5Sclose( fspace ); H5Dclose( dset );
+
+    dset = H5Dopen( file_id, "nqp", H5P_DEFAULT );
+    fspace = H5Dget_space( dset );
+    if( !is_header ) H5Sselect_none( fspace );
+    H5Dwrite( dset, H5T_NATIVE_INT, fspace, fspace, dxpl, &nqp );
+    H5Sclose( fspace ); H5Dclose( dset );
+
+    hsize_t start[2] = { static_cast<hsize_t>(row_start), 0 };
+    hsize_t count[2] = { static_cast<hsize_t>(num_row), 6 };
+
+    dset = H5Dopen( file_id, "prestress", H5P_DEFAULT );
+    fspace = H5Dget_space( dset );
+    hid_t mspace = H5Screate_simple( 2, count, NULL );
+    H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, NULL, count, NULL );
+    if( num_row == 0 ) { H5Sselect_none( fspace ); H5Sselect_none( mspace ); }
+
+    const herr_t status = H5Dwrite( dset, H5T_NATIVE_DOUBLE, mspace, fspace, dxpl, data.data() );
+    SYS_T::print_fatal_if( status < 0, "Error: Tissue_prestress failed to write the prestress.\n" );
+
+    H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+  }
+}
+
+Tissue_prestress::Tissue_prestress(
+    const ALocal_Elem * const &locelem, const int &in_nqp_tet,
     const int &in_cpu_rank, const bool &load_from_file,
-    const std::string &in_ps_fName )
+    const std::string &in_ps_fName, const bool &in_is_single_precision )
 : cpu_rank( in_cpu_rank ), nlocalele(locelem->get_nlocalele()), nqp(in_nqp_tet),
-  ps_fileBaseName( in_ps_fName )
+  nlocalele_s( 0 ), ps_fileBaseName( in_ps_fName ),
+  is_single_precision( in_is_single_precision ),
+  solid_index( nlocalele, -1 )
 {
-  qua_prestress.resize( nlocalele );
-
-  int counter_elem_s = 0;
   for(int ee=0; ee<nlocalele; ++ee)
   {
-    if( locelem->get_elem_tag(ee) == 0 ) qua_prestress[ee].clear();
-    else if( locelem->get_elem_tag(ee) == 1 )
-    {
-      qua_prestress[ee].resize(nqp * 6);
-      counter_elem_s += 1;
-    }
-    else
+    if( locelem->get_elem_tag(ee) == 1 ) solid_index[ee] = nlocalele_s++;
+    else if( locelem->get_elem_tag(ee) != 0 )
       SYS_T::print_fatal("Error: element tag should be 0 (fluid) or 1 (solid).\n");
   }
 
-  // Assign the value of qua_prestress data structure
-  if( counter_elem_s > 0 )
-  {
-    // Assign the qua_prestress to be all zero.
-    std::vector<double> qua_ps_array( counter_elem_s * nqp * 6, 0.0 );
+  // Assign the qua_prestress to be all zero.
+  qua_prestress.assign( nlocalele_s * nqp * 6, 0.0 );
 
-    if( load_from_file == true )
-    {
-      // If the prestress data exist on disk, read the prestress data;
-      const std::string ps_fName = SYS_T::gen_partfile_name( ps_fileBaseName, cpu_rank );
-      if( SYS_T::file_exist(ps_fName) )
-      {
-        hid_t ps_file_id = H5Fopen(ps_fName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
-
-        HDF5_Reader * ps_h5r = new HDF5_Reader( ps_file_id );
-
-        const int ps_size = ps_h5r -> read_intScalar("/", "ps_array_size"); 
-
-        SYS_T::print_fatal_if(ps_size != counter_elem_s * nqp * 6, "Error: Tissue_prestress the HDF5 file for prestress is incompatible with the local solid element number.\n");
-
-        qua_ps_array = ps_h5r -> read_doubleVector("/", "prestress");
-
-        delete ps_h5r; H5Fclose(ps_file_id);
-      }
-      else
-        SYS_T::print_fatal("Error: prestress file %s cannot be found.\n", ps_fName.c_str());
-
-      // Load the qua_ps_array to the proper location of qua_prestress 
-      int offset = 0;
-      for(int ee=0; ee<nlocalele; ++ee)
-      {
-        if( locelem -> get_elem_tag(ee) == 1 )
-        {
-          for(int ii=0; ii<6*nqp; ++ii)
-            qua_prestress[ee][ii] = qua_ps_array[ offset + ii ];
-
-          offset += nqp * 6;
-        }
-      }
-    } // Finish loading prestress from disk file
-  }// Finish initializing the prestress data structure
+  // If the prestress data exist on disk, read the prestress data
+  if( load_from_file ) read_prestress_hdf5();
 }
 
-std::vector<double> Tissue_prestress::get_prestress( const int &ee ) const
+const double * Tissue_prestress::get_prestress( const int &ee ) const
 {
-  return qua_prestress[ee];
+  if( solid_index[ee] < 0 ) return nullptr;
+
+  return &qua_prestress[ 6 * nqp * solid_index[ee] ];
 }
 
 std::array<double,6> Tissue_prestress::get_prestress( const int &ee, const int &qua ) const
 {
-  return {{ qua_prestress[ee][6*qua], qua_prestress[ee][6*qua+1], qua_prestress[ee][6*qua+2],
-    qua_prestress[ee][6*qua+3], qua_prestress[ee][6*qua+4], qua_prestress[ee][6*qua+5] }};
+  const double * const val = &qua_prestress[ 6 * nqp * solid_index[ee] + 6 * qua ];
+
+  return {{ val[0], val[1], val[2], val[3], val[4], val[5] }};
 }
 
 void Tissue_prestress::add_prestress( const int &ee, const double * const &in_psval )
 {
-  for(int ii=0; ii<6*nqp; ++ii) qua_prestress[ee][ii] += in_psval[ii];
+  double * const val = &qua_prestress[ 6 * nqp * solid_index[ee] ];
+
+  for(int ii=0; ii<6*nqp; ++ii) val[ii] += in_psval[ii];
 }
 
-void Tissue_prestress::add_prestress( const int &ee, const int &qua, 
+void Tissue_prestress::add_prestress( const int &ee, const int &qua,
     const double * const &in_psval )
 {
-  qua_prestress[ee][qua*6  ] += in_psval[0];
-  qua_prestress[ee][qua*6+1] += in_psval[1];
-  qua_prestress[ee][qua*6+2] += in_psval[2];
-  qua_prestress[ee][qua*6+3] += in_psval[3];
-  qua_prestress[ee][qua*6+4] += in_psval[4];
-  qua_prestress[ee][qua*6+5] += in_psval[5];
+  double * const val = &qua_prestress[ 6 * nqp * solid_index[ee] + 6 * qua ];
+
+  for(int ii=0; ii<6; ++ii) val[ii] += in_psval[ii];
+}
+
+double Tissue_prestress::get_norm_inf() const
+{
+  double norm = 0.0;
+  for( const double &val : qua_prestress ) norm = std::max( norm, std::abs(val) );
+
+  return norm;
 }
 
 void Tissue_prestress::print_info() const
@@ -97,36 +132,133 @@ void Tissue_prestress::print_info() const
   for(int ee=0; ee<nlocalele; ++ee)
   {
     std::cout<<"ee: "<<ee<<'\t';
-    VEC_T::print( qua_prestress[ee] );
+    if( solid_index[ee] >= 0 )
+    {
+      const double * const val = get_prestress( ee );
+      for(int ii=0; ii<6*nqp; ++ii) std::cout<<val[ii]<<'\t';
+    }
     std::cout<<std::endl;
   }
 }
 
 void Tissue_prestress::write_prestress_hdf5() const
 {
-  // Prepare the data to be reccorded
-  std::vector<double> qua_prestress_array;
-  qua_prestress_array.clear();
+  const int size = SYS_T::get_MPI_size();
 
-  for(int ee=0; ee<nlocalele; ++ee)
+  // The rows of all ranks are stored one after another in the rank order
+  const int num_row = nlocalele_s * nqp;
+
+  std::vector<int> rank_offset( size + 1, 0 );
+  MPI_Allgather( &num_row, 1, MPI_INT, &rank_offset[1], 1, MPI_INT, PETSC_COMM_WORLD );
+  for(int rr=0; rr<size; ++rr) rank_offset[rr+1] += rank_offset[rr];
+
+  const int row_start = rank_offset[cpu_rank];
+
+  const hid_t ftype = is_single_precision ? H5T_NATIVE_FLOAT : H5T_NATIVE_DOUBLE;
+
+  const std::string fName = ps_fileBaseName + ".h5";
+
+#ifdef H5_HAVE_PARALLEL
+  hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
+  H5Pset_fapl_mpio( fapl, PETSC_COMM_WORLD, MPI_INFO_NULL );
+
+  hid_t file_id = create_prestress_file( fName, fapl, rank_offset[size], ftype );
+
+  hid_t dxpl = H5Pcreate( H5P_DATASET_XFER );
+  H5Pset_dxpl_mpio( dxpl, H5FD_MPIO_COLLECTIVE );
+
+  write_prestress_rows( file_id, dxpl, cpu_rank == 0, rank_offset, nqp,
+      row_start, num_row, qua_prestress );
+
+  H5Pclose( dxpl );
+  H5Fclose( file_id );
+  H5Pclose( fapl );
+#else
+  // Without MPI-IO, rank 0 creates the file and the ranks write their rows
+  // in turn
+  if( cpu_rank == 0 )
+    H5Fclose( create_prestress_file( fName, H5P_DEFAULT, rank_offset[size], ftype ) );
+
+  for(int rr=0; rr<size; ++rr)
   {
-    if( qua_prestress[ee].size() > 0 )
-      VEC_T::insert_end(qua_prestress_array, qua_prestress[ee]);
+    MPI_Barrier( PETSC_COMM_WORLD );
+
+    if( rr == cpu_rank )
+    {
+      hid_t file_id = H5Fopen( fName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+      write_prestress_rows( file_id, H5P_DEFAULT, cpu_rank == 0, rank_offset, nqp,
+          row_start, num_row, qua_prestress );
+      H5Fclose( file_id );
+    }
   }
 
-  // Record to h5 file
-  const std::string fName = SYS_T::gen_partfile_name( ps_fileBaseName, cpu_rank );
+  MPI_Barrier( PETSC_COMM_WORLD );
+#endif
+
+  SYS_T::commPrint("Prestress of %d quadrature points written into %s in %s precision.\n",
+      rank_offset[size], fName.c_str(), is_single_precision ? "single" : "double");
+}
+
+void Tissue_prestress::read_prestress_hdf5()
+{
+  const std::string fName = ps_fileBaseName + ".h5";
+
+  if( SYS_T::file_exist(fName) )
+  {
+    hid_t file_id = H5Fopen( fName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
 
-  hid_t file_id = H5Fcreate(fName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    auto h5r = SYS_T::make_unique<HDF5_Reader>( file_id );
 
-  HDF5_Writer * h5w = new HDF5_Writer( file_id );
+    const std::vector<int> rank_offset = h5r -> read_intVector( "/", "rank_offset" );
 
-  h5w -> write_intScalar( "ps_array_size", qua_prestress_array.size() );
+    SYS_T::print_fatal_if( VEC_T::get_size(rank_offset) != SYS_T::get_MPI_size() + 1,
+        "Error: Tissue_prestress the prestress file %s is written with a different number of ranks.\n", fName.c_str() );
 
-  if( qua_prestress_array.size() > 0 )
-    h5w -> write_doubleVector( file_id, "prestress", qua_prestress_array );
+    SYS_T::print_fatal_if( h5r -> read_intScalar( "/", "nqp" ) != nqp ||
+        rank_offset[cpu_rank + 1] - rank_offset[cpu_rank] != nlocalele_s * nqp,
+        "Error: Tissue_prestress the HDF5 file for prestress is incompatible with the local solid element number.\n");
 
-  delete h5w; H5Fclose( file_id );
+    const int num_row = nlocalele_s * nqp;
+
+    if( num_row > 0 )
+    {
+      hsize_t start[2] = { static_cast<hsize_t>(rank_offset[cpu_rank]), 0 };
+      hsize_t count[2] = { static_cast<hsize_t>(num_row), 6 };
+
+      hid_t dset = H5Dopen( file_id, "prestress", H5P_DEFAULT );
+      hid_t fspace = H5Dget_space( dset );
+      hid_t mspace = H5Screate_simple( 2, count, NULL );
+      H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, NULL, count, NULL );
+
+      // A single precision dataset is converted by the library
+      const herr_t status = H5Dread( dset, H5T_NATIVE_DOUBLE, mspace, fspace,
+          H5P_DEFAULT, qua_prestress.data() );
+      SYS_T::print_fatal_if( status < 0, "Error: Tissue_prestress failed to read %s.\n", fName.c_str() );
+
+      H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+    }
+
+    H5Fclose( file_id );
+  }
+  else if( nlocalele_s > 0 )
+  {
+    // The former format with one file per rank
+    const std::string ps_fName = SYS_T::gen_partfile_name( ps_fileBaseName, cpu_rank );
+
+    SYS_T::print_fatal_if( !SYS_T::file_exist(ps_fName), "Error: prestress file %s or %s cannot be found.\n", fName.c_str(), ps_fName.c_str() );
+
+    hid_t ps_file_id = H5Fopen(ps_fName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+    auto ps_h5r = SYS_T::make_unique<HDF5_Reader>( ps_file_id );
+
+    const int ps_size = ps_h5r -> read_intScalar("/", "ps_array_size");
+
+    SYS_T::print_fatal_if(ps_size != nlocalele_s * nqp * 6, "Error: Tissue_prestress the HDF5 file for prestress is incompatible with the local solid element number.\n");
+
+    qua_prestress = ps_h5r -> read_doubleVector("/", "prestress");
+
+    H5Fclose(ps_file_id);
+  }
 }
 
 // EOF
@@ -0,0 +1,169 @@
+#include "PostVectScatter.hpp"
+
+PostVectScatter::PostVectScatter(
+    const std::string &analysis_node_mapping_file,
+    const std::string &post_node_mapping_file,
+    const APart_Node * const &aNode_ptr,
+    const int &nFunc, const int &input_dof )
+: dof_per_node( input_dof ),
+  loc_sol_size( aNode_ptr->get_nlocghonode() * dof_per_node ),
+  vec_size( nFunc * dof_per_node )
+{
+  const int rank = SYS_T::get_MPI_rank();
+  const int size = SYS_T::get_MPI_size();
+
+  // Slice of the node indices of this rank
+  const int node_start = static_cast<int>( static_cast<long long>(nFunc) * rank / size );
+  const int node_end   = static_cast<int>( static_cast<long long>(nFunc) * (rank + 1) / size );
+  const int num_node   = node_end - node_start;
+
+  int analysis_len = 0, postproc_len = 0;
+  const std::vector<int> analysis_old2new = HDF5_T::read_intVector_slice(
+      analysis_node_mapping_file, "old_2_new", node_start, num_node, analysis_len );
+  const std::vector<int> postproc_new2old = HDF5_T::read_intVector_slice(
+      post_node_mapping_file, "new_2_old", node_start, num_node, postproc_len );
+
+  SYS_T::print_fatal_if( analysis_len != nFunc || postproc_len != nFunc,
+      "Error: PostVectScatter the node mapping has wrong size! \n" );
+
+  // The analysis old_2_new distributed over the natural indices, and the
+  // composed map distributed over the postprocessing new indices. The
+  // indices are stored exactly as scalars.
+  Vec old2new, post2anal;
+  VecCreateMPI(PETSC_COMM_WORLD, num_node, nFunc, &old2new);
+  VecDuplicate(old2new, &post2anal);
+
+  PetscScalar * array;
+  VecGetArray(old2new, &array);
+  for(int ii=0; ii<num_node; ++ii) array[ii] = analysis_old2new[ii];
+  VecRestoreArray(old2new, &array);
+
+  // post2anal[ new index ] = old2new[ new_2_old[ new index ] ]
+  std::vector<PetscInt> idx_nat( num_node ), idx_new( num_node );
+  for(int ii=0; ii<num_node; ++ii)
+  {
+    idx_nat[ii] = postproc_new2old[ii];
+    idx_new[ii] = node_start + ii;
+  }
+
+  IS is_nat, is_new;
+  ISCreateGeneral(PETSC_COMM_WORLD, num_node, idx_nat.data(), PETSC_COPY_VALUES, &is_nat);
+  ISCreateGeneral(PETSC_COMM_WORLD, num_node, idx_new.data(), PETSC_COPY_VALUES, &is_new);
+
+  VecScatter compose;
+  VecScatterCreate(old2new, is_nat, post2anal, is_new, &compose);
+  VecScatterBegin(compose, old2new, post2anal, INSERT_VALUES, SCATTER_FORWARD);
+  VecScatterEnd(compose, old2new, post2anal, INSERT_VALUES, SCATTER_FORWARD);
+
+  VecScatterDestroy(&compose);
+  ISDestroy(&is_new); ISDestroy(&is_nat);
+
+  // Gather the analysis indices of the local and ghost nodes
+  const int nlgn = aNode_ptr->get_nlocghonode();
+
+  std::vector<PetscInt> idx_node( nlgn );
+  for(int ii=0; ii<nlgn; ++ii) idx_node[ii] = aNode_ptr->get_local_to_global(ii);
+
+  Vec loc_map;
+  VecCreateSeq(PETSC_COMM_SELF, nlgn, &loc_map);
+
+  IS is_node;
+  ISCreateGeneral(PETSC_COMM_SELF, nlgn, idx_node.data(), PETSC_COPY_VALUES, &is_node);
+
+  VecScatter gather;
+  VecScatterCreate(post2anal, is_node, loc_map, NULL, &gather);
+  VecScatterBegin(gather, post2anal, loc_map, INSERT_VALUES, SCATTER_FORWARD);
+  VecScatterEnd(gather, post2anal, loc_map, INSERT_VALUES, SCATTER_FORWARD);
+
+  VecScatterDestroy(&gather);
+  ISDestroy(&is_node);
+
+  // Indices of the needed entries in the analysis numbering
+  std::vector<PetscInt> idx( loc_sol_size );
+
+  const PetscScalar * loc_array;
+  VecGetArrayRead(loc_map, &loc_array);
+  for( int ii=0; ii<nlgn; ++ii )
+  {
+    const PetscInt index = static_cast<PetscInt>( PetscRealPart( loc_array[ii] ) + 0.5 );
+
+    for(int jj=0; jj<dof_per_node; ++jj)
+      idx[ii*dof_per_node + jj] = index * dof_per_node + jj;
+  }
+  VecRestoreArrayRead(loc_map, &loc_array);
+
+  VecDestroy(&loc_map); VecDestroy(&post2anal); VecDestroy(&old2new);
+
+  VecCreate(PETSC_COMM_WORLD, &glo_sol);
+  VecSetSizes(glo_sol, PETSC_DECIDE, vec_size);
+  VecSetType(glo_sol, VECMPI);
+
+  VecCreateSeq(PETSC_COMM_SELF, loc_sol_size, &loc_sol);
+
+  IS is_from;
+  ISCreateGeneral(PETSC_COMM_SELF, loc_sol_size, idx.data(), PETSC_COPY_VALUES, &is_from);
+  VecScatterCreate(glo_sol, is_from, loc_sol, NULL, &scatter);
+  ISDestroy(&is_from);
+}
+
+PostVectScatter::~PostVectScatter()
+{
+  VecScatterDestroy(&scatter);
+  VecDestroy(&loc_sol);
+  VecDestroy(&glo_sol);
+}
+
+void PostVectScatter::Read( const std::string &solution_file_name,
+    double * const &loc_solution ) const
+{
+  if( HDF5_T::is_field_file( solution_file_name ) )
+  {
+    // Every rank reads the node rows covering its range of glo_sol
+    PetscInt rstart, rend;
+    VecGetOwnershipRange(glo_sol, &rstart, &rend);
+
+    const int node_start = static_cast<int>( rstart / dof_per_node );
+    const int node_end   = static_cast<int>( (rend + dof_per_node - 1) / dof_per_node );
+
+    int file_dof = 0;
+    const std::vector<double> rows = HDF5_T::read_field_rows( solution_file_name,
+        "sol", node_start, node_end - node_start, file_dof );
+
+    SYS_T::print_fatal_if( file_dof != dof_per_node,
+        "Error: PostVectScatter the solution dof %d in %s does not match %d.\n",
+        file_dof, solution_file_name.c_str(), dof_per_node );
+
+    PetscScalar * array;
+    VecGetArray(glo_sol, &array);
+
+    for(PetscInt ii=rstart; ii<rend; ++ii)
+      array[ii - rstart] = rows[ ii - node_start * dof_per_node ];
+
+    VecRestoreArray(glo_sol, &array);
+  }
+  else
+  {
+    PetscViewer viewer;
+    PetscViewerBinaryOpen(PETSC_COMM_WORLD, solution_file_name.c_str(), FILE_MODE_READ, &viewer);
+    VecLoad(glo_sol, viewer);
+    PetscViewerDestroy(&viewer);
+  }
+
+  PetscInt get_sol_size;
+  VecGetSize(glo_sol, &get_sol_size);
+  SYS_T::print_fatal_if( get_sol_size != vec_size,
+      "Error: PostVectScatter the solution size %d is not compatible with the size %d given by partition file! \n",
+      static_cast<int>(get_sol_size), vec_size );
+
+  VecScatterBegin(scatter, glo_sol, loc_sol, INSERT_VALUES, SCATTER_FORWARD);
+  VecScatterEnd(scatter, glo_sol, loc_sol, INSERT_VALUES, SCATTER_FORWARD);
+
+  const PetscScalar * array;
+  VecGetArrayRead(loc_sol, &array);
+
+  for(int ii=0; ii<loc_sol_size; ++ii) loc_solution[ii] = array[ii];
+
+  VecRestoreArrayRead(loc_sol, &array);
+}
+
+// EOF
@@ -16,8 +16,21 @@ PostVectSolution::PostVectSolution( const std::string &solution_file_name,
   int * analysis_old2new = new int [nFunc];
   int * postproc_new2old = new int [nFunc];
 
-  // Read the full PETSc solution vector into vec_temp
-  ReadPETSc_vec(solution_file_name, nFunc * dof_per_node, vec_temp);
+  // Read the full solution vector into vec_temp
+  if( HDF5_T::is_field_file( solution_file_name ) )
+  {
+    int file_dof = 0;
+    const std::vector<double> rows = HDF5_T::read_field_rows( solution_file_name,
+        "sol", 0, nFunc, file_dof );
+
+    SYS_T::print_fatal_if( file_dof != dof_per_node,
+        "Error: PostVectSolution the solution dof %d in %s does not match %d.\n",
+        file_dof, solution_file_name.c_str(), dof_per_node );
+
+    for(int ii=0; ii<nFunc * dof_per_node; ++ii) vec_temp[ii] = rows[ii];
+  }
+  else
+    ReadPETSc_vec(solution_file_name, nFunc * dof_per_node, vec_temp);
 
   // Read new2old and old2new mappings from HDF5 files
   ReadNodeMapping(analysis_node_mapping_file, "old_2_new", nFunc, analysis_old2new );
@@ -38,6 +51,15 @@ PostVectSolution::PostVectSolution( const std::string &solution_file_name,
   delete [] vec_temp;         vec_temp         = nullptr;
 }
 
+PostVectSolution::PostVectSolution( const std::string &solution_file_name,
+    const PostVectScatter * const &scatter )
+: dof_per_node( scatter->get_dof() ), loc_sol_size( scatter->get_solsize() )
+{
+  loc_solution = new double [loc_sol_size];
+
+  scatter -> Read( solution_file_name, loc_solution );
+}
+
 PostVectSolution::~PostVectSolution()
 {
   delete [] loc_solution; loc_solution = nullptr;
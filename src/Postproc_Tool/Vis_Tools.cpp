@@ -454,4 +454,16 @@ std::vector<int> VIS_T::read_epart( const std::string &epart_file,
   return elem_part;
 }
 
+std::string VIS_T::get_sol_name( const std::string &sol_bname,
+    const int &time, const std::string &sol_suffix )
+{
+  const std::string name = sol_bname + std::to_string( 900000000 + time );
+
+  if( sol_suffix.empty() && !SYS_T::file_exist(name)
+      && SYS_T::file_exist( name + ".h5" ) )
+    return name + ".h5";
+
+  return name + sol_suffix;
+}
+
 // EOF
@@ -0,0 +1,441 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "XDMF_Writer.hpp"
+
+namespace
+{
+  // Collect the names of the step groups in the root of a file
+  herr_t collect_step( hid_t loc_id, const char * name, const H5L_info_t * info,
+      void * op_data )
+  {
+    const std::string gname( name );
+    if( gname.compare(0, 5, "step_") == 0 )
+      static_cast< std::vector<std::string> * >(op_data) -> push_back( gname );
+    return 0;
+  }
+
+  // XDMF topology type of the element
+  std::string get_topology_type( const FEType &type )
+  {
+    switch( type )
+    {
+      case FEType::Tet4:  return "Tetrahedron";
+      case FEType::Tet10: return "Tetrahedron_10";
+      case FEType::Hex8:  return "Hexahedron";
+      case FEType::Hex27: return "Hexahedron_27";
+      case FEType::Tri3:  return "Triangle";
+      case FEType::Tri6:  return "Triangle_6";
+      case FEType::Quad4: return "Quadrilateral";
+      case FEType::Quad9: return "Quadrilateral_9";
+      default:
+        SYS_T::print_fatal("Error: XDMF_Writer does not support the element type %s.\n",
+            FE_T::to_string(type).c_str());
+        return "Unknown";
+    }
+  }
+
+  // XDMF attribute type of an array with comp components
+  std::string get_attribute_type( const int &comp )
+  {
+    switch( comp )
+    {
+      case 1:  return "Scalar";
+      case 3:  return "Vector";
+      case 6:  return "Tensor6";
+      case 9:  return "Tensor";
+      default: return "Matrix";
+    }
+  }
+}
+
+XDMF_Writer::XDMF_Writer( const std::string &in_bname,
+    const FEANode * const &fnode_ptr,
+    const ALocal_IEN * const &lien_ptr,
+    const ALocal_Elem * const &lelem_ptr,
+    const FEType &in_elemType,
+    const int &in_nlocghonode,
+    const std::vector<int> &epart_map,
+    const bool &isRestart )
+: XDMF_Writer( in_bname, in_elemType, lien_ptr->get_stride(),
+    get_xyz( fnode_ptr, in_nlocghonode ), get_ien( lien_ptr, lelem_ptr ),
+    get_cell_tag( lelem_ptr, epart_map ), isRestart )
+{}
+
+XDMF_Writer::XDMF_Writer( const std::string &in_bname,
+    const FEType &in_elemType, const int &in_nlocbas,
+    const std::vector<double> &xyz, const std::vector<int> &ien,
+    const std::vector<int> &cell_tag, const bool &isRestart )
+: bname( in_bname ), elemType( in_elemType ), nLocBas( in_nlocbas ),
+  num_node( VEC_T::get_size(xyz) / 3 ), ncell( VEC_T::get_size(ien) / in_nlocbas ),
+  rank( SYS_T::get_MPI_rank() ), size( SYS_T::get_MPI_size() ),
+  is_xmf_written( false )
+{
+  // Check the element type before any file is written
+  get_topology_type( elemType );
+
+  SYS_T::print_fatal_if( VEC_T::get_size(xyz) != 3 * num_node || VEC_T::get_size(ien) != ncell * nLocBas,
+      "Error: XDMF_Writer the geometry arrays have wrong sizes.\n" );
+
+  SYS_T::print_fatal_if( !cell_tag.empty() && VEC_T::get_size(cell_tag) != ncell,
+      "Error: XDMF_Writer the cell tag has a wrong size.\n" );
+
+  const std::string fname = bname + "_p" + std::to_string(rank) + ".h5";
+
+  if( isRestart && SYS_T::file_exist( fname ) )
+    file_id = H5Fopen( fname.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+  else
+    file_id = H5Fcreate( fname.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: XDMF_Writer cannot open %s.\n", fname.c_str() );
+
+  if( H5Lexists( file_id, "geometry", H5P_DEFAULT ) <= 0 )
+    Write_geometry( xyz, ien, cell_tag.empty() ? std::vector<int>( ncell, rank ) : cell_tag );
+
+  H5Fflush( file_id, H5F_SCOPE_GLOBAL );
+
+  if( rank == 0 )
+  {
+    rank_node.resize( size );
+    rank_cell.resize( size );
+  }
+
+  MPI_Gather( &num_node, 1, MPI_INT, rank_node.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD );
+  MPI_Gather( &ncell, 1, MPI_INT, rank_cell.data(), 1, MPI_INT, 0, PETSC_COMM_WORLD );
+
+  if( isRestart && rank == 0 ) Read_steps();
+}
+
+XDMF_Writer::~XDMF_Writer()
+{
+  H5Fclose( file_id );
+}
+
+std::vector<double> XDMF_Writer::get_xyz( const FEANode * const &fnode_ptr,
+    const int &nnode )
+{
+  std::vector<double> xyz( 3 * nnode, 0.0 );
+  for(int ii=0; ii<nnode; ++ii)
+  {
+    xyz[3*ii+0] = fnode_ptr -> get_ctrlPts_x(ii);
+    xyz[3*ii+1] = fnode_ptr -> get_ctrlPts_y(ii);
+    xyz[3*ii+2] = fnode_ptr -> get_ctrlPts_z(ii);
+  }
+  return xyz;
+}
+
+std::vector<int> XDMF_Writer::get_ien( const ALocal_IEN * const &lien_ptr,
+    const ALocal_Elem * const &lelem_ptr )
+{
+  const int nlocbas = lien_ptr -> get_stride();
+  const int nelem = lelem_ptr -> get_nlocalele();
+
+  std::vector<int> ien( nelem * nlocbas, 0 );
+  for(int ee=0; ee<nelem; ++ee)
+  {
+    for(int ii=0; ii<nlocbas; ++ii)
+      ien[ee*nlocbas + ii] = lien_ptr -> get_LIEN(ee, ii);
+  }
+  return ien;
+}
+
+std::vector<int> XDMF_Writer::get_cell_tag( const ALocal_Elem * const &lelem_ptr,
+    const std::vector<int> &epart_map )
+{
+  if( epart_map.empty() ) return {};
+
+  const int nelem = lelem_ptr -> get_nlocalele();
+
+  std::vector<int> tag( nelem, 0 );
+  for(int ee=0; ee<nelem; ++ee)
+    tag[ee] = epart_map[ lelem_ptr->get_elem_loc(ee) ];
+
+  return tag;
+}
+
+void XDMF_Writer::Write_geometry( const std::vector<double> &xyz,
+    const std::vector<int> &ien, const std::vector<int> &cell_tag ) const
+{
+  hid_t group_id = H5Gcreate( file_id, "geometry", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+  auto h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+
+  h5w -> write_doubleMatrix( group_id, "xyz", xyz, num_node, 3 );
+  h5w -> write_intMatrix( group_id, "ien", ien, ncell, nLocBas );
+  h5w -> write_intVector( group_id, "Analysis_Partition", cell_tag );
+
+  if( size > 1 )
+    h5w -> write_intVector( group_id, "PostProcess_ID", std::vector<int>( ncell, rank ) );
+
+  H5Gclose( group_id );
+}
+
+void XDMF_Writer::Read_steps()
+{
+  std::vector<std::string> names {};
+  H5Literate( file_id, H5_INDEX_NAME, H5_ITER_INC, NULL, collect_step, &names );
+
+  for( const auto &name : names )
+  {
+    hid_t group_id = H5Gopen( file_id, name.c_str(), H5P_DEFAULT );
+    hid_t dset = H5Dopen( group_id, "time", H5P_DEFAULT );
+    double time = 0.0;
+    H5Dread( dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &time );
+    H5Dclose( dset );
+    H5Gclose( group_id );
+
+    step_name.push_back( name );
+    step_time.push_back( time );
+  }
+}
+
+void XDMF_Writer::write_step( const int &time_index, const double &sol_time,
+    const IVisDataPrep * const &vdata_ptr,
+    const double * const * const &pointArrays )
+{
+  const int numDArrays = vdata_ptr -> get_arrayCompSize();
+
+  SYS_T::print_fatal_if( vdata_ptr->get_ptarray_size() != numDArrays,
+      "Error: XDMF_Writer requires the point arrays to be the visualized arrays.\n" );
+
+  std::vector<std::string> names( numDArrays );
+  std::vector<int> comps( numDArrays );
+  for(int ii=0; ii<numDArrays; ++ii)
+  {
+    names[ii] = vdata_ptr -> get_arrayNames(ii);
+    comps[ii] = vdata_ptr -> get_arraySizes(ii);
+
+    SYS_T::print_fatal_if( vdata_ptr->get_ptarray_comp_length(ii) != comps[ii],
+        "Error: XDMF_Writer the point array %d has a wrong number of components.\n", ii );
+  }
+
+  write_step( time_index, sol_time, names, comps, pointArrays );
+}
+
+void XDMF_Writer::write_step( const int &time_index, const double &sol_time,
+    const std::vector<std::string> &in_array_name,
+    const std::vector<int> &in_array_comp,
+    const double * const * const &pointArrays )
+{
+  SYS_T::print_fatal_if( in_array_name.size() != in_array_comp.size(),
+      "Error: XDMF_Writer the array names and components do not match.\n" );
+
+  array_name = in_array_name;
+  array_comp = in_array_comp;
+
+  const int numDArrays = static_cast<int>( array_name.size() );
+
+  const std::string gname = get_step_name( time_index );
+
+  // A step visualized again, e.g. after a restart, is replaced
+  if( H5Lexists( file_id, gname.c_str(), H5P_DEFAULT ) > 0 )
+    H5Ldelete( file_id, gname.c_str(), H5P_DEFAULT );
+
+  hid_t group_id = H5Gcreate( file_id, gname.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+  auto h5w = SYS_T::make_unique<HDF5_Writer>( file_id );
+
+  h5w -> write_doubleScalar( group_id, "time", sol_time );
+
+  for(int ii=0; ii<numDArrays; ++ii)
+  {
+    const std::vector<double> data( pointArrays[ii], pointArrays[ii] + num_node * array_comp[ii] );
+    h5w -> write_doubleMatrix( group_id, array_name[ii].c_str(), data, num_node, array_comp[ii] );
+  }
+
+  H5Gclose( group_id );
+
+  H5Fflush( file_id, H5F_SCOPE_GLOBAL );
+
+  // The index refers to the new step only after all ranks have written it
+  MPI_Barrier( PETSC_COMM_WORLD );
+
+  if( rank == 0 )
+  {
+    // A new step is appended to the index written by this object, which
+    // keeps the cost of a step independent of the number of steps. The
+    // index is written completely for the first step, which also indexes
+    // the steps kept for restart, and for a step written again.
+    const auto it = std::find( step_name.begin(), step_name.end(), gname );
+    if( it == step_name.end() )
+    {
+      step_name.push_back( gname );
+      step_time.push_back( sol_time );
+
+      if( is_xmf_written ) Append_xdmf( static_cast<int>(step_name.size()) - 1 );
+      else Write_xdmf();
+    }
+    else
+    {
+      step_time[ it - step_name.begin() ] = sol_time;
+      Write_xdmf();
+    }
+
+    is_xmf_written = true;
+  }
+}
+
+void XDMF_Writer::Write_xdmf() const
+{
+  // Write into a temporary file and rename it, so that a reader never sees
+  // a partial index
+  const std::string xmf_name = bname + ".xmf";
+  const std::string tmp_name = xmf_name + ".tmp";
+
+  std::ofstream xmf( tmp_name.c_str(), std::ofstream::out | std::ofstream::trunc );
+
+  SYS_T::print_fatal_if( !xmf.is_open(), "Error: XDMF_Writer cannot open %s.\n", tmp_name.c_str() );
+
+  xmf<<"<?xml version=\"1.0\" ?>\n";
+  xmf<<"<Xdmf Version=\"3.0\">\n";
+  xmf<<"  <Domain>\n";
+  xmf<<"    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+
+  for(int tt=0; tt<VEC_T::get_size(step_name); ++tt) Write_grid( xmf, tt );
+
+  xmf<<get_xmf_tail();
+
+  xmf.close();
+
+  SYS_T::print_fatal_if( xmf.fail(), "Error: XDMF_Writer failed to write %s.\n", tmp_name.c_str() );
+
+  SYS_T::print_fatal_if( std::rename( tmp_name.c_str(), xmf_name.c_str() ) != 0,
+      "Error: XDMF_Writer cannot rename %s.\n", tmp_name.c_str() );
+}
+
+void XDMF_Writer::Append_xdmf( const int &tt ) const
+{
+  const std::string xmf_name = bname + ".xmf";
+  const std::string tail = get_xmf_tail();
+  const std::streamoff tail_len = static_cast<std::streamoff>( tail.size() );
+
+  std::fstream xmf( xmf_name.c_str(), std::fstream::in | std::fstream::out | std::fstream::binary );
+
+  // The new step replaces the closing tags, which are written again after
+  // it. An index that does not end with them is written completely.
+  bool is_tail = false;
+  if( xmf.is_open() )
+  {
+    xmf.seekg( 0, std::fstream::end );
+    const std::streamoff len = xmf.tellg();
+
+    if( len >= tail_len )
+    {
+      std::string buffer( tail.size(), '\0' );
+      xmf.seekg( len - tail_len );
+      xmf.read( &buffer[0], tail_len );
+
+      is_tail = !xmf.fail() && buffer == tail;
+
+      if( is_tail ) xmf.seekp( len - tail_len );
+    }
+  }
+
+  if( !is_tail )
+  {
+    xmf.close();
+    Write_xdmf();
+    return;
+  }
+
+  Write_grid( xmf, tt );
+
+  xmf<<tail;
+
+  xmf.close();
+
+  SYS_T::print_fatal_if( xmf.fail(), "Error: XDMF_Writer failed to append to %s.\n", xmf_name.c_str() );
+}
+
+void XDMF_Writer::Write_grid( std::ostream &xmf, const int &tt ) const
+{
+  const std::string topo_type = get_topology_type( elemType );
+
+  xmf.precision(16);
+
+  xmf<<"      <Grid Name=\""<<step_name[tt]<<"\" GridType=\"Collection\" CollectionType=\"Spatial\">\n";
+  xmf<<"        <Time Value=\""<<step_time[tt]<<"\"/>\n";
+
+  for(int rr=0; rr<size; ++rr)
+  {
+    // Ranks without cells have no datasets
+    if( rank_cell[rr] == 0 ) continue;
+
+    const std::string h5_name = get_h5_name(rr);
+    const std::string node_dim = std::to_string( rank_node[rr] );
+    const std::string cell_dim = std::to_string( rank_cell[rr] );
+
+    xmf<<"        <Grid Name=\"p"<<rr<<"\" GridType=\"Uniform\">\n";
+
+    xmf<<"          <Topology TopologyType=\""<<topo_type<<"\" NumberOfElements=\""<<cell_dim<<"\">\n";
+    xmf<<"            <DataItem Dimensions=\""<<cell_dim<<" "<<nLocBas<<"\" NumberType=\"Int\" Format=\"HDF\">"
+      <<h5_name<<":/geometry/ien</DataItem>\n";
+    xmf<<"          </Topology>\n";
+
+    xmf<<"          <Geometry GeometryType=\"XYZ\">\n";
+    xmf<<"            <DataItem Dimensions=\""<<node_dim<<" 3\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">"
+      <<h5_name<<":/geometry/xyz</DataItem>\n";
+    xmf<<"          </Geometry>\n";
+
+    xmf<<"          <Attribute Name=\"Analysis_Partition\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+    xmf<<"            <DataItem Dimensions=\""<<cell_dim<<"\" NumberType=\"Int\" Format=\"HDF\">"
+      <<h5_name<<":/geometry/Analysis_Partition</DataItem>\n";
+    xmf<<"          </Attribute>\n";
+
+    if( size > 1 )
+    {
+      xmf<<"          <Attribute Name=\"PostProcess_ID\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+      xmf<<"            <DataItem Dimensions=\""<<cell_dim<<"\" NumberType=\"Int\" Format=\"HDF\">"
+        <<h5_name<<":/geometry/PostProcess_ID</DataItem>\n";
+      xmf<<"          </Attribute>\n";
+    }
+
+    for(unsigned int ii=0; ii<array_name.size(); ++ii)
+    {
+      xmf<<"          <Attribute Name=\""<<array_name[ii]<<"\" AttributeType=\""
+        <<get_attribute_type(array_comp[ii])<<"\" Center=\"Node\">\n";
+      xmf<<"            <DataItem Dimensions=\""<<node_dim<<" "<<array_comp[ii]
+        <<"\" NumberType=\"Float\" Precision=\"8\" Format=\"HDF\">"
+        <<h5_name<<":/"<<step_name[tt]<<"/"<<array_name[ii]<<"</DataItem>\n";
+      xmf<<"          </Attribute>\n";
+    }
+
+    xmf<<"        </Grid>\n";
+  }
+
+  xmf<<"      </Grid>\n";
+}
+
+std::string XDMF_Writer::get_xmf_tail()
+{
+  return "    </Grid>\n  </Domain>\n</Xdmf>\n";
+}
+
+std::string XDMF_Writer::get_h5_name( const int &rr ) const
+{
+  std::string name = bname + "_p" + std::to_string(rr) + ".h5";
+
+  // The index lies in the same directory as the HDF5 files
+  const auto pos = name.find_last_of('/');
+  if( pos != std::string::npos ) name.erase( 0, pos + 1 );
+
+  return name;
+}
+
+std::string XDMF_Writer::get_step_name( const int &time_index )
+{
+  return "step_" + std::to_string( 900000000 + time_index );
+}
+
+void XDMF_Writer::print_info() const
+{
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+  SYS_T::commPrint("XDMF_Writer: \n");
+  SYS_T::commPrint("  index file: %s.xmf \n", bname.c_str());
+  SYS_T::commPrint("  data files: %s_p<rank>.h5 \n", bname.c_str());
+  SYS_T::commPrint("  element type: %s \n", FE_T::to_string(elemType).c_str());
+  SYS_T::commPrint("  %d restart steps are indexed. \n", static_cast<int>(step_name.size()));
+  SYS_T::commPrint("----------------------------------------------------------- \n");
+}
+
+// EOF
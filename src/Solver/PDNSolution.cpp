@@ -105,8 +105,7 @@ void PDNSolution::Copy(const PDNSolution &INPUT)
   
   VecCopy(INPUT.solution, solution);
 
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::Copy(const PDNSolution * const &INPUT_ptr)
@@ -117,12 +116,12 @@ void PDNSolution::Copy(const PDNSolution * const &INPUT_ptr)
   
   VecCopy(INPUT_ptr->solution, solution);
 
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::GhostUpdate()
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_GHOST_UPDATE );
   VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
   VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
 }
@@ -151,29 +150,25 @@ double PDNSolution::Norm_inf() const
 void PDNSolution::PlusAX(const PDNSolution &x, const double &a)
 {
   VecAXPY(solution, a, x.solution);
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::PlusAX(const PDNSolution * const &x_ptr, const double &a)
 {
   VecAXPY(solution, a, x_ptr->solution);
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::PlusAX(const Vec &x, const double &a)
 {
   VecAXPY(solution, a, x);
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::ScaleValue(const double &val)
 {
   VecScale(solution, val);
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::GetLocalArray( double * const &local_array ) const
@@ -207,8 +202,7 @@ void PDNSolution::Assembly_GhostUpdate()
 {
   VecAssemblyBegin(solution);
   VecAssemblyEnd(solution);
-  VecGhostUpdateBegin(solution, INSERT_VALUES, SCATTER_FORWARD);
-  VecGhostUpdateEnd(solution, INSERT_VALUES, SCATTER_FORWARD);
+  GhostUpdate();
 }
 
 void PDNSolution::PrintWithGhost() const
@@ -232,6 +226,8 @@ void PDNSolution::PrintNoGhost() const
 
 void PDNSolution::WriteBinary(const std::string &file_name) const
 {
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
   PetscViewer viewer;
   PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
   PetscViewerSetType(viewer, PETSCVIEWERBINARY);
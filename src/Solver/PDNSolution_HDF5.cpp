@@ -0,0 +1,422 @@
+#include "PDNSolution_HDF5.hpp"
+#include "HDF5_Writer.hpp"
+#include "HDF5_Tools.hpp"
+#include <numeric>
+
+PDNSolution_HDF5::PDNSolution_HDF5(
+    const std::vector<std::string> &in_field_name,
+    const std::vector<int> &in_field_dof,
+    const std::string &node_mapping_file,
+    const int &in_chunk_nodes, const int &in_deflate_level,
+    const bool &in_is_shuffle, const int &in_lossy_digits,
+    const int &in_filter_id )
+: field_name( in_field_name ), field_dof( in_field_dof ),
+  dof( std::accumulate( in_field_dof.begin(), in_field_dof.end(), 0 ) ),
+  chunk_nodes( in_chunk_nodes ),
+  deflate_level( in_deflate_level ), is_shuffle( in_is_shuffle ),
+  lossy_digits( in_lossy_digits ), filter_id( in_filter_id ),
+  old_2_new( HDF5_T::read_intVector( node_mapping_file, "/", "old_2_new" ) ),
+  nFunc( static_cast<int>( old_2_new.size() ) )
+{
+  SYS_T::print_fatal_if( field_name.size() != field_dof.size(),
+      "Error: PDNSolution_HDF5 the field names and dofs do not match.\n" );
+
+  SYS_T::print_fatal_if( VEC_T::get_size(field_name) == 0 || nFunc == 0,
+      "Error: PDNSolution_HDF5 requires at least one field and one node.\n" );
+
+  SYS_T::print_fatal_if( chunk_nodes < 1,
+      "Error: PDNSolution_HDF5 chunk size should be positive.\n" );
+
+  SYS_T::print_fatal_if( deflate_level < 0 || deflate_level > 9,
+      "Error: PDNSolution_HDF5 deflate level should be in [0, 9].\n" );
+
+  SYS_T::print_fatal_if( lossy_digits < 0,
+      "Error: PDNSolution_HDF5 the lossy digits cannot be negative.\n" );
+
+  SYS_T::print_fatal_if( filter_id > 0 && deflate_level > 0,
+      "Error: PDNSolution_HDF5 choose either deflate or the filter plugin.\n" );
+
+  SYS_T::print_fatal_if( filter_id > 0 && H5Zfilter_avail( static_cast<H5Z_filter_t>(filter_id) ) <= 0,
+      "Error: PDNSolution_HDF5 the HDF5 filter %d is not available, check HDF5_PLUGIN_PATH.\n", filter_id );
+}
+
+void PDNSolution_HDF5::print_info() const
+{
+  SYS_T::commPrint("  HDF5 solution fields:");
+  for(int ii=0; ii<VEC_T::get_size(field_name); ++ii)
+    SYS_T::commPrint(" %s(%d)", field_name[ii].c_str(), field_dof[ii]);
+  SYS_T::commPrint("\n  HDF5 chunk nodes: %d, deflate level: %d \n", chunk_nodes, deflate_level);
+  if( filter_id > 0 ) SYS_T::commPrint("  HDF5 filter plugin id: %d \n", filter_id);
+  if( is_shuffle ) SYS_T::commPrint("  HDF5 byte shuffle: on \n");
+  if( lossy_digits > 0 )
+    SYS_T::commPrint("  HDF5 lossy scale-offset: %d decimal digits, not for restarts \n", lossy_digits);
+#ifdef H5_HAVE_PARALLEL
+  SYS_T::commPrint("  HDF5 solution files are written collectively by MPI-IO \n");
+#else
+  SYS_T::commPrint("  HDF5 solution files are written by the ranks in turn \n");
+#endif
+}
+
+void PDNSolution_HDF5::get_node_range( const PDNSolution * const &sol,
+    int &node_start, int &num_node ) const
+{
+  PetscInt vec_size, rstart, rend;
+  VecGetSize( sol->solution, &vec_size );
+  VecGetOwnershipRange( sol->solution, &rstart, &rend );
+
+  SYS_T::print_fatal_if( vec_size != static_cast<PetscInt>(nFunc) * dof,
+      "Error: PDNSolution_HDF5 the solution length does not match the node mapping and the fields.\n" );
+
+  node_start = static_cast<int>( rstart / dof );
+  num_node   = static_cast<int>( (rend - rstart) / dof );
+}
+
+hid_t PDNSolution_HDF5::Create_file( const std::string &file_name,
+    const hid_t &fapl, const std::vector<std::string> &group_name,
+    const double &time, const int &index ) const
+{
+  hid_t file_id = H5Fcreate( file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: PDNSolution_HDF5 cannot create %s.\n", file_name.c_str() );
+
+  HDF5_Writer h5w( file_id );
+  h5w.write_doubleScalar( "time", time );
+  h5w.write_intScalar( "index", index );
+  if( lossy_digits > 0 ) h5w.write_intScalar( "lossy_digits", lossy_digits );
+
+  hsize_t map_dims[1] = { static_cast<hsize_t>(nFunc) };
+  hid_t map_space = H5Screate_simple( 1, map_dims, NULL );
+  hid_t map_set = H5Dcreate( file_id, "old_2_new", H5T_NATIVE_INT, map_space,
+      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+  H5Dclose( map_set ); H5Sclose( map_space );
+
+  // Track the creation order so that the fields can be read in dof order
+  hid_t gcpl = H5Pcreate( H5P_GROUP_CREATE );
+  H5Pset_link_creation_order( gcpl, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED );
+
+  for( const auto &gname : group_name )
+  {
+    hid_t group_id = H5Gcreate( file_id, gname.c_str(), H5P_DEFAULT, gcpl, H5P_DEFAULT );
+
+    for(int ff=0; ff<VEC_T::get_size(field_name); ++ff)
+    {
+      hsize_t dims[2]  = { static_cast<hsize_t>(nFunc), static_cast<hsize_t>(field_dof[ff]) };
+      hsize_t chunk[2] = { static_cast<hsize_t>( std::min(chunk_nodes, nFunc) ), dims[1] };
+
+      hid_t dcpl = H5Pcreate( H5P_DATASET_CREATE );
+      H5Pset_chunk( dcpl, 2, chunk );
+
+      // The filters are applied in the order they are set
+      if( lossy_digits > 0 ) H5Pset_scaleoffset( dcpl, H5Z_SO_FLOAT_DSCALE, lossy_digits );
+      if( is_shuffle ) H5Pset_shuffle( dcpl );
+      if( deflate_level > 0 ) H5Pset_deflate( dcpl, deflate_level );
+      if( filter_id > 0 )
+        H5Pset_filter( dcpl, static_cast<H5Z_filter_t>(filter_id), H5Z_FLAG_MANDATORY, 0, NULL );
+
+      hid_t space = H5Screate_simple( 2, dims, NULL );
+      hid_t dset = H5Dcreate( group_id, field_name[ff].c_str(), H5T_NATIVE_DOUBLE,
+          space, H5P_DEFAULT, dcpl, H5P_DEFAULT );
+
+      H5Dclose( dset ); H5Sclose( space ); H5Pclose( dcpl );
+    }
+
+    H5Gclose( group_id );
+  }
+
+  H5Pclose( gcpl );
+
+  return file_id;
+}
+
+void PDNSolution_HDF5::Write_rows( const hid_t &file_id, const hid_t &dxpl,
+    const std::vector<std::string> &group_name,
+    const std::vector<const PDNSolution *> &sols,
+    const int &node_start, const int &num_node ) const
+{
+  // The same node range of the natural ordering is written for old_2_new
+  hsize_t map_start[1] = { static_cast<hsize_t>(node_start) };
+  hsize_t map_count[1] = { static_cast<hsize_t>(num_node) };
+
+  hid_t map_set = H5Dopen( file_id, "old_2_new", H5P_DEFAULT );
+  hid_t map_fspace = H5Dget_space( map_set );
+  hid_t map_mspace = H5Screate_simple( 1, map_count, NULL );
+  H5Sselect_hyperslab( map_fspace, H5S_SELECT_SET, map_start, NULL, map_count, NULL );
+  if( num_node == 0 ) { H5Sselect_none( map_fspace ); H5Sselect_none( map_mspace ); }
+
+  herr_t status = H5Dwrite( map_set, H5T_NATIVE_INT, map_mspace, map_fspace, dxpl,
+      old_2_new.data() + node_start );
+  SYS_T::print_fatal_if( status < 0, "Error: PDNSolution_HDF5 failed to write old_2_new.\n" );
+
+  H5Sclose( map_mspace ); H5Sclose( map_fspace ); H5Dclose( map_set );
+
+  std::vector<double> buffer;
+  for(int gg=0; gg<VEC_T::get_size(group_name); ++gg)
+  {
+    const PetscScalar * array;
+    VecGetArrayRead( sols[gg]->solution, &array );
+
+    hid_t group_id = H5Gopen( file_id, group_name[gg].c_str(), H5P_DEFAULT );
+
+    int offset = 0;
+    for(int ff=0; ff<VEC_T::get_size(field_name); ++ff)
+    {
+      const int fdof = field_dof[ff];
+
+      // Extract the components of this field from the interleaved array
+      buffer.resize( num_node * fdof );
+      for(int nn=0; nn<num_node; ++nn)
+        for(int cc=0; cc<fdof; ++cc)
+          buffer[nn*fdof + cc] = array[nn*dof + offset + cc];
+
+      hsize_t start[2] = { static_cast<hsize_t>(node_start), 0 };
+      hsize_t count[2] = { static_cast<hsize_t>(num_node), static_cast<hsize_t>(fdof) };
+
+      hid_t dset = H5Dopen( group_id, field_name[ff].c_str(), H5P_DEFAULT );
+      hid_t fspace = H5Dget_space( dset );
+      hid_t mspace = H5Screate_simple( 2, count, NULL );
+      H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, NULL, count, NULL );
+      if( num_node == 0 ) { H5Sselect_none( fspace ); H5Sselect_none( mspace ); }
+
+      status = H5Dwrite( dset, H5T_NATIVE_DOUBLE, mspace, fspace, dxpl, buffer.data() );
+      SYS_T::print_fatal_if( status < 0, "Error: PDNSolution_HDF5 failed to write %s/%s.\n", group_name[gg].c_str(), field_name[ff].c_str() );
+
+      H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+
+      offset += fdof;
+    }
+
+    H5Gclose( group_id );
+
+    VecRestoreArrayRead( sols[gg]->solution, &array );
+  }
+}
+
+void PDNSolution_HDF5::Write( const std::string &file_name,
+    const std::vector<std::string> &group_name,
+    const std::vector<const PDNSolution *> &sols,
+    const double &time, const int &index ) const
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  SYS_T::print_fatal_if( group_name.size() != sols.size(),
+      "Error: PDNSolution_HDF5::Write the group names and solutions do not match.\n" );
+
+  const double write_start = MPI_Wtime();
+
+  int node_start, num_node;
+  get_node_range( sols[0], node_start, num_node );
+
+  for( const auto &sol : sols )
+  {
+    int ns, nn;
+    get_node_range( sol, ns, nn );
+    SYS_T::print_fatal_if( ns != node_start || nn != num_node,
+        "Error: PDNSolution_HDF5::Write the solutions have different layouts.\n" );
+  }
+
+#ifdef H5_HAVE_PARALLEL
+  hid_t fapl = H5Pcreate( H5P_FILE_ACCESS );
+  H5Pset_fapl_mpio( fapl, PETSC_COMM_WORLD, MPI_INFO_NULL );
+
+  hid_t file_id = Create_file( file_name, fapl, group_name, time, index );
+
+  // Collective transfer is required for the filtered datasets
+  hid_t dxpl = H5Pcreate( H5P_DATASET_XFER );
+  H5Pset_dxpl_mpio( dxpl, H5FD_MPIO_COLLECTIVE );
+
+  Write_rows( file_id, dxpl, group_name, sols, node_start, num_node );
+
+  H5Pclose( dxpl );
+  H5Fclose( file_id );
+  H5Pclose( fapl );
+#else
+  // Without MPI-IO, rank 0 creates the file and the ranks append their
+  // rows in turn
+  const int rank = SYS_T::get_MPI_rank();
+  const int size = SYS_T::get_MPI_size();
+
+  if( rank == 0 ) H5Fclose( Create_file( file_name, H5P_DEFAULT, group_name, time, index ) );
+
+  for(int rr=0; rr<size; ++rr)
+  {
+    MPI_Barrier( PETSC_COMM_WORLD );
+
+    if( rr == rank )
+    {
+      hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDWR, H5P_DEFAULT );
+      Write_rows( file_id, H5P_DEFAULT, group_name, sols, node_start, num_node );
+      H5Fclose( file_id );
+    }
+  }
+
+  MPI_Barrier( PETSC_COMM_WORLD );
+#endif
+
+  Report( file_name, group_name, MPI_Wtime() - write_start );
+}
+
+void PDNSolution_HDF5::Report( const std::string &file_name,
+    const std::vector<std::string> &group_name, const double &write_time ) const
+{
+  const double raw_bytes = static_cast<double>( group_name.size() ) * nFunc * dof * sizeof(double);
+
+  // The stored size of the field datasets after the filters
+  double stored_bytes = 0.0;
+  if( SYS_T::get_MPI_rank() == 0 )
+  {
+    hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+    for( const auto &gname : group_name )
+    {
+      for( const auto &fname : field_name )
+      {
+        const std::string dset_name = gname + "/" + fname;
+        hid_t dset = H5Dopen( file_id, dset_name.c_str(), H5P_DEFAULT );
+        stored_bytes += static_cast<double>( H5Dget_storage_size( dset ) );
+        H5Dclose( dset );
+      }
+    }
+
+    H5Fclose( file_id );
+  }
+
+  SYS_T::commPrint("     %s: %.1f MB in %.3f s, %.1f MB/s, compression ratio %.2f \n",
+      file_name.c_str(), raw_bytes / 1.0e6, write_time,
+      raw_bytes / 1.0e6 / std::max( write_time, 1.0e-12 ),
+      raw_bytes / std::max( stored_bytes, 1.0 ) );
+}
+
+int PDNSolution_HDF5::get_lossy_digits( const std::string &file_name )
+{
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: PDNSolution_HDF5 cannot open %s.\n", file_name.c_str() );
+
+  int digits = 0;
+  if( H5Lexists( file_id, "lossy_digits", H5P_DEFAULT ) > 0 )
+  {
+    HDF5_Reader h5r( file_id );
+    digits = h5r.read_intScalar( "/", "lossy_digits" );
+  }
+
+  H5Fclose( file_id );
+
+  return digits;
+}
+
+void PDNSolution_HDF5::Read( const std::string &file_name,
+    const std::string &group_name, PDNSolution * const &sol ) const
+{
+  int node_start, num_node;
+  get_node_range( sol, node_start, num_node );
+
+  // Each rank reads its own hyperslab; the reads are independent
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: PDNSolution_HDF5 cannot open %s.\n", file_name.c_str() );
+
+  hid_t group_id = H5Gopen( file_id, group_name.c_str(), H5P_DEFAULT );
+
+  PetscScalar * array;
+  VecGetArray( sol->solution, &array );
+
+  std::vector<double> buffer;
+  int offset = 0;
+  for(int ff=0; ff<VEC_T::get_size(field_name); ++ff)
+  {
+    const int fdof = field_dof[ff];
+
+    hsize_t start[2] = { static_cast<hsize_t>(node_start), 0 };
+    hsize_t count[2] = { static_cast<hsize_t>(num_node), static_cast<hsize_t>(fdof) };
+
+    buffer.resize( num_node * fdof );
+
+    if( num_node > 0 )
+    {
+      hid_t dset = H5Dopen( group_id, field_name[ff].c_str(), H5P_DEFAULT );
+      hid_t fspace = H5Dget_space( dset );
+      hid_t mspace = H5Screate_simple( 2, count, NULL );
+      H5Sselect_hyperslab( fspace, H5S_SELECT_SET, start, NULL, count, NULL );
+
+      const herr_t status = H5Dread( dset, H5T_NATIVE_DOUBLE, mspace, fspace,
+          H5P_DEFAULT, buffer.data() );
+      SYS_T::print_fatal_if( status < 0, "Error: PDNSolution_HDF5 failed to read %s/%s.\n", group_name.c_str(), field_name[ff].c_str() );
+
+      H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+    }
+
+    for(int nn=0; nn<num_node; ++nn)
+      for(int cc=0; cc<fdof; ++cc)
+        array[nn*dof + offset + cc] = buffer[nn*fdof + cc];
+
+    offset += fdof;
+  }
+
+  VecRestoreArray( sol->solution, &array );
+
+  H5Gclose( group_id ); H5Fclose( file_id );
+
+  sol -> GhostUpdate();
+}
+
+std::vector<double> PDNSolution_HDF5::Read_nodes( const std::string &file_name,
+    const std::string &group_name, const std::string &field_name,
+    const std::vector<int> &nodes )
+{
+  const std::size_t num = nodes.size();
+
+  if( num == 0 ) return std::vector<double>();
+
+  hid_t file_id = H5Fopen( file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+
+  SYS_T::print_fatal_if( file_id < 0, "Error: PDNSolution_HDF5 cannot open %s.\n", file_name.c_str() );
+
+  // Map the natural indices to the rows of the field datasets
+  std::vector<hsize_t> coord( num );
+  for(std::size_t ii=0; ii<num; ++ii) coord[ii] = static_cast<hsize_t>( nodes[ii] );
+
+  std::vector<int> rows( num );
+  hsize_t map_count[1] = { num };
+
+  hid_t map_set = H5Dopen( file_id, "old_2_new", H5P_DEFAULT );
+  hid_t map_fspace = H5Dget_space( map_set );
+  hid_t map_mspace = H5Screate_simple( 1, map_count, NULL );
+  H5Sselect_elements( map_fspace, H5S_SELECT_SET, num, coord.data() );
+  herr_t status = H5Dread( map_set, H5T_NATIVE_INT, map_mspace, map_fspace, H5P_DEFAULT, rows.data() );
+  SYS_T::print_fatal_if( status < 0, "Error: PDNSolution_HDF5 failed to read old_2_new.\n" );
+  H5Sclose( map_mspace ); H5Sclose( map_fspace ); H5Dclose( map_set );
+
+  const std::string dset_name = group_name + "/" + field_name;
+  hid_t dset = H5Dopen( file_id, dset_name.c_str(), H5P_DEFAULT );
+  hid_t fspace = H5Dget_space( dset );
+
+  hsize_t dims[2];
+  H5Sget_simple_extent_dims( fspace, dims, NULL );
+  const hsize_t fdof = dims[1];
+
+  // Point selections keep the order of the coordinates, i.e., node major
+  coord.resize( 2 * num * fdof );
+  for(std::size_t ii=0; ii<num; ++ii)
+  {
+    for(hsize_t cc=0; cc<fdof; ++cc)
+    {
+      coord[ 2*(ii*fdof + cc) + 0 ] = static_cast<hsize_t>( rows[ii] );
+      coord[ 2*(ii*fdof + cc) + 1 ] = cc;
+    }
+  }
+
+  std::vector<double> output( num * fdof );
+  hsize_t mcount[1] = { num * fdof };
+
+  hid_t mspace = H5Screate_simple( 1, mcount, NULL );
+  H5Sselect_elements( fspace, H5S_SELECT_SET, num * fdof, coord.data() );
+  status = H5Dread( dset, H5T_NATIVE_DOUBLE, mspace, fspace, H5P_DEFAULT, output.data() );
+  SYS_T::print_fatal_if( status < 0, "Error: PDNSolution_HDF5 failed to read %s.\n", dset_name.c_str() );
+
+  H5Sclose( mspace ); H5Sclose( fspace ); H5Dclose( dset );
+  H5Fclose( file_id );
+
+  return output;
+}
+
+// EOF
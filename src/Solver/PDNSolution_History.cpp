@@ -0,0 +1,30 @@
+#include "PDNSolution_History.hpp"
+
+PDNSolution_History::PDNSolution_History( const PDNSolution * const &sample,
+    const int &in_capacity )
+: capacity( in_capacity ), head( -1 ), num_stored( 0 ),
+  snapshot( in_capacity ), snap_time( in_capacity, 0.0 )
+{
+  SYS_T::print_fatal_if( capacity < 1, "Error: PDNSolution_History capacity must be positive.\n" );
+
+  for(int ii=0; ii<capacity; ++ii)
+    snapshot[ii] = SYS_T::make_unique<PDNSolution>( sample );
+}
+
+void PDNSolution_History::Push( const PDNSolution * const &sol,
+    const double &time )
+{
+  head = (head + 1) % capacity;
+
+  snapshot[head] -> Copy( sol );
+  snap_time[head] = time;
+
+  if( num_stored < capacity ) num_stored += 1;
+}
+
+void PDNSolution_History::print_info() const
+{
+  SYS_T::commPrint("  solution history capacity: %d, stored: %d \n", capacity, num_stored);
+}
+
+// EOF
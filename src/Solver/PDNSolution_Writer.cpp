@@ -0,0 +1,127 @@
+#include "PDNSolution_Writer.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+namespace
+{
+  // The PETSc binary format is big-endian; swap the num entries of size
+  // len stored in bytes in place on a little-endian machine
+  void to_big_endian( char * const &bytes, const std::size_t &num,
+      const std::size_t &len )
+  {
+    const unsigned int one = 1;
+    if( *reinterpret_cast<const unsigned char *>(&one) == 0 ) return;
+
+    for(std::size_t ii=0; ii<num; ++ii)
+      std::reverse( bytes + ii * len, bytes + (ii + 1) * len );
+  }
+}
+
+PDNSolution_Writer::PDNSolution_Writer( const int &in_num_buffer )
+: num_buffer( in_num_buffer ), rank( SYS_T::get_MPI_rank() )
+{
+  SYS_T::print_fatal_if( num_buffer < 1, "Error: PDNSolution_Writer needs at least one staging buffer.\n" );
+
+  for(int ii=0; ii<num_buffer; ++ii)
+    idle.push_back( SYS_T::make_unique<Snapshot>() );
+}
+
+PDNSolution_Writer::~PDNSolution_Writer()
+{
+  while( !pending.empty() ) Complete_oldest();
+}
+
+void PDNSolution_Writer::Write( const PDNSolution * const &sol,
+    const std::string &file_name )
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  // Take a free staging buffer, completing the oldest write if necessary
+  if( idle.empty() ) Complete_oldest();
+
+  std::unique_ptr<Snapshot> snap = std::move( idle.back() );
+  idle.pop_back();
+
+  PetscInt vec_size, rstart, rend;
+  VecGetSize( sol->solution, &vec_size );
+  VecGetOwnershipRange( sol->solution, &rstart, &rend );
+
+  // The header is VEC_FILE_CLASSID followed by the global vector length
+  const std::size_t header_len = 2 * sizeof(PetscInt);
+  const std::size_t head = ( rank == 0 ) ? header_len : 0;
+  const std::size_t nbyte = head + static_cast<std::size_t>( rend - rstart ) * sizeof(double);
+
+  SYS_T::print_fatal_if( nbyte > static_cast<std::size_t>( INT_MAX ), "Error: PDNSolution_Writer the block of rank %d exceeds the MPI count limit.\n", rank );
+
+  snap -> file_name = file_name;
+  snap -> offset = ( rank == 0 ) ? 0 : static_cast<MPI_Offset>( header_len + rstart * sizeof(double) );
+  snap -> data.resize( nbyte );
+
+  if( rank == 0 )
+  {
+    const PetscInt header[2] = { VEC_FILE_CLASSID, vec_size };
+    std::memcpy( snap->data.data(), header, header_len );
+    to_big_endian( snap->data.data(), 2, sizeof(PetscInt) );
+  }
+
+  const PetscScalar * array;
+  VecGetArrayRead( sol->solution, &array );
+  std::memcpy( snap->data.data() + head, array, nbyte - head );
+  VecRestoreArrayRead( sol->solution, &array );
+
+  to_big_endian( snap->data.data() + head, rend - rstart, sizeof(double) );
+
+  int ierr = MPI_File_open( PETSC_COMM_WORLD, file_name.c_str(),
+      MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &snap->fh );
+
+  SYS_T::print_fatal_if( ierr != MPI_SUCCESS, "Error: PDNSolution_Writer cannot open %s.\n", file_name.c_str() );
+
+  // Cut an older and longer file of the same name to the new length
+  ierr = MPI_File_set_size( snap->fh, static_cast<MPI_Offset>( header_len + vec_size * sizeof(double) ) );
+
+  SYS_T::print_fatal_if( ierr != MPI_SUCCESS, "Error: PDNSolution_Writer cannot resize %s.\n", file_name.c_str() );
+
+  ierr = MPI_File_iwrite_at_all( snap->fh, snap->offset, snap->data.data(),
+      static_cast<int>( nbyte ), MPI_BYTE, &snap->request );
+
+  SYS_T::print_fatal_if( ierr != MPI_SUCCESS, "Error: PDNSolution_Writer cannot start writing %s.\n", file_name.c_str() );
+
+  pending.push_back( std::move(snap) );
+
+  // Drive the progress of the writes in flight
+  for(auto &pp : pending)
+  {
+    int flag;
+    MPI_Test( &pp->request, &flag, MPI_STATUS_IGNORE );
+  }
+}
+
+void PDNSolution_Writer::Flush()
+{
+  SYS_T::Perf_Scope perf_scope( SYS_T::PERF_FILE_WRITE );
+
+  while( !pending.empty() ) Complete_oldest();
+}
+
+void PDNSolution_Writer::Complete_oldest()
+{
+  std::unique_ptr<Snapshot> snap = std::move( pending.front() );
+  pending.pop_front();
+
+  const int ierr_wait = MPI_Wait( &snap->request, MPI_STATUS_IGNORE );
+
+  const int ierr_close = MPI_File_close( &snap->fh );
+
+  SYS_T::print_fatal_if( ierr_wait != MPI_SUCCESS || ierr_close != MPI_SUCCESS,
+      "Error: PDNSolution_Writer failed to write %s on rank %d.\n", snap->file_name.c_str(), rank );
+
+  idle.push_back( std::move(snap) );
+}
+
+void PDNSolution_Writer::print_info() const
+{
+  SYS_T::commPrint("  asynchronous MPI-IO solution writer with %d staging buffer(s) \n", num_buffer);
+}
+
+// EOF
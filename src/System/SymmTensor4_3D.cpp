@@ -161,6 +161,27 @@ void SymmTensor4_3D::add_OutProduct( const double &val, const SymmTensor2_3D &mm
   ten[20] += val * mmat(5) * mmat(5);
 }
 
+void SymmTensor4_3D::VoigtVecMult( const double * const &vec, double * const &out ) const
+{
+  out[0] = vec[0] * ten[0] + vec[1] * ten[1]  + vec[2] * ten[2]
+         + vec[3] * ten[3] + vec[4] * ten[4]  + vec[5] * ten[5];
+
+  out[1] = vec[0] * ten[1] + vec[1] * ten[6]  + vec[2] * ten[7]
+         + vec[3] * ten[8] + vec[4] * ten[9]  + vec[5] * ten[10];
+
+  out[2] = vec[0] * ten[2]  + vec[1] * ten[7]  + vec[2] * ten[11]
+         + vec[3] * ten[12] + vec[4] * ten[13] + vec[5] * ten[14];
+
+  out[3] = vec[0] * ten[3]  + vec[1] * ten[8]  + vec[2] * ten[12]
+         + vec[3] * ten[15] + vec[4] * ten[16] + vec[5] * ten[17];
+
+  out[4] = vec[0] * ten[4]  + vec[1] * ten[9]  + vec[2] * ten[13]
+         + vec[3] * ten[16] + vec[4] * ten[18] + vec[5] * ten[19];
+
+  out[5] = vec[0] * ten[5]  + vec[1] * ten[10] + vec[2] * ten[14]
+         + vec[3] * ten[17] + vec[4] * ten[19] + vec[5] * ten[20];
+}
+
 void SymmTensor4_3D::add_SymmOutProduct( const double &val, const Vector_3 &vec1, 
     const Vector_3 &vec2 )
 {
@@ -291,188 +312,93 @@ void SymmTensor4_3D::add_SymmOutProduct( const double &val, const SymmTensor2_3D
   ten[20] += val * ( mleft(5) * mright(5) + mleft(5) * mright(5) );
 }
 
-void SymmTensor4_3D::TenQMult( const SymmTensor4_3D &QQ )
+std::array<double,36> SymmTensor4_3D::Voigt_mat() const
 {
-  std::array<double, 21> temp = {{0.0}}; 
+  std::array<double,36> out;
+  for(int ii=0; ii<36; ++ii) out[ii] = ten[mapper[ii]];
+  return out;
+}
 
-  const int map0 = 6*map[0];
-  const int map1 = 6*map[1];
-  const int map2 = 6*map[2];
-  const int map4 = 6*map[4];
-  const int map5 = 6*map[5];
-  const int map8 = 6*map[8];
+void SymmTensor4_3D::set_congruence( const std::array<double,36> &TT,
+    const std::array<double,36> &mat )
+{
+  // LM = TT mat, with the innermost loop running over contiguous columns
+  std::array<double,36> LM {{0.0}};
+  for(int ii=0; ii<6; ++ii)
+  {
+    for(int kk=0; kk<6; ++kk)
+    {
+      const double val = TT[6*ii+kk];
+      for(int jj=0; jj<6; ++jj) LM[6*ii+jj] += val * mat[6*kk+jj];
+    }
+  }
 
-  for(int ii=0; ii<9; ++ii)
+  // ten = LM TT^T, of which only the upper triangle is needed
+  for(int ii=0; ii<6; ++ii)
   {
-    for(int jj=0; jj<9; ++jj)
+    for(int jj=ii; jj<6; ++jj)
     {
-      const int index = 6*map[ii]+map[jj];
-
-      temp[0]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map0+map[jj]]);
-      temp[1]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
-      temp[2]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[3]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
-      temp[4]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
-      temp[5]  += QQ(mapper[map0+map[ii]]) * ten[mapper[index]] * QQ(mapper[map1+map[jj]]);
-      temp[6]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
-      temp[7]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[8]  += QQ(mapper[map4+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
-      temp[9]  += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
-      temp[10] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map4+map[jj]]);
-      temp[11] += QQ(mapper[map8+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[12] += QQ(mapper[map5+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[13] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[14] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map8+map[jj]]);
-      temp[15] += QQ(mapper[map5+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
-      temp[16] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
-      temp[17] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map5+map[jj]]);
-      temp[18] += QQ(mapper[map2+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
-      temp[19] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map2+map[jj]]);
-      temp[20] += QQ(mapper[map1+map[ii]]) * ten[mapper[index]] * QQ(mapper[map1+map[jj]]);
-   }
+      double sum = 0.0;
+      for(int kk=0; kk<6; ++kk) sum += LM[6*ii+kk] * TT[6*jj+kk];
+      ten[mapper[6*ii+jj]] = sum;
+    }
   }
-  ten = temp;
 }
 
-void SymmTensor4_3D::TenPMult( const SymmTensor2_3D &C )
+void SymmTensor4_3D::TenQMult( const SymmTensor4_3D &QQ )
 {
-  const auto invC  = STen2::inverse(C);
-  
-  std::array<double, 21> temp = {{0.0}}; 
-
-  constexpr double pt33 = 1.0 / 3.0; 
-  constexpr double pt11 = 1.0 / 9.0; 
-
-  temp = ten;
-
-  for (int mm = 0; mm < 3; ++mm)
+  // The contraction over MN and ST counts each shear pair twice, which is
+  // accounted for by doubling the shear columns of QQ
+  auto TT = QQ.Voigt_mat();
+  for(int ii=0; ii<6; ++ii)
   {
-    for (int nn = 0; nn < 3; ++nn)
-    {
-      const int index_1 = map[3*mm + nn];
-      // mapper index for IJMN
-      const int map0_Ind1 = 6*map[ 0 ] + index_1; 
-      const int map4_Ind1 = 6*map[ 4 ] + index_1;
-      const int map8_Ind1 = 6*map[ 8 ] + index_1;
-      const int map5_Ind1 = 6*map[ 5 ] + index_1;
-      const int map2_Ind1 = 6*map[ 2 ] + index_1;
-      const int map1_Ind1 = 6*map[ 1 ] + index_1;
-      // mapper index for MNKL
-      const int Ind1_map0 = 6*index_1 + map[ 0 ];
-      const int Ind1_map4 = 6*index_1 + map[ 4 ];
-      const int Ind1_map8 = 6*index_1 + map[ 8 ];
-      const int Ind1_map5 = 6*index_1 + map[ 5 ];
-      const int Ind1_map2 = 6*index_1 + map[ 2 ];
-      const int Ind1_map1 = 6*index_1 + map[ 1 ];
-
-      temp[0] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 0 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map0 ] ];
-
-      temp[1] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 4 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map4 ] ];
-
-      temp[2] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
-
-      temp[3] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
-
-      temp[4] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
-
-      temp[5] -= pt33 * ten[ mapper[ map0_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-
-      temp[6] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 4 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map4 ] ];
-
-      temp[7] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
-
-      temp[8] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
-
-      temp[9] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
-
-      temp[10] -= pt33 * ten[ mapper[ map4_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-
-      temp[11] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 8 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map8 ] ];
-
-      temp[12] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
-
-      temp[13] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
-
-      temp[14] -= pt33 * ten[ mapper[ map8_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-
-      temp[15] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 5 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map5 ] ];
-
-      temp[16] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
-
-      temp[17] -= pt33 * ten[ mapper[ map5_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-
-      temp[18] -= pt33 * ten[ mapper[ map2_Ind1 ] ] * C(index_1) * invC(map[ 2 ]) + pt33 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_map2 ] ];
-
-      temp[19] -= pt33 * ten[ mapper[ map2_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-
-      temp[20] -= pt33 * ten[ mapper[ map1_Ind1 ] ] * C(index_1) * invC(map[ 1 ]) + pt33 * invC(map[ 1 ]) * C(index_1) * ten[ mapper[ Ind1_map1 ] ];
-      
-      for (int pp = 0; pp < 3; ++pp)
-      {
-        for (int qq = 0; qq < 3; ++qq)
-        {
-          const int index_2 = map[3*pp + qq];
-          // mapper index for MNPQ
-          const int Ind1_Ind2 = 6*index_1 + index_2; 
-
-          temp[0] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 0 ]);
-
-          temp[1] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 4 ]);
-
-          temp[2] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
-
-          temp[3] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
-
-          temp[4] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
-
-          temp[5] += pt11 * invC(map[ 0 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
-
-          temp[6] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 4 ]);
-
-          temp[7] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
-
-          temp[8] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
-
-          temp[9] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
-
-          temp[10] += pt11 * invC(map[ 4 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
-
-          temp[11] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 8 ]);
-
-          temp[12] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
-
-          temp[13] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
-
-          temp[14] += pt11 * invC(map[ 8 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+    TT[6*ii+3] *= 2.0;
+    TT[6*ii+4] *= 2.0;
+    TT[6*ii+5] *= 2.0;
+  }
 
-          temp[15] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 5 ]);
+  set_congruence( TT, Voigt_mat() );
+}
 
-          temp[16] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+void SymmTensor4_3D::TenPMult( const SymmTensor2_3D &C )
+{
+  const auto invC = STen2::inverse(C);
 
-          temp[17] += pt11 * invC(map[ 5 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+  // CC_IJ = ten_IJMN C_MN
+  const double C_eng[6] { C(0), C(1), C(2), 2.0 * C(3), 2.0 * C(4), 2.0 * C(5) };
+  double CC[6];
+  VoigtVecMult( C_eng, CC );
 
-          temp[18] += pt11 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 2 ]);
+  const SymmTensor2_3D ten_C( CC[0], CC[1], CC[2], CC[3], CC[4], CC[5] );
 
-          temp[19] += pt11 * invC(map[ 2 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
+  // C_MN ten_MNPQ C_PQ
+  const double C_ten_C = C_eng[0] * CC[0] + C_eng[1] * CC[1] + C_eng[2] * CC[2]
+    + C_eng[3] * CC[3] + C_eng[4] * CC[4] + C_eng[5] * CC[5];
 
-          temp[20] += pt11 * invC(map[ 1 ]) * C(index_1) * ten[ mapper[ Ind1_Ind2 ] ] * C(index_2) * invC(map[ 1 ]);
-        }
-      }
-    }
-  }
-  ten = temp;
+  add_SymmOutProduct( -1.0 / 3.0, ten_C, invC );
+  add_OutProduct( C_ten_C / 9.0, invC );
 }
 
 void SymmTensor4_3D::pull_back_stiffness( const Tensor2_3D &invF )
 {
-  auto ten4 = full();
+  // TT maps the Voigt components s_ij of a symmetric tensor to
+  // invF_Ii invF_Jj s_ij, with the shear columns summing s_ij and s_ji
+  constexpr int row[6] { 0, 1, 2, 1, 0, 0 };
+  constexpr int col[6] { 0, 1, 2, 2, 2, 1 };
 
-  ten4.MatMult_1( invF );
-  ten4.MatMult_2( invF );
-  ten4.MatMult_3( invF );
-  ten4.MatMult_4( invF );
+  std::array<double,36> TT;
+  for(int ii=0; ii<6; ++ii)
+  {
+    const int II = row[ii], JJ = col[ii];
+    TT[6*ii+0] = invF(II,0) * invF(JJ,0);
+    TT[6*ii+1] = invF(II,1) * invF(JJ,1);
+    TT[6*ii+2] = invF(II,2) * invF(JJ,2);
+    TT[6*ii+3] = invF(II,1) * invF(JJ,2) + invF(II,2) * invF(JJ,1);
+    TT[6*ii+4] = invF(II,0) * invF(JJ,2) + invF(II,2) * invF(JJ,0);
+    TT[6*ii+5] = invF(II,0) * invF(JJ,1) + invF(II,1) * invF(JJ,0);
+  }
 
-  ten = STen4::gen_symm_part(ten4).to_std_array();
+  set_congruence( TT, Voigt_mat() );
 }
 
 SymmTensor4_3D operator*( const double &val, const SymmTensor4_3D &input )
@@ -420,41 +420,54 @@ void Tensor4_3D::TenLMult( const Tensor4_3D &tleft )
 
 void Tensor4_3D::TenLRMult( const Tensor4_3D &tleft, const Tensor4_3D &tright )
 {
-  double temp[81];
+  // The product is evaluated as (tleft ten) tright, i.e., two 9 x 9 matrix
+  // products, instead of the triple sum for each entry
+  double LT[81] {0.0};
   for(int ii=0; ii<9; ++ii)
   {
-    for(int jj=0; jj<9; ++jj)
+    for(int mm=0; mm<9; ++mm)
     {
-      const int index = 9*ii+jj;
-      temp[index] = 0.0;
-      for(int mm=0; mm<9; ++mm)
-      {
-        for(int nn=0; nn<9; ++nn)
-          temp[index] += tleft(9*ii+mm) * ten[9*mm+nn] * tright(9*nn+jj);
-      }
+      const double val = tleft(9*ii+mm);
+      for(int nn=0; nn<9; ++nn) LT[9*ii+nn] += val * ten[9*mm+nn];
     }
   }
-  
+
+  double temp[81] {0.0};
+  for(int ii=0; ii<9; ++ii)
+  {
+    for(int nn=0; nn<9; ++nn)
+    {
+      const double val = LT[9*ii+nn];
+      for(int jj=0; jj<9; ++jj) temp[9*ii+jj] += val * tright(9*nn+jj);
+    }
+  }
+
   for(int ii=0; ii<81; ++ii) ten[ii] = temp[ii];
 }
 
 void Tensor4_3D::TenPMult( const Tensor4_3D &P )
 {
+  // PT = P ten, then ten = PT P^T
+  double PT[81] {0.0};
+  for(int ii=0; ii<9; ++ii)
+  {
+    for(int mm=0; mm<9; ++mm)
+    {
+      const double val = P(9*ii+mm);
+      for(int nn=0; nn<9; ++nn) PT[9*ii+nn] += val * ten[9*mm+nn];
+    }
+  }
+
   double temp[81];
   for(int ii=0; ii<9; ++ii)
   {
     for(int jj=0; jj<9; ++jj)
     {
-      const int index = 9*ii + jj;
-      temp[index] = 0.0;
-      for(int mm=0; mm<9; ++mm)
-      {
-        for(int nn=0; nn<9; ++nn)
-          temp[index] += P(9*ii+mm) * ten[9*mm+nn] * P(9*jj+nn);
-      }
+      temp[9*ii+jj] = 0.0;
+      for(int nn=0; nn<9; ++nn) temp[9*ii+jj] += PT[9*ii+nn] * P(9*jj+nn);
     }
   }
-  
+
   for(int ii=0; ii<81; ++ii) ten[ii] = temp[ii];
 }
 
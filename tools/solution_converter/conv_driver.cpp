@@ -10,19 +10,79 @@
 // run with different part files from different -cpu_size argument.
 //
 // Example:
-// ./sol_converter -old_nmap ../build_ns/node_mapping.h5 
-//                 -new_nmap ../build_ns2/node_mapping.h5 
-//                 -sol_name SOL_900000001 
+// ./sol_converter -old_nmap ../build_ns/node_mapping.h5
+//                 -new_nmap ../build_ns2/node_mapping.h5
+//                 -sol_name SOL_900000001
 //                 -out_name NEW_900000001
 //
 //  SOL_900000001 is compatible with old nmap nodes;
 //  NEW_900000001 is compatible with new nmap nodes.
 //
+// A range of time steps is converted in one run by giving -time_end:
+// mpirun -np 64 ./sol_converter -old_nmap ... -new_nmap ...
+//                 -sol_bname SOL_ -out_bname NEW_
+//                 -time_start 0 -time_step 10 -time_end 1000
+//                 -field_list disp_,velo_,pres_ -is_dot true
+//
+// converts SOL_<field>9000xxxxx and dot_SOL_<field>9000xxxxx for each
+// field in the comma separated list, which is empty for the NS solver.
+//
+// The converter runs in parallel. Each rank reads a slice of the two
+// node mappings, i.e., a range of the natural node indices, and the
+// composed permutation old_2_new -> new_2_old is stored in one
+// VecScatter per solution dof. The solution files are then loaded,
+// scattered, and written collectively, so the node mappings are read
+// only once for all files.
+//
 // Author: Ju Liu
 // Date: Mar. 13 2019
 // ==================================================================
 #include "Sys_Tools.hpp"
 #include "HDF5_Reader.hpp"
+#include <map>
+
+// Read the entries [start, start + num) of the old_2_new mapping in file
+std::vector<int> read_mapping_slice( const std::string &file,
+    const int &start, const int &num )
+{
+  hid_t file_id = H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+  hid_t dset = H5Dopen(file_id, "old_2_new", H5P_DEFAULT);
+  hid_t fspace = H5Dget_space(dset);
+
+  hsize_t offset[1] = { static_cast<hsize_t>(start) };
+  hsize_t count[1]  = { static_cast<hsize_t>(num) };
+
+  std::vector<int> slice( num, 0 );
+
+  hid_t mspace = H5Screate_simple(1, count, NULL);
+  H5Sselect_hyperslab(fspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+  if( num == 0 ) { H5Sselect_none(fspace); H5Sselect_none(mspace); }
+
+  H5Dread(dset, H5T_NATIVE_INT, mspace, fspace, H5P_DEFAULT, slice.data());
+
+  H5Sclose(mspace); H5Sclose(fspace); H5Dclose(dset);
+  H5Fclose(file_id);
+
+  return slice;
+}
+
+// Length of the old_2_new mapping in file
+int get_mapping_size( const std::string &file )
+{
+  hid_t file_id = H5Fopen(file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+
+  hid_t dset = H5Dopen(file_id, "old_2_new", H5P_DEFAULT);
+  hid_t fspace = H5Dget_space(dset);
+
+  hsize_t dims[1];
+  H5Sget_simple_extent_dims(fspace, dims, NULL);
+
+  H5Sclose(fspace); H5Dclose(dset);
+  H5Fclose(file_id);
+
+  return static_cast<int>( dims[0] );
+}
 
 int main( int argc, char * argv[] )
 {
@@ -30,112 +90,185 @@ int main( int argc, char * argv[] )
   std::string new_nmap("new_node_mapping.h5");
   std::string sol_name("SOL_900000000");
   std::string out_name("NEW_900000000");
-  
 
+  // Time step range, time_end < time_start converts sol_name only
+  std::string sol_bname("SOL_");
+  std::string out_bname("NEW_");
+  std::string field_list("");
+  int time_start = 0, time_step = 1, time_end = -1;
+  bool is_dot = true;
+
+#if PETSC_VERSION_LT(3,19,0)
   PetscInitialize(&argc, &argv, (char *)0, PETSC_NULL);
+#else
+  PetscInitialize(&argc, &argv, (char *)0, PETSC_NULLPTR);
+#endif
 
+  const PetscMPIInt rank = SYS_T::get_MPI_rank();
   const PetscMPIInt size = SYS_T::get_MPI_size();
-  
-  SYS_T::print_fatal_if(size!=1,"ERROR: converter is a serial routine! \n");
 
   SYS_T::GetOptionString("-old_nmap", old_nmap);
   SYS_T::GetOptionString("-new_nmap", new_nmap);
   SYS_T::GetOptionString("-sol_name", sol_name);
   SYS_T::GetOptionString("-out_name", out_name);
-  
-  std::cout<<"==== /Command Line Arguments ===="<<std::endl;
-  std::cout<<" -old_nmap: "<<old_nmap<<std::endl;
-  std::cout<<" -new_nmap: "<<new_nmap<<std::endl;
-  std::cout<<" -sol_name: "<<sol_name<<std::endl;
-  std::cout<<" -out_name: "<<out_name<<std::endl;
+  SYS_T::GetOptionString("-sol_bname", sol_bname);
+  SYS_T::GetOptionString("-out_bname", out_bname);
+  SYS_T::GetOptionString("-field_list", field_list);
+  SYS_T::GetOptionInt("-time_start", time_start);
+  SYS_T::GetOptionInt("-time_step", time_step);
+  SYS_T::GetOptionInt("-time_end", time_end);
+  SYS_T::GetOptionBool("-is_dot", is_dot);
 
-  SYS_T::file_check(old_nmap);
-  SYS_T::file_check(new_nmap);
-  SYS_T::file_check(sol_name);
+  SYS_T::commPrint("==== /Command Line Arguments ====\n");
+  SYS_T::cmdPrint(" -old_nmap:", old_nmap);
+  SYS_T::cmdPrint(" -new_nmap:", new_nmap);
 
-  // Obtain the new_to_old vector from the old mapping
-  hid_t h5id_onm = H5Fopen(old_nmap.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  // ===== Input and output file names =====
+  std::vector<std::string> in_files {}, out_files {};
 
-  HDF5_Reader * onm_h5r = new HDF5_Reader( h5id_onm );
+  if( time_end < time_start )
+  {
+    SYS_T::cmdPrint(" -sol_name:", sol_name);
+    SYS_T::cmdPrint(" -out_name:", out_name);
 
-  std::vector<int> old_map = onm_h5r-> read_intVector( "/", "old_2_new" );
+    in_files.push_back( sol_name );
+    out_files.push_back( out_name );
+  }
+  else
+  {
+    SYS_T::cmdPrint(" -sol_bname:", sol_bname);
+    SYS_T::cmdPrint(" -out_bname:", out_bname);
+    SYS_T::cmdPrint(" -field_list:", field_list);
+    SYS_T::cmdPrint(" -time_start:", time_start);
+    SYS_T::cmdPrint(" -time_step:", time_step);
+    SYS_T::cmdPrint(" -time_end:", time_end);
+    if( is_dot ) SYS_T::commPrint(" -is_dot: true \n");
+    else SYS_T::commPrint(" -is_dot: false \n");
 
-  delete onm_h5r; H5Fclose(h5id_onm);
+    SYS_T::print_fatal_if( time_step <= 0, "Error: time_step should be positive.\n" );
 
-  // Obtain the old_to_new vector from the new mapping
-  hid_t h5id_nnm = H5Fopen(new_nmap.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    // Middle names of the fields, an empty list means one unnamed field
+    std::vector<std::string> fields {};
+    std::istringstream iss( field_list );
+    std::string item;
+    while( std::getline(iss, item, ',') ) fields.push_back( item );
+    if( fields.empty() ) fields.push_back( "" );
 
-  HDF5_Reader * nnm_h5r = new HDF5_Reader( h5id_nnm );
+    for(int time = time_start; time <= time_end; time += time_step)
+    {
+      const std::string index = std::to_string( 900000000 + time );
+      for( const auto &field : fields )
+      {
+        in_files.push_back( sol_bname + field + index );
+        out_files.push_back( out_bname + field + index );
 
-  std::vector<int> new_map = nnm_h5r-> read_intVector( "/", "old_2_new" );
+        if( is_dot )
+        {
+          in_files.push_back( "dot_" + sol_bname + field + index );
+          out_files.push_back( "dot_" + out_bname + field + index );
+        }
+      }
+    }
+  }
+
+  SYS_T::file_check(old_nmap);
+  SYS_T::file_check(new_nmap);
 
-  delete nnm_h5r; H5Fclose(h5id_nnm);
+  // Check the length of the two mappings, if they match, we assign
+  // the length to the value of nFunc
+  const int nFunc = get_mapping_size( old_nmap );
 
-  // Check the length of the two vectors, if they match, we assign
-  // the lenght to the value of nFunc
-  SYS_T::print_fatal_if( old_map.size() != new_map.size(),
+  SYS_T::print_fatal_if( nFunc != get_mapping_size( new_nmap ),
      "Error: The two node mapping files node index lengths do not match.\n" );
 
-  const int nFunc = static_cast<int>( old_map.size() );
-
-  // Read the PETSc solution
-  Vec sol_temp;
-  VecCreate(PETSC_COMM_SELF, &sol_temp);
-  VecSetType(sol_temp, VECSEQ);
-
-  PetscViewer viewer_read;
-  PetscViewerBinaryOpen(PETSC_COMM_SELF, sol_name.c_str(), FILE_MODE_READ, &viewer_read);
-  VecLoad(sol_temp, viewer_read);
-  PetscViewerDestroy(&viewer_read);
-  
-  // Check the solution length and determine dof
-  PetscInt sol_size;
-  VecGetSize(sol_temp, &sol_size);
-  SYS_T::print_fatal_if( sol_size % nFunc != 0, 
-      "Error: Solution file is incompatible with the node mapping file. \n" );
-
-  const int dof = sol_size / nFunc;
-
-  std::cout<<"Solution node number is "<<nFunc<<" with "<<dof<<" dof(s).\n";
-
-  // Convert sol into array
-  double * sol_array = new double [sol_size];
-  double * array_temp;
-  VecGetArray(sol_temp, &array_temp);
-
-  for(int ii=0; ii<sol_size; ++ii) sol_array[ii] = array_temp[ii];
-
-  VecRestoreArray(sol_temp, &array_temp);
-  VecDestroy(&sol_temp);
-
-  // Converting index
-  Vec sol_new;
-  VecCreate(PETSC_COMM_SELF, &sol_new);
-  VecSetSizes(sol_new, PETSC_DECIDE, sol_size);
-  VecSetType(sol_new, VECSEQ);
-  
-  for(int ii=0; ii<nFunc; ++ii)
+  // ===== Slice of the natural node indices of this rank =====
+  const int node_start = static_cast<int>( static_cast<long long>(nFunc) * rank / size );
+  const int node_end   = static_cast<int>( static_cast<long long>(nFunc) * (rank + 1) / size );
+  const int num_node   = node_end - node_start;
+
+  const std::vector<int> old_map = read_mapping_slice( old_nmap, node_start, num_node );
+  const std::vector<int> new_map = read_mapping_slice( new_nmap, node_start, num_node );
+
+  SYS_T::commPrint("Node number is %d, and %d file(s) will be converted.\n",
+      nFunc, VEC_T::get_size(in_files));
+
+  // ===== Scatters of the composed permutation, one per dof =====
+  std::map<int, VecScatter> scatters {};
+
+  const double tstart = MPI_Wtime();
+
+  for(int ff=0; ff<VEC_T::get_size(in_files); ++ff)
   {
-    const int idx_old = old_map[ii];
-    const int idx_new = new_map[ii];
-    for(int jj=0; jj<dof; ++jj) VecSetValue(sol_new, idx_new*dof+jj, sol_array[idx_old*dof+jj], INSERT_VALUES );
+    SYS_T::file_check( in_files[ff] );
+
+    // Load the solution collectively
+    Vec sol_old;
+    VecCreate(PETSC_COMM_WORLD, &sol_old);
+    VecSetType(sol_old, VECMPI);
+
+    PetscViewer viewer_read;
+    PetscViewerBinaryOpen(PETSC_COMM_WORLD, in_files[ff].c_str(), FILE_MODE_READ, &viewer_read);
+    VecLoad(sol_old, viewer_read);
+    PetscViewerDestroy(&viewer_read);
+
+    // Check the solution length and determine dof
+    PetscInt sol_size;
+    VecGetSize(sol_old, &sol_size);
+    SYS_T::print_fatal_if( sol_size % nFunc != 0,
+        "Error: Solution file %s is incompatible with the node mapping file. \n", in_files[ff].c_str() );
+
+    const int dof = static_cast<int>( sol_size / nFunc );
+
+    Vec sol_new;
+    VecDuplicate(sol_old, &sol_new);
+
+    // The layout of a loaded vector depends on its size only, so the
+    // scatter of a dof is built once and reused for all files
+    if( scatters.find(dof) == scatters.end() )
+    {
+      std::vector<PetscInt> idx_from( num_node * dof ), idx_to( num_node * dof );
+      for(int ii=0; ii<num_node; ++ii)
+      {
+        for(int jj=0; jj<dof; ++jj)
+        {
+          idx_from[ii*dof + jj] = static_cast<PetscInt>( old_map[ii] ) * dof + jj;
+          idx_to[ii*dof + jj]   = static_cast<PetscInt>( new_map[ii] ) * dof + jj;
+        }
+      }
+
+      IS is_from, is_to;
+      ISCreateGeneral(PETSC_COMM_WORLD, num_node * dof, idx_from.data(), PETSC_COPY_VALUES, &is_from);
+      ISCreateGeneral(PETSC_COMM_WORLD, num_node * dof, idx_to.data(), PETSC_COPY_VALUES, &is_to);
+
+      VecScatterCreate(sol_old, is_from, sol_new, is_to, &scatters[dof]);
+
+      ISDestroy(&is_to); ISDestroy(&is_from);
+
+      SYS_T::commPrint("Scatter of the node permutation for %d dof(s) is built.\n", dof);
+    }
+
+    VecScatterBegin(scatters[dof], sol_old, sol_new, INSERT_VALUES, SCATTER_FORWARD);
+    VecScatterEnd(scatters[dof], sol_old, sol_new, INSERT_VALUES, SCATTER_FORWARD);
+
+    // Write new solution to disk
+    PetscViewer viewer;
+    PetscViewerCreate(PETSC_COMM_WORLD, &viewer);
+    PetscViewerSetType(viewer, PETSCVIEWERBINARY);
+    PetscViewerFileSetMode(viewer, FILE_MODE_WRITE);
+    PetscViewerBinarySkipInfo(viewer);
+    PetscViewerFileSetName(viewer, out_files[ff].c_str());
+    VecView(sol_new, viewer);
+    PetscViewerDestroy(&viewer);
+
+    VecDestroy(&sol_new); VecDestroy(&sol_old);
+
+    SYS_T::commPrint("  %s -> %s \n", in_files[ff].c_str(), out_files[ff].c_str());
   }
 
-  VecAssemblyBegin(sol_new); VecAssemblyEnd(sol_new);
-
-  // Write new solution to disk
-  PetscViewer viewer;
-  PetscViewerCreate(PETSC_COMM_SELF, &viewer);
-  PetscViewerSetType(viewer, PETSCVIEWERBINARY);
-  PetscViewerFileSetMode(viewer, FILE_MODE_WRITE);
-  PetscViewerBinarySkipInfo(viewer);
-  PetscViewerFileSetName(viewer, out_name.c_str());
-  VecView(sol_new, viewer);
-  PetscViewerDestroy(&viewer);
-
-  // new_array is no more needed
-  VecDestroy(&sol_new);
-  delete [] sol_array; sol_array = nullptr;
+  SYS_T::commPrint("Conversion done in %e seconds.\n", MPI_Wtime() - tstart);
+
+  for( auto &it : scatters ) VecScatterDestroy( &it.second );
+
   PetscFinalize();
   return EXIT_SUCCESS;
 }
@@ -5,8 +5,7 @@
 //
 // Date: Dec. 20 2023
 // ============================================================================
-#include "AGlobal_Mesh_Info.hpp"
-#include "APart_Basic_Info.hpp"
+#include "ANL_Tools.hpp"
 #include "ALocal_Elem.hpp"
 #include "QuadPts_Gauss_Tet.hpp"
 #include "QuadPts_Gauss_Hex.hpp"
@@ -16,6 +15,7 @@
 #include "FEAElement_Hex27.hpp"
 #include "PLocAssem_Stress_Recovery.hpp"
 #include "PGAssem_Stress_Recovery.hpp"
+#include "PGAssem_Stress_Recovery_Batch.hpp"
 #include "PLinear_Solver_PETSc.hpp"
 
 int main(int argc, char *argv[])
@@ -36,6 +36,11 @@ int main(int argc, char *argv[])
   std::string isol_bname = "SOL_disp_";
   std::string osol_bname = "SOL_Cauchy_";
 
+  // Number of time steps recovered together with one solve, 0 means one
+  // solve per time step; the batch may use the lumped mass
+  int batch_size = 0;
+  bool is_lumped_mass = false;
+
   // Yaml options
   bool is_loadYaml = true;
   std::string yaml_file("./smooth.yml");
@@ -68,6 +73,8 @@ int main(int argc, char *argv[])
   SYS_T::GetOptionInt("-time_end", time_end);
   SYS_T::GetOptionString("-isol_bname", isol_bname);
   SYS_T::GetOptionString("-osol_bname", osol_bname);
+  SYS_T::GetOptionInt("-batch_size", batch_size);
+  SYS_T::GetOptionBool("-is_lumped_mass", is_lumped_mass);
 
   // Print arguments
   SYS_T::cmdPrint("-nqp_vol:", nqp_vol);
@@ -79,6 +86,12 @@ int main(int argc, char *argv[])
   SYS_T::cmdPrint("-time_end", time_end);
   SYS_T::cmdPrint("-isol_bname", isol_bname);
   SYS_T::cmdPrint("-osol_bname", osol_bname);
+  SYS_T::cmdPrint("-batch_size:", batch_size);
+  if( batch_size > 0 )
+  {
+    if( is_lumped_mass ) SYS_T::commPrint("-is_lumped_mass: true \n");
+    else SYS_T::commPrint("-is_lumped_mass: false \n");
+  }
 
   MPI_Barrier(PETSC_COMM_WORLD);
 
@@ -86,17 +99,13 @@ int main(int argc, char *argv[])
 
   ALocal_IEN * locIEN = new ALocal_IEN(part_file, rank);
 
-  AGlobal_Mesh_Info * GMIptr = new AGlobal_Mesh_Info(part_file, rank);
-
-  APart_Basic_Info * PartBasic = new APart_Basic_Info(part_file, rank);
-
   ALocal_Elem * locElem = new ALocal_Elem(part_file, rank);
 
   APart_Node * pNode = new APart_Node(part_file, rank);
 
   SYS_T::commPrint("===> Data from HDF5 files are read from disk.\n");
 
-  SYS_T::print_fatal_if( size != PartBasic->get_cpu_size(),
+  SYS_T::print_fatal_if( size != ANL_T::get_cpu_size(part_file, rank),
       "Error: Assigned CPU number does not match the partition. \n");
   
   SYS_T::commPrint("===> %d processor(s) are assigned for solution smoother.\n", size);
@@ -104,31 +113,33 @@ int main(int argc, char *argv[])
   // Finite element container & Quadrature rules
   SYS_T::commPrint("===> Setup element container. \n");
   SYS_T::commPrint("===> Build quadrature rules. \n");
+  const FEType elemType = ANL_T::get_elemType(part_file, rank);
+
   FEAElement * elementv = nullptr;
   IQuadPts * quadv = nullptr;
 
-  if( GMIptr->get_elemType() == FEType::Tet4 )
+  if( elemType == FEType::Tet4 )
   {
     if( nqp_vol > 5 ) SYS_T::commPrint("Warning: the tet element is linear and you are using more than 5 quadrature points.\n");
     
     elementv = new FEAElement_Tet4( nqp_vol ); // elem type Tet4
     quadv = new QuadPts_Gauss_Tet( nqp_vol );
   }
-  else if( GMIptr->get_elemType() == FEType::Tet10 )
+  else if( elemType == FEType::Tet10 )
   {
     SYS_T::print_fatal_if( nqp_vol < 29, "Error: not enough quadrature points for tets.\n" );
 
     elementv = new FEAElement_Tet10( nqp_vol ); // elem type Tet10
     quadv = new QuadPts_Gauss_Tet( nqp_vol );
   }
-  else if( GMIptr->get_elemType() == FEType::Hex8 )
+  else if( elemType == FEType::Hex8 )
   {
     SYS_T::print_fatal_if( nqp_vol_1D < 2, "Error: not enough quadrature points for hex.\n" );
   
     elementv = new FEAElement_Hex8( nqp_vol_1D * nqp_vol_1D * nqp_vol_1D ); // elem type Hex8
     quadv = new QuadPts_Gauss_Hex( nqp_vol_1D );
   }
-  else if( GMIptr->get_elemType() == FEType::Hex27 )
+  else if( elemType == FEType::Hex27 )
   {
     SYS_T::print_fatal_if( nqp_vol_1D < 4, "Error: not enough quadrature points for hex.\n" );
   
@@ -153,64 +164,132 @@ int main(int argc, char *argv[])
   const double in_nu = 0.3;
   
   // Local assembly routine
-  IPLocAssem * locAssem_ptr = new PLocAssem_Stress_Recovery(elementv->get_nLocBas(), in_nu, in_module);
-
-  // Global assembly
-  SYS_T::commPrint("===> Initializing Mat K and Vec G ... \n");
-  IPGAssem * gloAssem_ptr = new PGAssem_Stress_Recovery( locAssem_ptr,
-      GMIptr, locElem, locIEN, pNode, nz_estimate );
-  
-  SYS_T::commPrint("===> Assembly nonzero estimate matrix ... \n");
-  gloAssem_ptr->Assem_nonzero_estimate( locElem, locAssem_ptr, locIEN, pNode );
-  // MatView(gloAssem_ptr->K, PETSC_VIEWER_STDOUT_WORLD);
-
-  SYS_T::commPrint("===> Matrix nonzero structure fixed. \n");
-  gloAssem_ptr->Fix_nonzero_err_str();
-  gloAssem_ptr->Clear_KG();
+  PLocAssem_Stress_Recovery * locAssem_ptr = new PLocAssem_Stress_Recovery(elementv->get_nLocBas(), in_nu, in_module);
 
   // Linear solver
   PLinear_Solver_PETSc * lsolver_ptr = new PLinear_Solver_PETSc();
 
-  // Smooth the solutions
-  // Assemble mass matrix
-  gloAssem_ptr->Assem_mass_residual(disp, locElem, locAssem_ptr, elementv, quadv, locIEN, fNode, pNode);
+  if( batch_size > 0 )
+  {
+    // Recover the stress of batch_size time steps with one assembly and one
+    // block solve using the scalar mass matrix
+    PGAssem_Stress_Recovery_Batch * batchAssem_ptr = new PGAssem_Stress_Recovery_Batch(
+        batch_size, is_lumped_mass, elementv->get_nLocBas(), pNode, nz_estimate );
+
+    batchAssem_ptr -> print_info();
+
+    batchAssem_ptr -> Assem_mass( locElem, locAssem_ptr, elementv, quadv, locIEN, fNode, pNode );
+
+    if( !is_lumped_mass ) lsolver_ptr->SetOperator( batchAssem_ptr->M );
+
+    std::vector<PDNSolution *> disp_batch( batch_size, nullptr ), stress_batch( batch_size, nullptr );
+    for(int ss=0; ss<batch_size; ++ss)
+    {
+      disp_batch[ss] = new PDNSolution( pNode, 3 );
+      stress_batch[ss] = new PDNSolution( pNode, 6 );
+    }
+
+    std::vector<int> time_list {};
+    for(int time = time_start; time<=time_end; time+=time_step) time_list.push_back( time );
+
+    for(int first = 0; first < VEC_T::get_size(time_list); first += batch_size)
+    {
+      const int nsol = std::min( batch_size, VEC_T::get_size(time_list) - first );
+
+      for(int ss=0; ss<nsol; ++ss)
+      {
+        const std::string name_to_read = isol_bname + std::to_string( 900000000 + time_list[first+ss] );
 
-  lsolver_ptr->SetOperator( gloAssem_ptr->K );
+        SYS_T::commPrint("Time %d: Read %s \n", time_list[first+ss], name_to_read.c_str() );
 
-  // Smooth 
-  for(int time = time_start; time<=time_end; time+=time_step)
+        disp_batch[ss] -> ReadBinary( name_to_read );
+      }
+
+      batchAssem_ptr -> Assem_residual( nsol, disp_batch, locElem, locAssem_ptr,
+          elementv, quadv, locIEN, fNode, pNode );
+
+      batchAssem_ptr -> Solve( lsolver_ptr, nsol, stress_batch, pNode );
+
+      for(int ss=0; ss<nsol; ++ss)
+      {
+        const std::string name_to_write = osol_bname + std::to_string( 900000000 + time_list[first+ss] );
+
+        SYS_T::commPrint("Time %d: Write %s \n", time_list[first+ss], name_to_write.c_str() );
+
+        stress_batch[ss] -> WriteBinary( name_to_write );
+      }
+
+      SYS_T::commPrint("\n" );
+    }
+
+    for(int ss=0; ss<batch_size; ++ss)
+    {
+      delete disp_batch[ss]; delete stress_batch[ss];
+    }
+
+    // Print complete solver info
+    if( !is_lumped_mass ) lsolver_ptr -> print_info();
+
+    delete batchAssem_ptr;
+  }
+  else
   {
-    std::ostringstream time_index;
-    std::string name_to_read(isol_bname);
-    time_index.str("");
-    time_index<< 900000000 + time;
-    name_to_read.append(time_index.str());
+    // Global assembly
+    SYS_T::commPrint("===> Initializing Mat K and Vec G ... \n");
+    PGAssem_Stress_Recovery * gloAssem_ptr = new PGAssem_Stress_Recovery( locAssem_ptr,
+        elementv->get_nLocBas(), locElem, locIEN, pNode, nz_estimate );
+  
+    SYS_T::commPrint("===> Assembly nonzero estimate matrix ... \n");
+    gloAssem_ptr->Assem_nonzero_estimate( locElem, locAssem_ptr, locIEN, pNode );
+    // MatView(gloAssem_ptr->K, PETSC_VIEWER_STDOUT_WORLD);
+
+    SYS_T::commPrint("===> Matrix nonzero structure fixed. \n");
+    gloAssem_ptr->Fix_nonzero_err_str();
+    gloAssem_ptr->Clear_KG();
+
+    // Smooth the solutions
+    // Assemble mass matrix
+    gloAssem_ptr->Assem_mass_residual(disp, locElem, locAssem_ptr, elementv, quadv, locIEN, fNode, pNode);
+
+    lsolver_ptr->SetOperator( gloAssem_ptr->K );
+
+    // Smooth 
+    for(int time = time_start; time<=time_end; time+=time_step)
+    {
+      std::ostringstream time_index;
+      std::string name_to_read(isol_bname);
+      time_index.str("");
+      time_index<< 900000000 + time;
+      name_to_read.append(time_index.str());
+
+      std::string name_to_write(osol_bname);
+      time_index.str("");
+      time_index<< 900000000 + time;
+      name_to_write.append(time_index.str());
 
-    std::string name_to_write(osol_bname);
-    time_index.str("");
-    time_index<< 900000000 + time;
-    name_to_write.append(time_index.str());
+      SYS_T::commPrint("Time %d: Read %s and Write %s \n",
+          time, name_to_read.c_str(), name_to_write.c_str() );
 
-    SYS_T::commPrint("Time %d: Read %s and Write %s \n",
-        time, name_to_read.c_str(), name_to_write.c_str() );
+      disp->ReadBinary(name_to_read);
 
-    disp->ReadBinary(name_to_read);
+      gloAssem_ptr->Clear_G();
 
-    gloAssem_ptr->Clear_G();
+      gloAssem_ptr->Assem_residual(disp, locElem, locAssem_ptr, elementv, quadv, locIEN, fNode, pNode);
 
-    gloAssem_ptr->Assem_residual(disp, locElem, locAssem_ptr, elementv, quadv, locIEN, fNode, pNode);
+      lsolver_ptr->Solve( gloAssem_ptr->G, stress );
 
-    lsolver_ptr->Solve( gloAssem_ptr->G, stress );
+      stress->WriteBinary(name_to_write);
 
-    stress->WriteBinary(name_to_write);
+      SYS_T::commPrint("\n" );
+    }
+    // Print complete solver info
+    lsolver_ptr -> print_info();
 
-    SYS_T::commPrint("\n" );
+    delete gloAssem_ptr;
   }
-  // Print complete solver info
-  lsolver_ptr -> print_info();
 
-  delete lsolver_ptr; delete gloAssem_ptr; delete locAssem_ptr; delete disp; delete stress;
-  delete fNode; delete locIEN; delete GMIptr; delete locElem; delete pNode; delete PartBasic;
+  delete lsolver_ptr; delete locAssem_ptr; delete disp; delete stress;
+  delete fNode; delete locIEN; delete locElem; delete pNode;
   delete quadv; delete elementv;
   PetscFinalize();
   return EXIT_SUCCESS;
@@ -3,14 +3,17 @@
 
 #include "IPGAssem.hpp"
 #include "PETSc_Tools.hpp"
+#include "ALocal_Elem.hpp"
+#include "ALocal_IEN.hpp"
+#include "PLocAssem_Stress_Recovery.hpp"
 
 class PGAssem_Stress_Recovery : public IPGAssem
 {
   public:
     // Constructor
     PGAssem_Stress_Recovery(
-        IPLocAssem * const &locassem_ptr,
-        const AGlobal_Mesh_Info * const &agmi_ptr,
+        PLocAssem_Stress_Recovery * const &locassem_ptr,
+        const int &in_nlocbas,
         const ALocal_Elem * const &alelem_ptr,
         const ALocal_IEN * const &aien_ptr,
         const APart_Node * const &pnode_ptr,
@@ -20,17 +23,17 @@ class PGAssem_Stress_Recovery : public IPGAssem
     virtual ~PGAssem_Stress_Recovery();
 
     // Nonzero pattern estimate
-    virtual void Assem_nonzero_estimate(
+    void Assem_nonzero_estimate(
         const ALocal_Elem * const &alelem_ptr,
-        IPLocAssem * const &lassem_ptr,
+        PLocAssem_Stress_Recovery * const &lassem_ptr,
         const ALocal_IEN * const &lien_ptr,
         const APart_Node * const &pnode_ptr );
     
     // Assembly the residual vector
-    virtual void Assem_residual(
+    void Assem_residual(
         const PDNSolution * const &isol,
         const ALocal_Elem * const &alelem_ptr,
-        IPLocAssem * const &lassem_ptr,
+        PLocAssem_Stress_Recovery * const &lassem_ptr,
         FEAElement * const &elementv,
         const IQuadPts * const &quad_v,
         const ALocal_IEN * const &lien_ptr,
@@ -38,10 +41,10 @@ class PGAssem_Stress_Recovery : public IPGAssem
         const APart_Node * const &pnode_ptr );
     
     // Assembly the residual and mass matrix
-    virtual void Assem_mass_residual(
+    void Assem_mass_residual(
         const PDNSolution * const &isol,
         const ALocal_Elem * const &alelem_ptr,
-        IPLocAssem * const &lassem_ptr,
+        PLocAssem_Stress_Recovery * const &lassem_ptr,
         FEAElement * const &elementv,
         const IQuadPts * const &quad_v,
         const ALocal_IEN * const &lien_ptr,
@@ -0,0 +1,90 @@
+#ifndef PGASSEM_STRESS_RECOVERY_BATCH_HPP
+#define PGASSEM_STRESS_RECOVERY_BATCH_HPP
+// ============================================================================
+// PGAssem_Stress_Recovery_Batch.hpp
+//
+// Global assembly of the stress recovery for a batch of time steps.
+//
+// The L2 projection mass matrix is identical for the six stress components,
+// so only the scalar mass matrix M with one row per node is assembled, once.
+// The right-hand sides of nsnap snapshots are assembled in one element loop
+// into the vector G, with 6 nsnap entries per node, and copied into the
+// dense matrix B with one column per snapshot and component. The batch is
+// solved by M X = B with the factorization or preconditioner of M set up
+// once, or by the HRZ lumped mass as a fast option.
+//
+// Date: Oct. 19 2026
+// ============================================================================
+#include "PDNSolution.hpp"
+#include "ALocal_Elem.hpp"
+#include "ALocal_IEN.hpp"
+#include "FEANode.hpp"
+#include "PLocAssem_Stress_Recovery.hpp"
+#include "PLinear_Solver_PETSc.hpp"
+
+class PGAssem_Stress_Recovery_Batch
+{
+  public:
+    // Scalar mass matrix
+    Mat M;
+
+    PGAssem_Stress_Recovery_Batch( const int &in_nsnap,
+        const bool &in_is_lumped, const int &in_nlocbas,
+        const APart_Node * const &pnode_ptr,
+        const int &in_nz_estimate = 60 );
+
+    ~PGAssem_Stress_Recovery_Batch();
+
+    // ------------------------------------------------------------------------
+    // ! Assemble the scalar mass matrix M and its lumped diagonal
+    // ------------------------------------------------------------------------
+    void Assem_mass( const ALocal_Elem * const &alelem_ptr,
+        const PLocAssem_Stress_Recovery * const &lassem_ptr,
+        FEAElement * const &elementv,
+        const IQuadPts * const &quad_v,
+        const ALocal_IEN * const &lien_ptr,
+        const FEANode * const &fnode_ptr,
+        const APart_Node * const &pnode_ptr );
+
+    // ------------------------------------------------------------------------
+    // ! Assemble the right-hand sides of the first nsol <= nsnap
+    //   displacements in disp, with the remaining columns set zero
+    // ------------------------------------------------------------------------
+    void Assem_residual( const int &nsol,
+        const std::vector<PDNSolution *> &disp,
+        const ALocal_Elem * const &alelem_ptr,
+        const PLocAssem_Stress_Recovery * const &lassem_ptr,
+        FEAElement * const &elementv,
+        const IQuadPts * const &quad_v,
+        const ALocal_IEN * const &lien_ptr,
+        const FEANode * const &fnode_ptr,
+        const APart_Node * const &pnode_ptr );
+
+    // ------------------------------------------------------------------------
+    // ! Solve the batch and write the stresses of the first nsol snapshots
+    //   into stress. lsolver has to be set with the operator M, and it is
+    //   not used for the lumped mass.
+    // ------------------------------------------------------------------------
+    void Solve( PLinear_Solver_PETSc * const &lsolver, const int &nsol,
+        const std::vector<PDNSolution *> &stress,
+        const APart_Node * const &pnode_ptr );
+
+    bool is_lumped() const {return is_lumped_mass;}
+
+    void print_info() const;
+
+  private:
+    const int nsnap, ncol, nLocBas, nlocalnode, nlgn;
+
+    const bool is_lumped_mass;
+
+    // the global index of the first local node
+    PetscInt node_start;
+
+    // Right-hand sides with ncol = 6 nsnap entries per node, the lumped mass,
+    // and the dense right-hand side and solution matrices
+    Vec G, M_lumped;
+    Mat B, X;
+};
+
+#endif
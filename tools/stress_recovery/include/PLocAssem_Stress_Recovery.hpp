@@ -21,6 +21,11 @@ class PLocAssem_Stress_Recovery : public IPLocAssem
 
     int get_dof() const { return 6; }
 
+    int get_nLocBas() const { return nLocBas; }
+
+    // There is no surface integral in the stress recovery
+    int get_snLocBas() const { return 0; }
+
     virtual void Zero_Residual()
     {
       for(int ii=0; ii<vec_size; ++ii) Residual[ii] = 0.0;
@@ -52,6 +57,33 @@ class PLocAssem_Stress_Recovery : public IPLocAssem
         const double * const &eleCtrlPts_y,
         const double * const &eleCtrlPts_z,
         const IQuadPts * const &quad );
+
+    // ------------------------------------------------------------------------
+    // ! Assemble the residuals of nsnap displacement snapshots with one basis
+    //   evaluation. isol has length nsnap x 3 nLocBas with the snapshots
+    //   stored one after another. The output residual has length
+    //   nLocBas x 6 nsnap, ordered by node, snapshot, and stress component.
+    // ------------------------------------------------------------------------
+    void Assem_Residual_Batch( const int &nsnap,
+        const double * const &isol,
+        FEAElement * const &element,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z,
+        const IQuadPts * const &quad,
+        double * const &residual ) const;
+
+    // ------------------------------------------------------------------------
+    // ! Assemble the scalar mass matrix of length nLocBas x nLocBas, shared
+    //   by all stress components, and its HRZ lumped diagonal of length
+    //   nLocBas, which stays positive for the quadratic elements.
+    // ------------------------------------------------------------------------
+    void Assem_Mass_Scalar( FEAElement * const &element,
+        const double * const &eleCtrlPts_x,
+        const double * const &eleCtrlPts_y,
+        const double * const &eleCtrlPts_z,
+        const IQuadPts * const &quad,
+        double * const &mass, double * const &lumped_mass ) const;
     
   private:
     const int nLocBas, vec_size;
@@ -1,13 +1,13 @@
 #include "PGAssem_Stress_Recovery.hpp"
 
 PGAssem_Stress_Recovery::PGAssem_Stress_Recovery(
-    IPLocAssem * const &locassem_ptr,
-    const AGlobal_Mesh_Info * const &agmi_ptr,
+    PLocAssem_Stress_Recovery * const &locassem_ptr,
+    const int &in_nlocbas,
     const ALocal_Elem * const &alelem_ptr,
     const ALocal_IEN * const &aien_ptr,
     const APart_Node * const &pnode_ptr,
     const int &in_nz_estimate )
-: nLocBas( agmi_ptr->get_nLocBas() ), nlgn( pnode_ptr->get_nlocghonode() )
+: nLocBas( in_nlocbas ), nlgn( pnode_ptr->get_nlocghonode() )
 {
   const int nlocrow = 6 * pnode_ptr -> get_nlocalnode();
 
@@ -47,7 +47,7 @@ PGAssem_Stress_Recovery::~PGAssem_Stress_Recovery()
 
 void PGAssem_Stress_Recovery::Assem_nonzero_estimate(
     const ALocal_Elem * const &alelem_ptr,
-    IPLocAssem * const &lassem_ptr,
+    PLocAssem_Stress_Recovery * const &lassem_ptr,
     const ALocal_IEN * const &lien_ptr,
     const APart_Node * const &pnode_ptr )
 {
@@ -81,7 +81,7 @@ void PGAssem_Stress_Recovery::Assem_nonzero_estimate(
 void PGAssem_Stress_Recovery::Assem_residual(
     const PDNSolution * const &isol,
     const ALocal_Elem * const &alelem_ptr,
-    IPLocAssem * const &lassem_ptr,
+    PLocAssem_Stress_Recovery * const &lassem_ptr,
     FEAElement * const &elementv,
     const IQuadPts * const &quad_v,
     const ALocal_IEN * const &lien_ptr,
@@ -133,7 +133,7 @@ void PGAssem_Stress_Recovery::Assem_residual(
 void PGAssem_Stress_Recovery::Assem_mass_residual(
     const PDNSolution * const &isol,
     const ALocal_Elem * const &alelem_ptr,
-    IPLocAssem * const &lassem_ptr,
+    PLocAssem_Stress_Recovery * const &lassem_ptr,
     FEAElement * const &elementv,
     const IQuadPts * const &quad_v,
     const ALocal_IEN * const &lien_ptr,
@@ -0,0 +1,254 @@
+#include "PGAssem_Stress_Recovery_Batch.hpp"
+
+PGAssem_Stress_Recovery_Batch::PGAssem_Stress_Recovery_Batch(
+    const int &in_nsnap, const bool &in_is_lumped, const int &in_nlocbas,
+    const APart_Node * const &pnode_ptr, const int &in_nz_estimate )
+: nsnap( in_nsnap ), ncol( 6 * in_nsnap ), nLocBas( in_nlocbas ),
+  nlocalnode( pnode_ptr->get_nlocalnode() ),
+  nlgn( pnode_ptr->get_nlocghonode() ), is_lumped_mass( in_is_lumped )
+{
+  SYS_T::print_fatal_if( nsnap <= 0, "Error: PGAssem_Stress_Recovery_Batch the batch size should be positive.\n" );
+
+  MatCreateAIJ(PETSC_COMM_WORLD, nlocalnode, nlocalnode, PETSC_DETERMINE,
+      PETSC_DETERMINE, in_nz_estimate, NULL, in_nz_estimate, NULL, &M);
+  MatSetOption(M, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_FALSE);
+
+  VecCreateMPI(PETSC_COMM_WORLD, nlocalnode, PETSC_DETERMINE, &M_lumped);
+  VecSet(M_lumped, 0.0);
+
+  PetscInt node_end;
+  VecGetOwnershipRange(M_lumped, &node_start, &node_end);
+
+  VecCreateMPI(PETSC_COMM_WORLD, nlocalnode * ncol, PETSC_DETERMINE, &G);
+  VecSet(G, 0.0);
+
+  MatCreateDense(PETSC_COMM_WORLD, nlocalnode, PETSC_DECIDE, PETSC_DETERMINE,
+      ncol, NULL, &B);
+  MatCreateDense(PETSC_COMM_WORLD, nlocalnode, PETSC_DECIDE, PETSC_DETERMINE,
+      ncol, NULL, &X);
+}
+
+PGAssem_Stress_Recovery_Batch::~PGAssem_Stress_Recovery_Batch()
+{
+  MatDestroy(&X);
+  MatDestroy(&B);
+  VecDestroy(&G);
+  VecDestroy(&M_lumped);
+  MatDestroy(&M);
+}
+
+void PGAssem_Stress_Recovery_Batch::Assem_mass(
+    const ALocal_Elem * const &alelem_ptr,
+    const PLocAssem_Stress_Recovery * const &lassem_ptr,
+    FEAElement * const &elementv,
+    const IQuadPts * const &quad_v,
+    const ALocal_IEN * const &lien_ptr,
+    const FEANode * const &fnode_ptr,
+    const APart_Node * const &pnode_ptr )
+{
+  const int nElem = alelem_ptr->get_nlocalele();
+
+  std::vector<int> IEN_e( nLocBas, 0 );
+  std::vector<double> ectrl_x( nLocBas, 0.0 ), ectrl_y( nLocBas, 0.0 ), ectrl_z( nLocBas, 0.0 );
+  std::vector<double> mass( nLocBas * nLocBas, 0.0 ), lumped_mass( nLocBas, 0.0 );
+  std::vector<PetscInt> row_index( nLocBas, 0 );
+
+  MatZeroEntries(M);
+  VecSet(M_lumped, 0.0);
+
+  for(int ee=0; ee<nElem; ++ee)
+  {
+    lien_ptr->get_LIEN(ee, &IEN_e[0]);
+
+    fnode_ptr->get_ctrlPts_xyz(nLocBas, &IEN_e[0], &ectrl_x[0], &ectrl_y[0], &ectrl_z[0]);
+
+    lassem_ptr->Assem_Mass_Scalar( elementv, &ectrl_x[0], &ectrl_y[0], &ectrl_z[0],
+        quad_v, &mass[0], &lumped_mass[0] );
+
+    for(int ii=0; ii<nLocBas; ++ii)
+      row_index[ii] = pnode_ptr->get_local_to_global(IEN_e[ii]);
+
+    if( !is_lumped_mass )
+      MatSetValues(M, nLocBas, &row_index[0], nLocBas, &row_index[0], &mass[0], ADD_VALUES);
+
+    VecSetValues(M_lumped, nLocBas, &row_index[0], &lumped_mass[0], ADD_VALUES);
+  }
+
+  VecAssemblyBegin(M_lumped);
+  VecAssemblyEnd(M_lumped);
+
+  MatAssemblyBegin(M, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(M, MAT_FINAL_ASSEMBLY);
+}
+
+void PGAssem_Stress_Recovery_Batch::Assem_residual( const int &nsol,
+    const std::vector<PDNSolution *> &disp,
+    const ALocal_Elem * const &alelem_ptr,
+    const PLocAssem_Stress_Recovery * const &lassem_ptr,
+    FEAElement * const &elementv,
+    const IQuadPts * const &quad_v,
+    const ALocal_IEN * const &lien_ptr,
+    const FEANode * const &fnode_ptr,
+    const APart_Node * const &pnode_ptr )
+{
+  SYS_T::print_fatal_if( nsol > nsnap || nsol > VEC_T::get_size(disp),
+      "Error: PGAssem_Stress_Recovery_Batch the number of solutions exceeds the batch size.\n" );
+
+  const int nElem = alelem_ptr->get_nlocalele();
+
+  // Local arrays of all snapshots, stored one after another
+  std::vector<double> array_a( nsol * nlgn * 3, 0.0 );
+  for(int ss=0; ss<nsol; ++ss)
+    disp[ss] -> GetLocalArray( &array_a[ss * nlgn * 3] );
+
+  std::vector<double> local_a( nsol * nLocBas * 3, 0.0 );
+  std::vector<int> IEN_e( nLocBas, 0 );
+  std::vector<double> ectrl_x( nLocBas, 0.0 ), ectrl_y( nLocBas, 0.0 ), ectrl_z( nLocBas, 0.0 );
+  std::vector<double> residual( nLocBas * 6 * nsol, 0.0 );
+  std::vector<PetscInt> row_index( nLocBas * 6 * nsol, 0 );
+
+  VecSet(G, 0.0);
+
+  for(int ee=0; ee<nElem; ++ee)
+  {
+    lien_ptr->get_LIEN(ee, &IEN_e[0]);
+
+    for(int ss=0; ss<nsol; ++ss)
+    {
+      for(int ii=0; ii<nLocBas; ++ii)
+      {
+        for(int jj=0; jj<3; ++jj)
+          local_a[ss * nLocBas * 3 + ii * 3 + jj] = array_a[ss * nlgn * 3 + IEN_e[ii] * 3 + jj];
+      }
+    }
+
+    fnode_ptr->get_ctrlPts_xyz(nLocBas, &IEN_e[0], &ectrl_x[0], &ectrl_y[0], &ectrl_z[0]);
+
+    lassem_ptr->Assem_Residual_Batch( nsol, &local_a[0], elementv, &ectrl_x[0],
+        &ectrl_y[0], &ectrl_z[0], quad_v, &residual[0] );
+
+    for(int ii=0; ii<nLocBas; ++ii)
+    {
+      const int gid = pnode_ptr->get_local_to_global(IEN_e[ii]);
+      for(int mm=0; mm<6*nsol; ++mm)
+        row_index[6*nsol*ii + mm] = ncol * gid + mm;
+    }
+
+    VecSetValues(G, 6 * nsol * nLocBas, &row_index[0], &residual[0], ADD_VALUES);
+  }
+
+  VecAssemblyBegin(G);
+  VecAssemblyEnd(G);
+
+  // Transpose the node-major right-hand sides into the columns of B
+  const double * array_g;
+  double * array_b;
+  PetscInt lda;
+  VecGetArrayRead(G, &array_g);
+  MatDenseGetArray(B, &array_b);
+  MatDenseGetLDA(B, &lda);
+
+  for(int ii=0; ii<nlocalnode; ++ii)
+  {
+    for(int mm=0; mm<ncol; ++mm)
+      array_b[mm * lda + ii] = array_g[ii * ncol + mm];
+  }
+
+  MatDenseRestoreArray(B, &array_b);
+  VecRestoreArrayRead(G, &array_g);
+}
+
+void PGAssem_Stress_Recovery_Batch::Solve( PLinear_Solver_PETSc * const &lsolver,
+    const int &nsol, const std::vector<PDNSolution *> &stress,
+    const APart_Node * const &pnode_ptr )
+{
+  SYS_T::print_fatal_if( nsol > nsnap || nsol > VEC_T::get_size(stress),
+      "Error: PGAssem_Stress_Recovery_Batch the number of solutions exceeds the batch size.\n" );
+
+  if( is_lumped_mass )
+  {
+    MatCopy(B, X, SAME_NONZERO_PATTERN);
+
+    Vec inv_mass;
+    VecDuplicate(M_lumped, &inv_mass);
+    VecCopy(M_lumped, inv_mass);
+    VecReciprocal(inv_mass);
+    MatDiagonalScale(X, inv_mass, NULL);
+    VecDestroy(&inv_mass);
+  }
+  else
+  {
+#if PETSC_VERSION_LT(3,14,0)
+    // Solve the columns one by one with the same operator
+    const double * array_b;
+    double * array_x;
+    PetscInt lda;
+    MatDenseGetArrayRead(B, &array_b);
+    MatDenseGetArray(X, &array_x);
+    MatDenseGetLDA(B, &lda);
+
+    Vec col_b, col_x;
+    VecCreateMPIWithArray(PETSC_COMM_WORLD, 1, nlocalnode, PETSC_DETERMINE, NULL, &col_b);
+    VecCreateMPIWithArray(PETSC_COMM_WORLD, 1, nlocalnode, PETSC_DETERMINE, NULL, &col_x);
+
+    for(int mm=0; mm<ncol; ++mm)
+    {
+      VecPlaceArray(col_b, array_b + mm * lda);
+      VecPlaceArray(col_x, array_x + mm * lda);
+      KSPSolve(lsolver->ksp, col_b, col_x);
+      VecResetArray(col_x);
+      VecResetArray(col_b);
+    }
+
+    VecDestroy(&col_x);
+    VecDestroy(&col_b);
+
+    MatDenseRestoreArray(X, &array_x);
+    MatDenseRestoreArrayRead(B, &array_b);
+#else
+    KSPMatSolve(lsolver->ksp, B, X);
+#endif
+  }
+
+  const double * array_x;
+  PetscInt lda;
+  MatDenseGetArrayRead(X, &array_x);
+  MatDenseGetLDA(X, &lda);
+
+  for(int ss=0; ss<nsol; ++ss)
+  {
+    Vec lsol;
+    double * val;
+    VecGhostGetLocalForm(stress[ss]->solution, &lsol);
+    VecGetArray(lsol, &val);
+
+    for(int ii=0; ii<nlocalnode; ++ii)
+    {
+      const int row = pnode_ptr->get_local_to_global(ii) - node_start;
+      for(int mm=0; mm<6; ++mm)
+        val[6 * ii + mm] = array_x[(6 * ss + mm) * lda + row];
+    }
+
+    VecRestoreArray(lsol, &val);
+    VecGhostRestoreLocalForm(stress[ss]->solution, &lsol);
+
+    stress[ss] -> GhostUpdate();
+  }
+
+  MatDenseRestoreArrayRead(X, &array_x);
+}
+
+void PGAssem_Stress_Recovery_Batch::print_info() const
+{
+  SYS_T::print_sep_line();
+  SYS_T::commPrint("  Batched stress recovery: \n");
+  SYS_T::commPrint("  snapshots per batch: %d \n", nsnap);
+  SYS_T::commPrint("  right-hand sides per batch: %d \n", ncol);
+  if( is_lumped_mass )
+    SYS_T::commPrint("  mass: HRZ lumped \n");
+  else
+    SYS_T::commPrint("  mass: consistent scalar mass solved for all right-hand sides \n");
+  SYS_T::print_sep_line();
+}
+
+//EOF
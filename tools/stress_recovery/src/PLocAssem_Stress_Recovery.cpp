@@ -171,6 +171,118 @@ void PLocAssem_Stress_Recovery::Assem_Mass_Residual(
   }
 }
 
+void PLocAssem_Stress_Recovery::Assem_Residual_Batch( const int &nsnap,
+    const double * const &isol,
+    FEAElement * const &element,
+    const double * const &eleCtrlPts_x,
+    const double * const &eleCtrlPts_y,
+    const double * const &eleCtrlPts_z,
+    const IQuadPts * const &quad,
+    double * const &residual ) const
+{
+  const int nqp = quad -> get_num_quadPts();
+
+  const int stride = 6 * nsnap;
+
+  element->buildBasis( quad, eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
+
+  for(int ii=0; ii<nLocBas * stride; ++ii) residual[ii] = 0.0;
+
+  std::vector<double> R(nLocBas, 0.0), dR_dx(nLocBas, 0.0), dR_dy(nLocBas, 0.0), dR_dz(nLocBas, 0.0);
+
+  for(int qua=0; qua<nqp; ++qua)
+  {
+    element->get_R_gradR( qua, &R[0], &dR_dx[0], &dR_dy[0], &dR_dz[0] );
+
+    const double gwts = element->get_detJac(qua) * quad->get_qw(qua);
+
+    for(int ss=0; ss<nsnap; ++ss)
+    {
+      const double * const sol = isol + 3 * nLocBas * ss;
+
+      double ux_x = 0.0, ux_y = 0.0, ux_z = 0.0;
+      double uy_x = 0.0, uy_y = 0.0, uy_z = 0.0;
+      double uz_x = 0.0, uz_y = 0.0, uz_z = 0.0;
+
+      for(int ii=0; ii<nLocBas; ++ii)
+      {
+        const int offset = 3 * ii;
+
+        ux_x += sol[offset  ] * dR_dx[ii];
+        uy_x += sol[offset+1] * dR_dx[ii];
+        uz_x += sol[offset+2] * dR_dx[ii];
+
+        ux_y += sol[offset  ] * dR_dy[ii];
+        uy_y += sol[offset+1] * dR_dy[ii];
+        uz_y += sol[offset+2] * dR_dy[ii];
+
+        ux_z += sol[offset  ] * dR_dz[ii];
+        uy_z += sol[offset+1] * dR_dz[ii];
+        uz_z += sol[offset+2] * dR_dz[ii];
+      }
+
+      const Tensor2_3D F(ux_x, ux_y, ux_z,
+                         uy_x, uy_y, uy_z,
+                         uz_x, uz_y, uz_z);
+
+      const SymmTensor2_3D stress = get_Cauchy_stress( F );
+
+      for(int A=0; A<nLocBas; ++A)
+      {
+        const double NA = gwts * R[A];
+        const int offset = A * stride + 6 * ss;
+
+        residual[offset  ] += NA * stress(0);
+        residual[offset+1] += NA * stress(1);
+        residual[offset+2] += NA * stress(2);
+        residual[offset+3] += NA * stress(5);
+        residual[offset+4] += NA * stress(3);
+        residual[offset+5] += NA * stress(4);
+      }
+    }
+  }
+}
+
+void PLocAssem_Stress_Recovery::Assem_Mass_Scalar( FEAElement * const &element,
+    const double * const &eleCtrlPts_x,
+    const double * const &eleCtrlPts_y,
+    const double * const &eleCtrlPts_z,
+    const IQuadPts * const &quad,
+    double * const &mass, double * const &lumped_mass ) const
+{
+  const int nqp = quad -> get_num_quadPts();
+
+  element->buildBasis( quad, eleCtrlPts_x, eleCtrlPts_y, eleCtrlPts_z );
+
+  for(int ii=0; ii<nLocBas * nLocBas; ++ii) mass[ii] = 0.0;
+
+  std::vector<double> R(nLocBas, 0.0);
+
+  for(int qua=0; qua<nqp; ++qua)
+  {
+    element->get_R( qua, &R[0] );
+
+    const double gwts = element->get_detJac(qua) * quad->get_qw(qua);
+
+    for(int A=0; A<nLocBas; ++A)
+    {
+      for(int B=0; B<nLocBas; ++B)
+        mass[nLocBas * A + B] += gwts * R[A] * R[B];
+    }
+  }
+
+  // HRZ lumping: scale the diagonal to preserve the element volume
+  double vol = 0.0, diag = 0.0;
+  for(int A=0; A<nLocBas; ++A)
+  {
+    diag += mass[nLocBas * A + A];
+    for(int B=0; B<nLocBas; ++B) vol += mass[nLocBas * A + B];
+  }
+
+  for(int A=0; A<nLocBas; ++A)
+    lumped_mass[A] = mass[nLocBas * A + A] * vol / diag;
+}
+
 SymmTensor2_3D PLocAssem_Stress_Recovery::get_Cauchy_stress( const Tensor2_3D &F ) const
 {
   return SymmTensor2_3D( l2mu * F(0) + lambda * (F(4) + F(8)),
@@ -6,7 +6,7 @@
 // Date Created: Nov. 4 2023
 // ============================================================================
 #include "AGlobal_Mesh_Info.hpp"
-#include "APart_Basic_Info.hpp"
+#include "ANL_Tools.hpp"
 #include "QuadPts_vis_tet4.hpp"
 #include "QuadPts_vis_tet10.hpp"
 #include "QuadPts_vis_hex8.hpp"
@@ -86,13 +86,11 @@ int main( int argc, char * argv[] )
 
   AGlobal_Mesh_Info * GMIptr = new AGlobal_Mesh_Info(part_file,rank);
 
-  APart_Basic_Info * PartBasic = new APart_Basic_Info(part_file, rank);
-
   ALocal_Elem * locElem = new ALocal_Elem(part_file, rank);
 
   APart_Node * pNode = new APart_Node(part_file, rank);
 
-  SYS_T::print_fatal_if(size != PartBasic->get_cpu_size(), "Error: number of processors does not match with prepost! \n");
+  SYS_T::print_fatal_if(size != ANL_T::get_cpu_size(part_file, rank), "Error: number of processors does not match with prepost! \n");
 
   SYS_T::commPrint("===> %d processor(s) are assigned for:", size);
 
@@ -168,7 +166,7 @@ int main( int argc, char * argv[] )
     delete [] solArrays[ii];
   delete [] solArrays;
   
-  delete fNode; delete locIEN; delete GMIptr; delete PartBasic; delete locElem;
+  delete fNode; delete locIEN; delete GMIptr; delete locElem;
   delete pNode; delete quad; delete element; delete visprep; delete vtk_w;
 
   PetscFinalize();